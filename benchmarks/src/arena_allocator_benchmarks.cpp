@@ -0,0 +1,108 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Parse and destroy time, and peak resident set size, of a document built with
+// std::allocator against one built with arena_allocator. Each allocator is measured
+// in its own child process, so that the peak RSS of one does not hide the other.
+//
+// Usage: arena_allocator_benchmarks [document size in MB]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/arena_allocator.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_document(std::size_t size)
+    {
+        std::string s = "[";
+        for (std::size_t i = 0; s.size() < size; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(',');
+            }
+            s.append(R"({"id":)" + std::to_string(i));
+            s.append(R"(,"name":"Customer number )" + std::to_string(i));
+            s.append(R"(","balance":)" + std::to_string(i * 3.25));
+            s.append(R"(,"tags":["alpha","beta","a tag that is longer than a short string"])");
+            s.append(R"(,"address":{"street":"1 Main Street, Apartment 2000","city":"Toronto","zip":"M5V 2T6"}})");
+        }
+        s.push_back(']');
+        return s;
+    }
+
+    template <class Json>
+    void parse_and_destroy(const std::string& input, const typename Json::allocator_type& alloc)
+    {
+        json_decoder<Json> decoder(result_allocator_arg, alloc);
+        json_reader reader(input, decoder);
+        reader.read();
+        Json j = decoder.get_result();
+    }
+
+    template <class F>
+    double best_seconds(F f)
+    {
+        double best = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(end - start).count();
+            if (i == 0 || seconds < best)
+            {
+                best = seconds;
+            }
+        }
+        return best;
+    }
+
+    // Runs f in a child process, and reports its time and the child's peak RSS
+    template <class F>
+    void run_in_child(const std::string& name, F f)
+    {
+        std::cout.flush();
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            double seconds = best_seconds(f);
+            struct rusage usage;
+            getrusage(RUSAGE_SELF, &usage);
+            std::cout << std::left << std::setw(20) << name
+                      << std::right << std::setw(10) << std::fixed << std::setprecision(1) << seconds*1000.0 << " ms"
+                      << std::setw(10) << usage.ru_maxrss/1024 << " MB peak RSS\n";
+            std::cout.flush();
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t megabytes = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 50;
+    std::string input = make_document(megabytes*1024*1024);
+
+    std::cout << "Input: " << input.size() / (1024*1024) << " MB, parse and destroy, best of 3\n\n";
+
+    run_in_child("std::allocator", [&]()
+    {
+        parse_and_destroy<json>(input, std::allocator<char>());
+    });
+    run_in_child("arena_allocator", [&]()
+    {
+        parse_and_destroy<arena_json>(input, arena_allocator<char>());
+    });
+}
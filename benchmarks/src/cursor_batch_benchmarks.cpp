@@ -0,0 +1,139 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to total the numbers and string lengths of an array of records with a cursor, 
+// reading the events one at a time with next() and current(), against reading them
+// in batches with read_batch(), for JSON and CBOR.
+//
+// Usage: cursor_batch_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_records(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        json records(json_array_arg);
+        records.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json record(json_object_arg);
+            record.insert_or_assign("id", static_cast<uint64_t>(i));
+            record.insert_or_assign("name", std::string(5 + gen() % 20, 'x'));
+            record.insert_or_assign("score", static_cast<double>(gen())/1000.0);
+            record.insert_or_assign("active", gen() % 2 == 0);
+            json values(json_array_arg);
+            for (std::size_t j = 0; j < 10; ++j)
+            {
+                values.push_back(static_cast<int64_t>(gen() % 1000) - 500);
+            }
+            record.insert_or_assign("values", std::move(values));
+            records.push_back(std::move(record));
+        }
+        return records;
+    }
+
+    double total_by_event(staj_cursor& cursor)
+    {
+        double total = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            const auto& event = cursor.current();
+            switch (event.event_type())
+            {
+                case staj_event_type::key:
+                case staj_event_type::string_value:
+                    total += static_cast<double>(event.get<jsoncons::string_view>().size());
+                    break;
+                case staj_event_type::int64_value:
+                    total += static_cast<double>(event.get<int64_t>());
+                    break;
+                case staj_event_type::uint64_value:
+                    total += static_cast<double>(event.get<uint64_t>());
+                    break;
+                case staj_event_type::double_value:
+                    total += event.get<double>();
+                    break;
+                default:
+                    break;
+            }
+        }
+        return total;
+    }
+
+    double total_by_batch(staj_cursor& cursor)
+    {
+        double total = 0;
+        staj_event_batch batch(1024);
+        while (!cursor.done())
+        {
+            cursor.read_batch(batch);
+            for (const auto& event : batch)
+            {
+                switch (event.event_type())
+                {
+                    case staj_event_type::key:
+                    case staj_event_type::string_value:
+                        total += static_cast<double>(event.length());
+                        break;
+                    case staj_event_type::int64_value:
+                        total += static_cast<double>(event.int64_value());
+                        break;
+                    case staj_event_type::uint64_value:
+                        total += static_cast<double>(event.uint64_value());
+                        break;
+                    case staj_event_type::double_value:
+                        total += event.double_value();
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+        return total;
+    }
+
+    template <class Cursor, class Source>
+    void run(const std::string& name, const Source& source)
+    {
+        std::size_t size = source.size();
+        for (bool batched : {false, true})
+        {
+            auto start = std::chrono::steady_clock::now();
+            Cursor cursor(source);
+            double total = batched ? total_by_batch(cursor) : total_by_event(cursor);
+            double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000;
+            std::cout << std::left << std::setw(10) << name << std::setw(14) << (batched ? "read_batch()" : "next()") << std::right
+                      << std::setw(10) << std::fixed << std::setprecision(1) << ms << " ms"
+                      << std::setw(10) << std::setprecision(0) << size/(ms*1000) << " MB/s"
+                      << "  (total " << std::setprecision(1) << total << ")\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+
+    json doc = make_records(count);
+
+    std::string text;
+    doc.dump(text);
+    run<json_cursor>("json", text);
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(doc, data);
+    run<cbor::cbor_bytes_cursor>("cbor", data);
+}
@@ -0,0 +1,145 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to read the ids of an array of records with a cursor, skipping the payload of
+// each record with skip(), against skipping it event by event with next(), for JSON,
+// CBOR, MessagePack, BSON and UBJSON.
+//
+// Usage: cursor_skip_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/bson/bson.hpp>
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_records(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        json records(json_array_arg);
+        records.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json payload(json_object_arg);
+            payload.insert_or_assign("text", std::string(50 + gen() % 200, 'x') + "\\\"quoted\\\" [text] {with} brackets");
+            json values(json_array_arg);
+            for (std::size_t j = 0; j < 20; ++j)
+            {
+                values.push_back(static_cast<double>(gen())/1000.0);
+            }
+            payload.insert_or_assign("values", std::move(values));
+            json nested(json_object_arg);
+            nested.insert_or_assign("a", static_cast<int64_t>(gen()));
+            nested.insert_or_assign("b", json(json_array_arg, {"one", "two", "three"}));
+            payload.insert_or_assign("nested", std::move(nested));
+
+            json record(json_object_arg);
+            record.insert_or_assign("id", static_cast<uint64_t>(i));
+            record.insert_or_assign("payload", std::move(payload));
+            records.push_back(std::move(record));
+        }
+        json doc(json_object_arg);
+        doc.insert_or_assign("records", std::move(records));
+        return doc;
+    }
+
+    template <class Cursor>
+    uint64_t sum_ids(Cursor& cursor, bool raw)
+    {
+        uint64_t sum = 0;
+        bool id = false;
+        for (; !cursor.done(); cursor.next())
+        {
+            const auto& event = cursor.current();
+            switch (event.event_type())
+            {
+                case staj_event_type::key:
+                    if (event.template get<jsoncons::string_view>() == "payload")
+                    {
+                        cursor.next();
+                        if (raw)
+                        {
+                            cursor.skip();
+                        }
+                        else
+                        {
+                            std::error_code ec;
+                            cursor.staj_cursor::skip(ec); // the default, event by event
+                        }
+                    }
+                    else
+                    {
+                        id = event.template get<jsoncons::string_view>() == "id";
+                    }
+                    break;
+                case staj_event_type::uint64_value:
+                case staj_event_type::int64_value:
+                    if (id)
+                    {
+                        sum += event.template get<uint64_t>();
+                        id = false;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        return sum;
+    }
+
+    template <class Cursor, class Source>
+    void run(const std::string& name, const Source& source)
+    {
+        std::size_t size = source.size();
+        for (bool raw : {false, true})
+        {
+            auto start = std::chrono::steady_clock::now();
+            Cursor cursor(source);
+            uint64_t sum = sum_ids(cursor, raw);
+            double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000;
+            std::cout << std::left << std::setw(10) << name << std::setw(12) << (raw ? "skip()" : "next()") << std::right
+                      << std::setw(10) << std::fixed << std::setprecision(1) << ms << " ms"
+                      << std::setw(10) << std::setprecision(0) << size/(ms*1000) << " MB/s"
+                      << "  (sum " << sum << ")\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+
+    json doc = make_records(count);
+
+    std::string text;
+    doc.dump(text);
+    run<json_cursor>("json", text);
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(doc, data);
+    run<cbor::cbor_bytes_cursor>("cbor", data);
+
+    data.clear();
+    msgpack::encode_msgpack(doc, data);
+    run<msgpack::msgpack_bytes_cursor>("msgpack", data);
+
+    data.clear();
+    bson::encode_bson(doc, data);
+    run<bson::bson_bytes_cursor>("bson", data);
+
+    data.clear();
+    ubjson::encode_ubjson(doc, data);
+    run<ubjson::ubjson_bytes_cursor>("ubjson", data);
+}
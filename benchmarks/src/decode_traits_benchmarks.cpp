@@ -0,0 +1,165 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to decode an array of records registered with the json_traits_macros, with decode_json and
+// decode_cbor reading the members straight from the cursor, against parsing into a basic_json
+// and converting with as<T>(), which is what the decode functions did before.
+//
+// Usage: decode_traits_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace ns {
+
+    struct quote
+    {
+        std::string symbol;
+        uint64_t sequence;
+        double bid;
+        double ask;
+        int64_t bid_size;
+        int64_t ask_size;
+        bool halted;
+        std::vector<double> levels;
+    };
+
+    class trade
+    {
+        std::string symbol_;
+        double price_;
+        int64_t size_;
+    public:
+        trade(const std::string& symbol, double price, int64_t size)
+            : symbol_(symbol), price_(price), size_(size)
+        {
+        }
+        const std::string& symbol() const {return symbol_;}
+        double price() const {return price_;}
+        int64_t size() const {return size_;}
+    };
+
+} // namespace ns
+
+JSONCONS_N_MEMBER_TRAITS(ns::quote,4,symbol,sequence,bid,ask,bid_size,ask_size,halted,levels)
+JSONCONS_ALL_CTOR_GETTER_TRAITS(ns::trade,symbol,price,size)
+
+namespace {
+
+    std::vector<ns::quote> make_quotes(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        std::vector<ns::quote> quotes;
+        quotes.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ns::quote q;
+            q.symbol = "SYM" + std::to_string(gen() % 5000);
+            q.sequence = i;
+            q.bid = static_cast<double>(gen() % 1000000)/100.0;
+            q.ask = q.bid + 0.01;
+            q.bid_size = static_cast<int64_t>(gen() % 10000);
+            q.ask_size = static_cast<int64_t>(gen() % 10000);
+            q.halted = gen() % 100 == 0;
+            for (std::size_t j = 0; j < 5; ++j)
+            {
+                q.levels.push_back(q.bid - static_cast<double>(j)/100.0);
+            }
+            quotes.push_back(std::move(q));
+        }
+        return quotes;
+    }
+
+    std::vector<ns::trade> make_trades(std::size_t count)
+    {
+        std::mt19937 gen(7);
+        std::vector<ns::trade> trades;
+        trades.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            trades.emplace_back("SYM" + std::to_string(gen() % 5000), 
+                                static_cast<double>(gen() % 1000000)/100.0, 
+                                static_cast<int64_t>(gen() % 10000));
+        }
+        return trades;
+    }
+
+    void measure(const std::string& name, const std::string& method, std::size_t count, std::function<std::size_t()> f)
+    {
+        double best = 0;
+        std::size_t n = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            n = f();
+            double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000;
+            best = i == 0 || ms < best ? ms : best;
+        }
+        if (n != count)
+        {
+            std::cout << name << " " << method << ": expected " << count << " records, got " << n << "\n";
+        }
+        std::cout << std::left << std::setw(10) << name << std::setw(20) << method << std::right
+                  << std::setw(10) << std::fixed << std::setprecision(1) << best << " ms"
+                  << std::setw(12) << std::setprecision(0) << count/(best/1000) << " records/s\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+
+    std::string quotes_text;
+    encode_json(make_quotes(count), quotes_text);
+    std::vector<uint8_t> quotes_data;
+    cbor::encode_cbor(make_quotes(count), quotes_data);
+
+    std::string trades_text;
+    encode_json(make_trades(count), trades_text);
+    std::vector<uint8_t> trades_data;
+    cbor::encode_cbor(make_trades(count), trades_data);
+
+    measure("quote", "json as<T>()", count, [&]()
+    {
+        return json::parse(quotes_text).as<std::vector<ns::quote>>().size();
+    });
+    measure("quote", "decode_json", count, [&]()
+    {
+        return decode_json<std::vector<ns::quote>>(quotes_text).size();
+    });
+    measure("quote", "cbor as<T>()", count, [&]()
+    {
+        return cbor::decode_cbor<json>(quotes_data).as<std::vector<ns::quote>>().size();
+    });
+    measure("quote", "decode_cbor", count, [&]()
+    {
+        return cbor::decode_cbor<std::vector<ns::quote>>(quotes_data).size();
+    });
+
+    measure("trade", "json as<T>()", count, [&]()
+    {
+        return json::parse(trades_text).as<std::vector<ns::trade>>().size();
+    });
+    measure("trade", "decode_json", count, [&]()
+    {
+        return decode_json<std::vector<ns::trade>>(trades_text).size();
+    });
+    measure("trade", "cbor as<T>()", count, [&]()
+    {
+        return cbor::decode_cbor<json>(trades_data).as<std::vector<ns::trade>>().size();
+    });
+    measure("trade", "decode_cbor", count, [&]()
+    {
+        return cbor::decode_cbor<std::vector<ns::trade>>(trades_data).size();
+    });
+}
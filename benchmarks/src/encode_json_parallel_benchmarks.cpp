@@ -0,0 +1,75 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to encode a large array of records to a string with encode_json and with
+// encode_json_parallel, compact and pretty printed.
+//
+// Usage: encode_json_parallel_benchmarks [record count] [thread count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/encode_json_parallel.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_document(std::size_t count)
+    {
+        json j(json_array_arg);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json item(json_object_arg);
+            item.try_emplace("id", i);
+            item.try_emplace("name", "Customer number " + std::to_string(i));
+            item.try_emplace("balance", i * 3.25);
+            item.try_emplace("active", i % 3 == 0);
+            json tags(json_array_arg);
+            tags.push_back("tag" + std::to_string(i % 17));
+            tags.push_back("tag" + std::to_string(i % 31));
+            item.try_emplace("tags", std::move(tags));
+            j.push_back(std::move(item));
+        }
+        return j;
+    }
+
+    template <class F>
+    double time_ms(F f)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000.0;
+    }
+
+    void report(const std::string& name, double ms)
+    {
+        std::cout << std::left << std::setw(32) << name << std::right 
+                  << std::setw(10) << std::fixed << std::setprecision(1) << ms << " ms\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    std::size_t num_threads = argc > 2 ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+    json doc = make_document(count);
+
+    for (auto line_indent : {indenting::no_indent, indenting::indent})
+    {
+        const char* mode = line_indent == indenting::indent ? " (pretty)" : " (compact)";
+        std::string serial;
+        std::string parallel;
+        report(std::string("encode_json") + mode, time_ms([&]() {encode_json(doc, serial, line_indent);}));
+        report(std::string("encode_json_parallel") + mode, time_ms([&]() {encode_json_parallel(doc, parallel, line_indent, num_threads);}));
+        if (serial != parallel)
+        {
+            std::cout << "Output differs\n";
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to write a document to a pipe and to read it back, through std::ostream and
+// std::istream (stream_sink, stream_source) and through file descriptors (fd_sink,
+// fd_source). A second thread drains or fills the other end of the pipe.
+//
+// Usage: fd_sink_source_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/fd_sink.hpp>
+#include <jsoncons/fd_source.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <fstream>
+#include <unistd.h>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_document(std::size_t count)
+    {
+        json j(json_array_arg);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json item(json_object_arg);
+            item.try_emplace("id", i);
+            item.try_emplace("name", "Customer number " + std::to_string(i));
+            item.try_emplace("balance", i * 3.25);
+            item.try_emplace("note", std::string(200, 'n'));
+            j.push_back(std::move(item));
+        }
+        return j;
+    }
+
+    double elapsed_ms(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000.0;
+    }
+
+    void report(const std::string& name, double ms)
+    {
+        std::cout << std::left << std::setw(24) << name << std::right 
+                  << std::setw(10) << std::fixed << std::setprecision(1) << ms << " ms\n";
+    }
+
+    // Runs write(fd) while another thread drains the pipe
+    template <class Write>
+    double time_write(Write write)
+    {
+        int fds[2];
+        if (::pipe(fds) != 0)
+        {
+            std::exit(1);
+        }
+        std::thread drain([&]()
+        {
+            char buffer[65536];
+            while (::read(fds[0], buffer, sizeof(buffer)) > 0)
+            {
+            }
+        });
+        auto start = std::chrono::steady_clock::now();
+        write(fds[1]);
+        double ms = elapsed_ms(start);
+        ::close(fds[1]);
+        drain.join();
+        ::close(fds[0]);
+        return ms;
+    }
+
+    // Runs read(fd) while another thread writes input into the pipe
+    template <class Read>
+    double time_read(const std::string& input, Read read)
+    {
+        int fds[2];
+        if (::pipe(fds) != 0)
+        {
+            std::exit(1);
+        }
+        std::thread fill([&]()
+        {
+            const char* p = input.data();
+            std::size_t remaining = input.size();
+            while (remaining > 0)
+            {
+                ssize_t n = ::write(fds[1], p, remaining);
+                if (n <= 0)
+                {
+                    break;
+                }
+                p += n;
+                remaining -= static_cast<std::size_t>(n);
+            }
+            ::close(fds[1]);
+        });
+        auto start = std::chrono::steady_clock::now();
+        read(fds[0]);
+        double ms = elapsed_ms(start);
+        fill.join();
+        ::close(fds[0]);
+        return ms;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+    json doc = make_document(count);
+    std::string input;
+    doc.dump(input);
+    std::cout << "Document: " << input.size() / (1024*1024) << " MB\n\n";
+
+    report("stream_sink", time_write([&](int fd)
+    {
+        std::ofstream os("/dev/fd/" + std::to_string(fd));
+        doc.dump(os);
+        os.flush();
+    }));
+    report("fd_sink", time_write([&](int fd)
+    {
+        basic_compact_json_encoder<char,fd_sink> encoder{fd_sink(fd)};
+        doc.dump(encoder);
+    }));
+
+    report("stream_source", time_read(input, [&](int fd)
+    {
+        std::ifstream is("/dev/fd/" + std::to_string(fd));
+        json j = json::parse(is);
+    }));
+    report("fd_source", time_read(input, [&](int fd)
+    {
+        json_decoder<json> decoder;
+        basic_json_reader<char,fd_source> reader{fd_source(fd), decoder};
+        reader.read();
+    }));
+}
@@ -0,0 +1,101 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to format integers with detail::from_integer, against snprintf, and to
+// encode arrays of ids and timestamps to JSON and CSV.
+//
+// Usage: integer_writing_benchmarks [value count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/csv/csv.hpp>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    double elapsed_ns(std::chrono::steady_clock::time_point start, std::size_t count)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1e9/count;
+    }
+
+    template <class Format>
+    void run(const std::string& name, std::size_t count, Format format)
+    {
+        std::string s;
+        std::size_t length = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s.clear();
+            format(i, s);
+            length += s.size();
+        }
+        std::cout << std::left << std::setw(32) << name << std::right
+                  << std::setw(8) << std::fixed << std::setprecision(1) << elapsed_ns(start, count) << " ns/value"
+                  << "  (" << length << " characters)\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 5000000;
+
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> ids(count);
+    std::vector<int64_t> timestamps(count);
+    std::vector<int64_t> mixed(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ids[i] = i + 1;
+        timestamps[i] = 1600000000000LL + static_cast<int64_t>(rng() % 100000000000ULL); // milliseconds
+        mixed[i] = static_cast<int64_t>(rng()) >> (rng() % 64);
+    }
+
+    run("from_integer ids", count, [&](std::size_t i, std::string& s) {jsoncons::detail::from_integer(ids[i], s);});
+    run("snprintf ids", count, [&](std::size_t i, std::string& s) 
+    {
+        char buffer[32];
+        int n = snprintf(buffer, sizeof(buffer), "%" PRIu64, ids[i]);
+        s.append(buffer, static_cast<std::size_t>(n));
+    });
+    run("from_integer timestamps", count, [&](std::size_t i, std::string& s) {jsoncons::detail::from_integer(timestamps[i], s);});
+    run("snprintf timestamps", count, [&](std::size_t i, std::string& s) 
+    {
+        char buffer[32];
+        int n = snprintf(buffer, sizeof(buffer), "%" PRId64, timestamps[i]);
+        s.append(buffer, static_cast<std::size_t>(n));
+    });
+    run("from_integer mixed int64", count, [&](std::size_t i, std::string& s) {jsoncons::detail::from_integer(mixed[i], s);});
+
+    json doc(json_array_arg);
+    doc.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        doc.push_back(timestamps[i]);
+    }
+    std::string out;
+    auto start = std::chrono::steady_clock::now();
+    doc.dump(out);
+    std::cout << std::left << std::setw(32) << "json dump timestamps" << std::right 
+              << std::setw(8) << elapsed_ns(start, count) << " ns/value\n";
+
+    json rows(json_array_arg);
+    for (std::size_t i = 0; i < count/4; ++i)
+    {
+        rows.push_back(json(json_array_arg, {json(ids[i]), json(timestamps[i]), json(mixed[i]), json(ids[i]*7)}));
+    }
+    std::string csv_out;
+    start = std::chrono::steady_clock::now();
+    csv::encode_csv(rows, csv_out);
+    std::cout << std::left << std::setw(32) << "csv encode rows" << std::right 
+              << std::setw(8) << elapsed_ns(start, (count/4)*4) << " ns/value\n";
+}
@@ -0,0 +1,87 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time the calling thread spends freeing a large json document, destroying it inline
+// against handing it to a json_disposer, and the time the disposer's worker takes.
+//
+// Usage: json_disposer_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_disposer.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_records(std::size_t count)
+    {
+        json records(json_array_arg);
+        records.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json record(json_object_arg);
+            record.insert_or_assign("id", i);
+            record.insert_or_assign("name", "a customer name that is not short " + std::to_string(i));
+            record.insert_or_assign("balance", static_cast<double>(i) * 3.25);
+            json tags(json_array_arg);
+            tags.push_back("alpha");
+            tags.push_back("a tag that is longer than a short string");
+            record.insert_or_assign("tags", std::move(tags));
+            records.push_back(std::move(record));
+        }
+        return records;
+    }
+
+    double elapsed_ms(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000.0;
+    }
+
+    void report(const std::string& method, double ms)
+    {
+        std::cout << std::left << std::setw(28) << method << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(4) << ms << " ms\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 500000;
+    std::cout << count << " records, best of 5\n\n";
+
+    double inline_ms = 0;
+    double dispose_ms = 0;
+    double worker_ms = 0;
+    json_disposer<json> disposer;
+    for (int i = 0; i < 5; ++i)
+    {
+        {
+            json doc = make_records(count);
+            auto start = std::chrono::steady_clock::now();
+            doc = json();
+            double ms = elapsed_ms(start);
+            inline_ms = i == 0 || ms < inline_ms ? ms : inline_ms;
+        }
+        {
+            json doc = make_records(count);
+            auto start = std::chrono::steady_clock::now();
+            disposer.dispose(std::move(doc));
+            double ms = elapsed_ms(start);
+            dispose_ms = i == 0 || ms < dispose_ms ? ms : dispose_ms;
+
+            // The wait includes the worker's time to destroy the document
+            start = std::chrono::steady_clock::now();
+            disposer.flush();
+            ms = elapsed_ms(start);
+            worker_ms = i == 0 || ms < worker_ms ? ms : worker_ms;
+        }
+    }
+    report("destroy inline", inline_ms);
+    report("json_disposer::dispose", dispose_ms);
+    report("json_disposer::flush", worker_ms);
+}
@@ -0,0 +1,112 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Throughput of json_lines_reader against parsing one line at a time,
+// for 1, 2, 4, ... threads up to the hardware concurrency.
+//
+// Usage: json_lines_benchmarks [line count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_lines(std::size_t count)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s.append(R"({"id":)" + std::to_string(i));
+            s.append(R"(,"name":"Customer )" + std::to_string(i));
+            s.append(R"(","balance":)" + std::to_string(i * 3.25));
+            s.append(R"(,"active":)");
+            s.append(i % 2 == 0 ? "true" : "false");
+            s.append(R"(,"tags":["alpha","beta","gamma"],"address":{"street":"1 Main St","city":"Toronto","zip":"M5V 2T6"}})");
+            s.push_back('\n');
+        }
+        return s;
+    }
+
+    template <class F>
+    double best_seconds(F f)
+    {
+        double best = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(end - start).count();
+            if (i == 0 || seconds < best)
+            {
+                best = seconds;
+            }
+        }
+        return best;
+    }
+
+    void report(const std::string& name, std::size_t bytes, std::size_t count, double seconds)
+    {
+        std::cout << std::left << std::setw(28) << name
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+                  << (static_cast<double>(bytes) / (1024.0*1024.0) / seconds) << " MB/s"
+                  << std::setw(10) << count << " documents\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t line_count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+    std::string input = make_lines(line_count);
+
+    std::cout << "Input: " << input.size() / (1024*1024) << " MB, " << line_count << " lines, "
+              << std::thread::hardware_concurrency() << " hardware threads\n\n";
+
+    std::size_t count = 0;
+    double seconds = best_seconds([&]()
+    {
+        count = 0;
+        std::istringstream is(input);
+        std::string line;
+        while (std::getline(is, line))
+        {
+            json j = json::parse(line);
+            ++count;
+        }
+    });
+    report("json::parse per line", input.size(), count, seconds);
+
+    std::size_t max_threads = jsoncons::detail::thread_pool::default_concurrency();
+    for (std::size_t num_threads = 1; ; num_threads *= 2)
+    {
+        if (num_threads > max_threads)
+        {
+            num_threads = max_threads;
+        }
+        seconds = best_seconds([&]()
+        {
+            count = 0;
+            std::istringstream is(input);
+            json_lines_reader reader(is, num_threads);
+            json j;
+            while (reader.read_next(j))
+            {
+                ++count;
+            }
+        });
+        report("json_lines_reader, " + std::to_string(num_threads) + " threads", input.size(), count, seconds);
+        if (num_threads == max_threads)
+        {
+            break;
+        }
+    }
+}
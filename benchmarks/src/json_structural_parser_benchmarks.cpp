@@ -0,0 +1,124 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to read JSON texts of different shapes with a default_json_visitor, with basic_json_parser
+// and with basic_json_structural_parser.
+//
+// Usage: json_structural_parser_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_structural_parser.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    using string_reader = basic_json_reader<char,string_source<char>>;
+    using string_structural_reader = basic_json_reader<char,string_source<char>,std::allocator<char>,json_structural_parser>;
+
+    std::string make_records(std::size_t count, indenting line_indent)
+    {
+        std::mt19937 gen(42);
+        json records(json_array_arg);
+        records.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json record(json_object_arg);
+            record.insert_or_assign("id", static_cast<uint64_t>(gen()));
+            record.insert_or_assign("name", "user name " + std::to_string(i));
+            record.insert_or_assign("score", static_cast<double>(gen() % 10000)/7.0);
+            json tags(json_array_arg);
+            tags.push_back("a");
+            tags.push_back("bb");
+            tags.push_back("ccc");
+            record.insert_or_assign("tags", std::move(tags));
+            record.insert_or_assign("active", true);
+            records.push_back(std::move(record));
+        }
+        std::string text;
+        records.dump(text, line_indent);
+        return text;
+    }
+
+    std::string make_strings(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        std::string text = "[";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                text.push_back(',');
+            }
+            text.push_back('\"');
+            text.append(80 + gen() % 80, 'x');
+            text.push_back('\"');
+        }
+        text.push_back(']');
+        return text;
+    }
+
+    std::string make_doubles(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        std::string text = "[";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                text.push_back(',');
+            }
+            text.append(std::to_string(static_cast<double>(gen() % 2000000)/1000.0));
+        }
+        text.push_back(']');
+        return text;
+    }
+
+    void measure(const std::string& name, const std::string& method, std::size_t size, std::function<void()> f)
+    {
+        double best = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000;
+            best = i == 0 || ms < best ? ms : best;
+        }
+        std::cout << std::left << std::setw(16) << name << std::setw(20) << method << std::right
+                  << std::setw(10) << std::fixed << std::setprecision(1) << best << " ms"
+                  << std::setw(10) << std::setprecision(0) << size/(best*1000) << " MB/s\n";
+    }
+
+    void measure_both(const std::string& name, const std::string& text)
+    {
+        measure(name, "json_parser", text.size(), [&]()
+        {
+            default_json_visitor visitor;
+            string_reader reader(text, visitor);
+            reader.read();
+        });
+        measure(name, "structural_parser", text.size(), [&]()
+        {
+            default_json_visitor visitor;
+            string_structural_reader reader(text, visitor);
+            reader.read();
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+
+    measure_both("records", make_records(count, indenting::no_indent));
+    measure_both("records pretty", make_records(count, indenting::indent));
+    measure_both("long strings", make_strings(count/2));
+    measure_both("doubles", make_doubles(count*5));
+}
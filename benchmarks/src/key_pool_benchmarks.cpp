@@ -0,0 +1,106 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Parse time and peak resident set size of an event log export, an array of records
+// that share the same keys, decoded with std::basic_string keys and with keys interned
+// in a key_pool. Each variant is measured in its own child process, so that the peak
+// RSS of one does not hide the other.
+//
+// Usage: key_pool_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_event_log(std::size_t count)
+    {
+        std::string s = "[";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(',');
+            }
+            std::string n = std::to_string(i);
+            s.append(R"({"event_timestamp":")" + n + R"(","event_type":"request","service_name":"checkout")");
+            s.append(R"(,"correlation_id":")" + n + R"(","http_method":"GET","http_status_code":200)");
+            s.append(R"(,"request_duration_ms":)" + std::to_string(i % 977));
+            s.append(R"(,"user_agent_string":"curl","client_ip_address":"10.0.0.1","level":"info")");
+            s.append(R"(,"message":"ok","bytes_sent_to_client":)" + std::to_string(i % 4096) + "}");
+        }
+        s.push_back(']');
+        return s;
+    }
+
+    // Runs f in a child process, and reports its time and the child's peak RSS
+    template <class F>
+    void run_in_child(const std::string& name, F f)
+    {
+        std::cout.flush();
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::size_t size = f();
+            auto end = std::chrono::steady_clock::now();
+            struct rusage usage;
+            getrusage(RUSAGE_SELF, &usage);
+            std::cout << std::left << std::setw(20) << name
+                      << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+                      << std::chrono::duration<double>(end - start).count()*1000.0 << " ms"
+                      << std::setw(10) << usage.ru_maxrss/1024 << " MB peak RSS"
+                      << std::setw(10) << size << " records\n";
+            std::cout.flush();
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    std::string input = make_event_log(count);
+
+    std::cout << "Input: " << input.size() / (1024*1024) << " MB, " << count << " records\n\n";
+
+    run_in_child("json", [&]()
+    {
+        json j = json::parse(input);
+        return j.size();
+    });
+    run_in_child("interned_json", [&]()
+    {
+        key_pool pool;
+        json_decoder<interned_json> decoder(pool);
+        json_reader reader(input, decoder);
+        reader.read();
+        interned_json j = decoder.get_result();
+        return j.size();
+    });
+    run_in_child("ojson", [&]()
+    {
+        ojson j = ojson::parse(input);
+        return j.size();
+    });
+    run_in_child("interned_ojson", [&]()
+    {
+        key_pool pool;
+        json_decoder<interned_ojson> decoder(pool);
+        json_reader reader(input, decoder);
+        reader.read();
+        interned_ojson j = decoder.get_result();
+        return j.size();
+    });
+}
@@ -0,0 +1,215 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Heap allocations, container nodes, and parse, traversal and destroy times 
+// for a corpus of API responses, which have many empty and very small arrays 
+// and objects.
+//
+// Usage: small_container_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::size_t allocation_count = 0;
+    std::size_t allocation_bytes = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+    allocation_bytes += size;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+    // Records shaped like the items of a REST API listing (issues, pull requests)
+    std::string make_corpus(std::size_t count)
+    {
+        std::string s = "[";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(',');
+            }
+            std::string n = std::to_string(i);
+            s.append(R"({"id":)" + n);
+            s.append(R"(,"number":)" + n);
+            s.append(R"(,"title":"Issue number )" + n + R"(","state":"open","locked":false)");
+            s.append(R"(,"user":{"login":"user)" + n + R"(","id":)" + n + R"(,"type":"User","site_admin":false})");
+            s.append(i % 3 == 0 ? R"(,"labels":[{"id":1,"name":"bug","default":true}])" : R"(,"labels":[])");
+            s.append(R"(,"assignees":[],"milestone":null,"comments":)" + std::to_string(i % 4));
+            s.append(i % 5 == 0 ? R"(,"pull_request":{})" : R"(,"pull_request":null)");
+            s.append(R"(,"reactions":{"total_count":0,"+1":0,"-1":0,"laugh":0,"hooray":0})");
+            s.append(R"(,"requested_reviewers":[],"requested_teams":[],"draft":false,"range":[0,)" + n + R"(]})");
+        }
+        s.push_back(']');
+        return s;
+    }
+
+    struct node_counts
+    {
+        std::size_t values = 0;
+        std::size_t arrays = 0;
+        std::size_t objects = 0;
+        std::size_t empty_containers = 0;
+        std::size_t heap_containers = 0;
+        std::size_t buffered_containers = 0;
+    };
+
+    void count_nodes(const json& j, node_counts& counts)
+    {
+        ++counts.values;
+        // Elements kept in the buffer allocated with the container node need no allocation of their own
+        if (j.storage() == storage_kind::array_value)
+        {
+            ++counts.heap_containers;
+            if (j.array_value().capacity() == j.array_value().buffer_capacity())
+            {
+                ++counts.buffered_containers;
+            }
+        }
+        else if (j.storage() == storage_kind::object_value)
+        {
+            ++counts.heap_containers;
+            if (j.object_value().capacity() == j.object_value().buffer_capacity())
+            {
+                ++counts.buffered_containers;
+            }
+        }
+        if (j.is_array())
+        {
+            ++counts.arrays;
+            if (j.empty())
+            {
+                ++counts.empty_containers;
+            }
+            for (const auto& item : j.array_range())
+            {
+                count_nodes(item, counts);
+            }
+        }
+        else if (j.is_object())
+        {
+            ++counts.objects;
+            if (j.empty())
+            {
+                ++counts.empty_containers;
+            }
+            for (const auto& member : j.object_range())
+            {
+                count_nodes(member.value(), counts);
+            }
+        }
+    }
+
+    // Visits every value of a const document
+    std::size_t traverse(const json& j)
+    {
+        std::size_t n = 1;
+        if (j.is_array())
+        {
+            for (const auto& item : j.array_range())
+            {
+                n += traverse(item);
+            }
+        }
+        else if (j.is_object())
+        {
+            for (const auto& member : j.object_range())
+            {
+                n += traverse(member.value());
+            }
+        }
+        return n;
+    }
+
+    template <class F>
+    double best_seconds(F f)
+    {
+        double best = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            auto end = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(end - start).count();
+            if (i == 0 || seconds < best)
+            {
+                best = seconds;
+            }
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    const std::string input = make_corpus(count);
+
+    std::size_t count_before = allocation_count;
+    std::size_t bytes_before = allocation_bytes;
+    json j = json::parse(input);
+    std::size_t allocations = allocation_count - count_before;
+    std::size_t bytes = allocation_bytes - bytes_before;
+
+    node_counts counts;
+    count_nodes(j, counts);
+
+    std::size_t visited = 0;
+    double parse_seconds = best_seconds([&]() { json k = json::parse(input); });
+    double traverse_seconds = best_seconds([&]() { visited += traverse(j); });
+    double destroy_seconds = 0;
+    for (int i = 0; i < 5; ++i)
+    {
+        json k = json::parse(input);
+        auto start = std::chrono::steady_clock::now();
+        k = json();
+        auto end = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        if (i == 0 || seconds < destroy_seconds)
+        {
+            destroy_seconds = seconds;
+        }
+    }
+
+    std::cout << "Input: " << input.size() / 1024 << " KB, " << count << " records\n\n";
+    std::cout << "Values:                 " << counts.values << "\n";
+    std::cout << "Arrays:                 " << counts.arrays << "\n";
+    std::cout << "Objects:                " << counts.objects << "\n";
+    std::cout << "Empty containers:       " << counts.empty_containers << "\n";
+    std::cout << "Heap container nodes:   " << counts.heap_containers << "\n";
+    std::cout << "  elements in the node: " << counts.buffered_containers << "\n";
+    std::cout << "Parse allocations:      " << allocations << " (" << bytes / 1024 << " KB)\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Parse, best of 5:       " << parse_seconds*1000.0 << " ms\n";
+    std::cout << "Traverse, best of 5:    " << traverse_seconds*1000.0 << " ms\n";
+    std::cout << "Destroy, best of 5:     " << destroy_seconds*1000.0 << " ms\n";
+    std::cout << "(visited " << visited / 5 << " values)\n";
+}
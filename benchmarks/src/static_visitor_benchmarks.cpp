@@ -0,0 +1,120 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to reformat a JSON text (compact and pretty printed) and to transcode it to CBOR 
+// and UBJSON, with the parser calling the encoder through basic_json_visitor 
+// (parse_some) and through its own type (parse_some_static).
+//
+// Usage: static_visitor_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/ubjson/ubjson.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_records(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        json records(json_array_arg);
+        records.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json record(json_object_arg);
+            record.insert_or_assign("id", static_cast<uint64_t>(i));
+            record.insert_or_assign("name", "Customer number " + std::to_string(i));
+            record.insert_or_assign("active", gen() % 2 == 0);
+            json values(json_array_arg);
+            for (std::size_t j = 0; j < 10; ++j)
+            {
+                values.push_back(static_cast<int64_t>(gen() % 1000) - 500);
+            }
+            record.insert_or_assign("values", std::move(values));
+            json tags(json_array_arg);
+            tags.push_back("a");
+            tags.push_back(json::null());
+            record.insert_or_assign("tags", std::move(tags));
+            records.push_back(std::move(record));
+        }
+        return records;
+    }
+
+    template <class Encoder>
+    void parse(const std::string& text, Encoder& encoder, bool use_static)
+    {
+        json_parser parser;
+        std::error_code ec;
+        parser.update(text.data(), text.size());
+        if (use_static)
+        {
+            parser.parse_some_static(encoder, ec);
+            parser.finish_parse_static(encoder, ec);
+        }
+        else
+        {
+            parser.parse_some(encoder, ec);
+            parser.finish_parse(encoder, ec);
+        }
+        parser.check_done(ec);
+        if (ec)
+        {
+            std::cerr << ec.message() << "\n";
+            std::exit(1);
+        }
+    }
+
+    template <class Encoder, class Output>
+    void run(const std::string& name, const std::string& text)
+    {
+        // Best of 10, alternating between the two, into output with room reserved
+        double best[2] = {0, 0};
+        std::size_t size[2] = {0, 0};
+        for (int i = 0; i < 10; ++i)
+        {
+            for (bool use_static : {false, true})
+            {
+                Output output;
+                output.reserve(2*text.size());
+                auto start = std::chrono::steady_clock::now();
+                {
+                    Encoder encoder(output);
+                    parse(text, encoder, use_static);
+                }
+                double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000;
+                best[use_static] = i == 0 || ms < best[use_static] ? ms : best[use_static];
+                size[use_static] = output.size();
+            }
+        }
+        for (bool use_static : {false, true})
+        {
+            std::cout << std::left << std::setw(10) << name << std::setw(20) << (use_static ? "parse_some_static" : "parse_some") << std::right
+                      << std::setw(10) << std::fixed << std::setprecision(1) << best[use_static] << " ms"
+                      << std::setw(10) << std::setprecision(0) << text.size()/(best[use_static]*1000) << " MB/s"
+                      << "  (" << size[use_static] << " bytes)\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+
+    std::string text;
+    make_records(count).dump(text, indenting::indent);
+
+    run<compact_json_string_encoder,std::string>("compact", text);
+    run<json_string_encoder,std::string>("pretty", text);
+    run<cbor::cbor_bytes_encoder,std::vector<uint8_t>>("cbor", text);
+    run<ubjson::ubjson_bytes_encoder,std::vector<uint8_t>>("ubjson", text);
+}
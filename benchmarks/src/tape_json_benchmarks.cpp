@@ -0,0 +1,136 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Heap allocations, parse time and traversal time of a tape_json document
+// against json and ojson documents, and the time of the first and later
+// jsonpath queries against a tape_json document.
+//
+// Usage: tape_json_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/tape_json.hpp>
+#include <jsoncons_ext/jsonpath/tape_json_query.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <new>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::size_t allocation_count = 0;
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocation_count;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+    std::string make_document(std::size_t count)
+    {
+        std::string s = "[";
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                s.push_back(',');
+            }
+            std::string n = std::to_string(i);
+            s.append(R"({"id":)" + n + R"(,"name":"Customer number )" + n + R"(","active":true)");
+            s.append(R"(,"balance":)" + std::to_string(i * 3.25));
+            s.append(R"(,"tags":["alpha","beta","a tag that is longer than a short string"])");
+            s.append(R"(,"address":{"street":"1 Main Street, Apartment 2000","city":"Toronto","zip":"M5V 2T6"}})");
+        }
+        s.push_back(']');
+        return s;
+    }
+
+    // Sums the ids and the lengths of the cities, to traverse every record
+    template <class Doc>
+    double sum_records(const Doc& doc)
+    {
+        double sum = 0;
+        for (const auto& record : doc.array_range())
+        {
+            sum += record.at("id").template as<double>();
+            sum += static_cast<double>(record.at("address").at("city").as_string_view().size());
+        }
+        return sum;
+    }
+
+    double elapsed_ms(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000.0;
+    }
+
+    template <class Doc,class Parse>
+    void run(const std::string& name, Parse parse)
+    {
+        std::size_t count_before = allocation_count;
+        auto start = std::chrono::steady_clock::now();
+        Doc doc = parse();
+        double parse_ms = elapsed_ms(start);
+        std::size_t allocations = allocation_count - count_before;
+
+        start = std::chrono::steady_clock::now();
+        double sum = sum_records(doc);
+        double traverse_ms = elapsed_ms(start);
+
+        std::cout << std::left << std::setw(12) << name << std::right
+                  << std::setw(12) << allocations << " allocations"
+                  << std::setw(10) << std::fixed << std::setprecision(1) << parse_ms << " ms parse"
+                  << std::setw(10) << traverse_ms << " ms traverse"
+                  << "  (" << std::setprecision(0) << sum << ")\n";
+    }
+
+    // The first query makes the document's basic_json copy, the later ones reuse it
+    void run_queries(const tape_json& doc)
+    {
+        for (int i = 1; i <= 3; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            ojson result = jsonpath::json_query(doc, "$[?(@.balance > 1000)].address.city");
+            double query_ms = elapsed_ms(start);
+
+            std::cout << std::left << std::setw(12) << "tape_json" << "query " << i << std::right
+                      << std::setw(10) << std::fixed << std::setprecision(1) << query_ms << " ms"
+                      << "  (" << result.size() << " results)\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+    std::string input = make_document(count);
+
+    std::cout << "Input: " << input.size() / (1024*1024) << " MB, " << count << " records\n\n";
+
+    run<json>("json", [&]() {return json::parse(input);});
+    run<ojson>("ojson", [&]() {return ojson::parse(input);});
+    run<tape_json>("tape_json", [&]() {return tape_json::parse(input);});
+
+    std::cout << "\n";
+    run_queries(tape_json::parse(input));
+}
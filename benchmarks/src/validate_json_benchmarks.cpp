@@ -0,0 +1,99 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to validate a JSON text with validate_json, against json_reader with a default_json_visitor,
+// and to minify it with minify_json, against json_reader with a compact_json_string_encoder.
+//
+// Usage: validate_json_benchmarks [record count]
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/validate_json.hpp>
+#include <jsoncons/minify_json.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    json make_records(std::size_t count)
+    {
+        std::mt19937 gen(42);
+        json records(json_array_arg);
+        records.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json record(json_object_arg);
+            record.insert_or_assign("id", static_cast<uint64_t>(i));
+            record.insert_or_assign("name", "Customer number " + std::to_string(i));
+            record.insert_or_assign("email", "customer" + std::to_string(i) + "@example.com");
+            record.insert_or_assign("note", std::string(20 + gen() % 100, 'x') + " \"quoted\"\tcaf\xc3\xa9");
+            record.insert_or_assign("active", gen() % 2 == 0);
+            record.insert_or_assign("balance", static_cast<double>(gen() % 1000000)/100.0);
+            json values(json_array_arg);
+            for (std::size_t j = 0; j < 10; ++j)
+            {
+                values.push_back(static_cast<int64_t>(gen() % 1000) - 500);
+            }
+            record.insert_or_assign("values", std::move(values));
+            records.push_back(std::move(record));
+        }
+        return records;
+    }
+
+    void measure(const std::string& name, const std::string& method, std::size_t size, std::function<void()> f)
+    {
+        double best = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1000;
+            best = i == 0 || ms < best ? ms : best;
+        }
+        std::cout << std::left << std::setw(10) << name << std::setw(20) << method << std::right
+                  << std::setw(10) << std::fixed << std::setprecision(1) << best << " ms"
+                  << std::setw(10) << std::setprecision(0) << size/(best*1000) << " MB/s\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200000;
+
+    std::string text;
+    make_records(count).dump(text, indenting::indent);
+
+    measure("validate", "json_reader", text.size(), [&]()
+    {
+        default_json_visitor visitor;
+        json_reader reader(text, visitor);
+        reader.read();
+    });
+    measure("validate", "validate_json", text.size(), [&]()
+    {
+        validate_json(text);
+    });
+
+    std::string output;
+    output.reserve(text.size());
+    measure("minify", "json_reader", text.size(), [&]()
+    {
+        output.clear();
+        compact_json_string_encoder encoder(output);
+        json_reader reader(text, encoder);
+        reader.read();
+    });
+    std::size_t encoded_size = output.size();
+    measure("minify", "minify_json", text.size(), [&]()
+    {
+        output.clear();
+        minify_json(text, output);
+    });
+    std::cout << "(" << text.size() << " bytes, minified to " << encoded_size << " and " << output.size() << " bytes)\n";
+}
@@ -0,0 +1,98 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+// Time to format doubles with write_double, shortest and with a precision,
+// against snprintf.
+//
+// Usage: write_double_benchmarks [value count]
+
+#include <jsoncons/json.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::vector<double> make_values(std::size_t count)
+    {
+        std::mt19937_64 rng(42);
+        std::vector<double> values;
+        values.reserve(count);
+        while (values.size() < count)
+        {
+            double d;
+            switch (values.size() % 3)
+            {
+                case 0:
+                {
+                    uint64_t bits = rng();
+                    std::memcpy(&d, &bits, sizeof(double));
+                    break;
+                }
+                case 1:
+                    d = static_cast<double>(rng() % 10000000) / 100.0; // prices
+                    break;
+                default:
+                    d = std::ldexp(static_cast<double>(rng() % (uint64_t(1) << 53)), static_cast<int>(rng() % 80) - 60);
+                    break;
+            }
+            if (std::isfinite(d))
+            {
+                values.push_back(d);
+            }
+        }
+        return values;
+    }
+
+    template <class Format>
+    void run(const std::string& name, const std::vector<double>& values, Format format)
+    {
+        std::string s;
+        std::size_t length = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (double d : values)
+        {
+            s.clear();
+            format(d, s);
+            length += s.size();
+        }
+        double ns = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()*1e9/values.size();
+        std::cout << std::left << std::setw(28) << name << std::right
+                  << std::setw(8) << std::fixed << std::setprecision(1) << ns << " ns/value"
+                  << "  (" << length << " characters)\n";
+    }
+
+    void run_snprintf(const std::string& name, const std::vector<double>& values, const char* format, int precision)
+    {
+        run(name, values, [format,precision](double d, std::string& s)
+        {
+            char buffer[64];
+            int length = snprintf(buffer, sizeof(buffer), format, precision, d);
+            s.append(buffer, static_cast<std::size_t>(length));
+        });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 2000000;
+    std::vector<double> values = make_values(count);
+
+    run("write_double general", values, jsoncons::detail::write_double(float_chars_format::general, 0));
+    run("write_double scientific", values, jsoncons::detail::write_double(float_chars_format::scientific, 0));
+    run("write_double general 6", values, jsoncons::detail::write_double(float_chars_format::general, 6));
+    run_snprintf("snprintf %.6g", values, "%.*g", 6);
+    run("write_double general 17", values, jsoncons::detail::write_double(float_chars_format::general, 17));
+    run_snprintf("snprintf %.17g", values, "%.*g", 17);
+    run("write_double scientific 3", values, jsoncons::detail::write_double(float_chars_format::scientific, 3));
+    run_snprintf("snprintf %.3e", values, "%.*e", 3);
+}
@@ -0,0 +1,273 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ARENA_ALLOCATOR_HPP
+#define JSONCONS_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new> // std::bad_alloc
+#include <atomic>
+#include <limits> // std::numeric_limits
+#include <type_traits> // std::true_type
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+    // A monotonic buffer. Memory is handed out from a list of blocks by bumping a pointer,
+    // each block twice the size of the one before, and the blocks are freed all at once
+    // when the arena is destroyed. Deallocation only reclaims the most recent allocation.
+    // Not thread safe.
+
+    class arena
+    {
+    public:
+        static constexpr std::size_t default_initial_block_size = 1024;
+        static constexpr std::size_t max_block_size = 64*1024*1024;
+    private:
+        struct block
+        {
+            block* next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t header_size = (sizeof(block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        block* head_;
+        char* current_;
+        char* end_;
+        std::size_t next_block_size_;
+        std::size_t block_count_;
+        std::size_t bytes_reserved_;
+
+        // Noncopyable and nonmoveable
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+    public:
+        explicit arena(std::size_t initial_block_size = default_initial_block_size) noexcept
+            : head_(nullptr), current_(nullptr), end_(nullptr),
+              next_block_size_(initial_block_size < header_size*2 ? header_size*2 : initial_block_size),
+              block_count_(0), bytes_reserved_(0)
+        {
+        }
+
+        ~arena() noexcept
+        {
+            release();
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            char* p = align_up(current_, alignment);
+            if (p == nullptr || size > static_cast<std::size_t>(end_ - p))
+            {
+                add_block(size + alignment);
+                p = align_up(current_, alignment);
+            }
+            current_ = p + size;
+            return p;
+        }
+
+        void deallocate(void* p, std::size_t size) noexcept
+        {
+            if (static_cast<char*>(p) + size == current_)
+            {
+                current_ = static_cast<char*>(p);
+            }
+        }
+
+        // Frees all blocks
+        void release() noexcept
+        {
+            while (head_ != nullptr)
+            {
+                block* next = head_->next;
+                ::operator delete(head_);
+                head_ = next;
+            }
+            current_ = nullptr;
+            end_ = nullptr;
+            block_count_ = 0;
+            bytes_reserved_ = 0;
+        }
+
+        std::size_t block_count() const
+        {
+            return block_count_;
+        }
+
+        // Total size of the blocks
+        std::size_t bytes_reserved() const
+        {
+            return bytes_reserved_;
+        }
+    private:
+        static char* align_up(char* p, std::size_t alignment) noexcept
+        {
+            if (p == nullptr)
+            {
+                return nullptr;
+            }
+            std::uintptr_t n = reinterpret_cast<std::uintptr_t>(p);
+            return p + ((alignment - (n & (alignment - 1))) & (alignment - 1));
+        }
+
+        void add_block(std::size_t min_size)
+        {
+            std::size_t size = next_block_size_;
+            if (min_size > size - header_size)
+            {
+                if (min_size > (std::numeric_limits<std::size_t>::max)() - header_size)
+                {
+                    JSONCONS_THROW(std::bad_alloc());
+                }
+                size = min_size + header_size;
+            }
+            block* b = static_cast<block*>(::operator new(size));
+            b->next = head_;
+            b->size = size;
+            head_ = b;
+            current_ = reinterpret_cast<char*>(b) + header_size;
+            end_ = reinterpret_cast<char*>(b) + size;
+            ++block_count_;
+            bytes_reserved_ += size;
+            if (next_block_size_ < max_block_size)
+            {
+                next_block_size_ *= 2;
+            }
+        }
+    };
+
+namespace detail {
+
+    struct shared_arena
+    {
+        arena resource;
+        std::atomic<std::size_t> use_count;
+
+        explicit shared_arena(std::size_t initial_block_size) noexcept
+            : resource(initial_block_size), use_count(1)
+        {
+        }
+    };
+
+} // namespace detail
+
+    // An allocator that takes its memory from a shared arena. A default constructed
+    // arena_allocator creates a new arena, copies and rebound copies share it, and the
+    // arena is freed when the last allocator that refers to it is destroyed. A json value
+    // that uses arena_allocator keeps a copy of the allocator in each string, array and
+    // object, so a parsed document's memory lives exactly as long as the document.
+    // The count of allocators sharing an arena is atomic, so allocators may be copied and
+    // destroyed concurrently, as when threads read the same document, but the arena itself
+    // must not be allocated from concurrently.
+
+    template <class T>
+    class arena_allocator
+    {
+        template <class U> friend class arena_allocator;
+
+        detail::shared_arena* ptr_;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template <class U>
+        struct rebind
+        {
+            using other = arena_allocator<U>;
+        };
+
+        arena_allocator()
+            : ptr_(new detail::shared_arena(arena::default_initial_block_size))
+        {
+        }
+
+        explicit arena_allocator(std::size_t initial_block_size)
+            : ptr_(new detail::shared_arena(initial_block_size))
+        {
+        }
+
+        // Copy only, a moved from allocator must still be usable
+        arena_allocator(const arena_allocator& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            ptr_->use_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template <class U>
+        arena_allocator(const arena_allocator<U>& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            ptr_->use_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ~arena_allocator() noexcept
+        {
+            release(ptr_);
+        }
+
+        arena_allocator& operator=(const arena_allocator& other) noexcept
+        {
+            other.ptr_->use_count.fetch_add(1, std::memory_order_relaxed);
+            detail::shared_arena* old = ptr_;
+            ptr_ = other.ptr_;
+            release(old);
+            return *this;
+        }
+
+        T* allocate(size_type n)
+        {
+            if (n > (std::numeric_limits<size_type>::max)() / sizeof(T))
+            {
+                JSONCONS_THROW(std::bad_alloc());
+            }
+            return static_cast<T*>(ptr_->resource.allocate(n*sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            ptr_->resource.deallocate(p, n*sizeof(T));
+        }
+
+        arena& resource() const noexcept
+        {
+            return ptr_->resource;
+        }
+
+        template <class U>
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+        {
+            return &lhs.resource() == &rhs.resource();
+        }
+
+        template <class U>
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+        {
+            return &lhs.resource() != &rhs.resource();
+        }
+    private:
+        static void release(detail::shared_arena* ptr) noexcept
+        {
+            if (ptr->use_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete ptr;
+            }
+        }
+    };
+
+
+    using arena_json = basic_json<char,sorted_policy,arena_allocator<char>>;
+    using arena_ojson = basic_json<char,preserve_order_policy,arena_allocator<char>>;
+
+} // namespace jsoncons
+
+#endif
@@ -37,6 +37,7 @@
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/string_wrapper.hpp>
+#include <jsoncons/detail/buffered_vector.hpp>
 
 namespace jsoncons { 
 
@@ -235,8 +236,10 @@ struct sorted_policy
 {
     using key_order = sort_key_order;
 
+    // Arrays and objects can keep their elements in the same allocation as their
+    // container node, see detail::buffered_vector
     template <class T,class Allocator>
-    using sequence_container_type = std::vector<T,Allocator>;
+    using sequence_container_type = jsoncons::detail::buffered_vector<T,Allocator>;
 
     template <class CharT, class CharTraits, class Allocator>
     using key_storage = std::basic_string<CharT, CharTraits,Allocator>;
@@ -249,6 +252,19 @@ struct preserve_order_policy : public sorted_policy
     using key_order = preserve_key_order;
 };
 
+struct hashed_order_policy : public sorted_policy
+{
+    using key_order = hash_key_order;
+};
+
+// Object member names are interned keys, see basic_key_pool
+template <class Policy = sorted_policy>
+struct interned_key_policy : public Policy
+{
+    template <class CharT, class CharTraits, class Allocator>
+    using key_storage = basic_interned_key<CharT, CharTraits, Allocator>;
+};
+
 template <class IteratorT, class ConstIteratorT>
 class range 
 {
@@ -337,7 +353,7 @@ public:
 
     using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type>;
 
-    using key_type = std::basic_string<char_type,char_traits_type,char_allocator_type>;
+    using key_type = typename implementation_policy::template key_storage<char_type,char_traits_type,char_allocator_type>;
 
 
     using reference = basic_json&;
@@ -404,6 +420,19 @@ private:
         }
     };  
 
+    class empty_array_storage final
+    {
+    public:
+        uint8_t storage_:4;
+        uint8_t length_:4;
+        semantic_tag tag_;
+
+        empty_array_storage(semantic_tag tag)
+            : storage_(static_cast<uint8_t>(storage_kind::empty_array_value)), length_(0), tag_(tag)
+        {
+        }
+    };  
+
     class bool_storage final
     {
     public:
@@ -722,29 +751,81 @@ private:
             }
         }
 
-        void destroy() noexcept
+        // An array whose container supports it is allocated together with room for its
+        // elements, see detail::buffered_container_node
+        using node_type = jsoncons::detail::buffered_container_node<array>;
+
+        void create_copy(const array& val, std::true_type)
+        {
+            ptr_ = node_type::create(val.get_allocator(), val.size(), val);
+        }
+
+        void create_copy(const array& val, std::false_type)
+        {
+            create(val.get_allocator(), val);
+        }
+
+        void create_copy(const array& val, const Allocator& a, std::true_type)
+        {
+            ptr_ = node_type::create(a, val.size(), val);
+        }
+
+        void create_copy(const array& val, const Allocator& a, std::false_type)
+        {
+            create(array_allocator(a), val, a);
+        }
+
+        void create_reserved(std::size_t capacity, const Allocator& a, std::true_type)
+        {
+            ptr_ = node_type::create(a, capacity);
+        }
+
+        void create_reserved(std::size_t capacity, const Allocator& a, std::false_type)
+        {
+            create(array_allocator(a), a);
+            ptr_->reserve(capacity);
+        }
+
+        void destroy(std::true_type) noexcept
+        {
+            node_type::destroy(ptr_);
+        }
+
+        void destroy(std::false_type) noexcept
         {
             array_allocator alloc(ptr_->get_allocator());
             std::allocator_traits<array_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
             std::allocator_traits<array_allocator>::deallocate(alloc, ptr_,1);
         }
+
+        void destroy() noexcept
+        {
+            destroy(typename array::has_element_buffer());
+        }
     public:
         array_storage(const array& val, semantic_tag tag)
             : storage_(static_cast<uint8_t>(storage_kind::array_value)), length_(0), tag_(tag)
         {
-            create(val.get_allocator(), val);
+            create_copy(val, typename array::has_element_buffer());
         }
 
         array_storage(const array& val, semantic_tag tag, const Allocator& a)
             : storage_(val.storage_), length_(0), tag_(tag)
         {
-            create(array_allocator(a), val, a);
+            create_copy(val, a, typename array::has_element_buffer());
+        }
+
+        // An empty array with room for capacity elements
+        array_storage(std::size_t capacity, semantic_tag tag, const Allocator& a)
+            : storage_(static_cast<uint8_t>(storage_kind::array_value)), length_(0), tag_(tag)
+        {
+            create_reserved(capacity, a, typename array::has_element_buffer());
         }
 
         array_storage(const array_storage& val)
             : storage_(val.storage_), length_(0), tag_(val.tag_)
         {
-            create(val.ptr_->get_allocator(), *(val.ptr_));
+            create_copy(*(val.ptr_), typename array::has_element_buffer());
         }
 
         array_storage(array_storage&& val) noexcept
@@ -757,7 +838,7 @@ private:
         array_storage(const array_storage& val, const Allocator& a)
             : storage_(val.storage_), length_(0), tag_(val.tag_)
         {
-            create(array_allocator(a), *(val.ptr_), a);
+            create_copy(*(val.ptr_), a, typename array::has_element_buffer());
         }
         ~array_storage() noexcept
         {
@@ -815,23 +896,81 @@ private:
                 JSONCONS_RETHROW;
             }
         }
+
+        // As for array_storage, with room for the members
+        using node_type = jsoncons::detail::buffered_container_node<object>;
+
+        void create_copy(const object& val, std::true_type)
+        {
+            ptr_ = node_type::create(val.get_allocator(), val.size(), val);
+        }
+
+        void create_copy(const object& val, std::false_type)
+        {
+            create(val.get_allocator(), val);
+        }
+
+        void create_copy(const object& val, const Allocator& a, std::true_type)
+        {
+            ptr_ = node_type::create(a, val.size(), val);
+        }
+
+        void create_copy(const object& val, const Allocator& a, std::false_type)
+        {
+            create(object_allocator(a), val, a);
+        }
+
+        void create_reserved(std::size_t capacity, const Allocator& a, std::true_type)
+        {
+            ptr_ = node_type::create(a, capacity);
+        }
+
+        void create_reserved(std::size_t capacity, const Allocator& a, std::false_type)
+        {
+            create(object_allocator(a), a);
+            ptr_->reserve(capacity);
+        }
+
+        void destroy(std::true_type) noexcept
+        {
+            node_type::destroy(ptr_);
+        }
+
+        void destroy(std::false_type) noexcept
+        {
+            object_allocator alloc(ptr_->get_allocator());
+            std::allocator_traits<object_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
+            std::allocator_traits<object_allocator>::deallocate(alloc, ptr_,1);
+        }
+
+        void destroy() noexcept
+        {
+            destroy(typename object::has_element_buffer());
+        }
     public:
         explicit object_storage(const object& val, semantic_tag tag)
             : storage_(static_cast<uint8_t>(storage_kind::object_value)), length_(0), tag_(tag)
         {
-            create(val.get_allocator(), val);
+            create_copy(val, typename object::has_element_buffer());
         }
 
         explicit object_storage(const object& val, semantic_tag tag, const Allocator& a)
             : storage_(val.storage_), length_(0), tag_(tag)
         {
-            create(object_allocator(a), val, a);
+            create_copy(val, a, typename object::has_element_buffer());
+        }
+
+        // An empty object with room for capacity members
+        explicit object_storage(std::size_t capacity, semantic_tag tag, const Allocator& a)
+            : storage_(static_cast<uint8_t>(storage_kind::object_value)), length_(0), tag_(tag)
+        {
+            create_reserved(capacity, a, typename object::has_element_buffer());
         }
 
         explicit object_storage(const object_storage& val)
             : storage_(val.storage_), length_(0), tag_(val.tag_)
         {
-            create(val.ptr_->get_allocator(), *(val.ptr_));
+            create_copy(*(val.ptr_), typename object::has_element_buffer());
         }
 
         explicit object_storage(object_storage&& val) noexcept
@@ -844,7 +983,7 @@ private:
         explicit object_storage(const object_storage& val, const Allocator& a)
             : storage_(val.storage_), length_(0), tag_(val.tag_)
         {
-            create(object_allocator(a), *(val.ptr_), a);
+            create_copy(*(val.ptr_), a, typename object::has_element_buffer());
         }
 
         ~object_storage() noexcept
@@ -874,14 +1013,6 @@ private:
         {
             return ptr_->get_allocator();
         }
-    private:
-
-        void destroy() noexcept
-        {
-            object_allocator alloc(ptr_->get_allocator());
-            std::allocator_traits<object_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
-            std::allocator_traits<object_allocator>::deallocate(alloc, ptr_,1);
-        }
     };
 
     class json_const_pointer_storage final
@@ -1892,9 +2023,32 @@ private:
         array_storage array_stor_;
         object_storage object_stor_;
         empty_object_storage empty_object_stor_;
+        empty_array_storage empty_array_stor_;
         json_const_pointer_storage json_const_pointer_stor_;
     };
 
+    void construct_empty_array(semantic_tag tag, std::true_type)
+    {
+        construct<empty_array_storage>(tag);
+    }
+
+    void construct_empty_array(semantic_tag tag, std::false_type)
+    {
+        construct<array_storage>(array(Allocator()), tag);
+    }
+
+    // Only stateless allocators have empty_array_storage
+    static const array& empty_array(std::true_type)
+    {
+        static const array a = array(Allocator());
+        return a;
+    }
+
+    static const array& empty_array(std::false_type)
+    {
+        JSONCONS_THROW(json_runtime_error<std::domain_error>("Bad array cast"));
+    }
+
     void Destroy_()
     {
         switch (storage())
@@ -1963,6 +2117,16 @@ private:
         return empty_object_stor_;
     }
 
+    empty_array_storage& cast(identity<empty_array_storage>) 
+    {
+        return empty_array_stor_;
+    }
+
+    const empty_array_storage& cast(identity<empty_array_storage>) const
+    {
+        return empty_array_stor_;
+    }
+
     bool_storage& cast(identity<bool_storage>) 
     {
         return bool_stor_;
@@ -2090,6 +2254,7 @@ private:
         {
             case storage_kind::null_value         : swap_a_b<TypeA, null_storage>(other); break;
             case storage_kind::empty_object_value : swap_a_b<TypeA, empty_object_storage>(other); break;
+            case storage_kind::empty_array_value  : swap_a_b<TypeA, empty_array_storage>(other); break;
             case storage_kind::bool_value         : swap_a_b<TypeA, bool_storage>(other); break;
             case storage_kind::int64_value      : swap_a_b<TypeA, int64_storage>(other); break;
             case storage_kind::uint64_value     : swap_a_b<TypeA, uint64_storage>(other); break;
@@ -2117,6 +2282,9 @@ private:
             case storage_kind::empty_object_value:
                 construct<empty_object_storage>(val.cast<empty_object_storage>());
                 break;
+            case storage_kind::empty_array_value:
+                construct<empty_array_storage>(val.cast<empty_array_storage>());
+                break;
             case storage_kind::bool_value:
                 construct<bool_storage>(val.cast<bool_storage>());
                 break;
@@ -2161,6 +2329,7 @@ private:
         {
             case storage_kind::null_value:
             case storage_kind::empty_object_value:
+            case storage_kind::empty_array_value:
             case storage_kind::bool_value:
             case storage_kind::int64_value:
             case storage_kind::uint64_value:
@@ -2193,6 +2362,7 @@ private:
         {
             case storage_kind::null_value:
             case storage_kind::empty_object_value:
+            case storage_kind::empty_array_value:
             case storage_kind::half_value:
             case storage_kind::double_value:
             case storage_kind::int64_value:
@@ -2228,6 +2398,7 @@ private:
         {
             case storage_kind::null_value:
             case storage_kind::empty_object_value:
+            case storage_kind::empty_array_value:
             case storage_kind::half_value:
             case storage_kind::double_value:
             case storage_kind::int64_value:
@@ -2366,6 +2537,7 @@ public:
                 return json_type::string_value;
             case storage_kind::byte_string_value:
                 return json_type::byte_string_value;
+            case storage_kind::empty_array_value:
             case storage_kind::array_value:
                 return json_type::array_value;
             case storage_kind::empty_object_value:
@@ -2400,6 +2572,7 @@ public:
         {
             case storage_kind::array_value:
                 return cast<array_storage>().value().size();
+            case storage_kind::empty_array_value:
             case storage_kind::empty_object_value:
                 return 0;
             case storage_kind::object_value:
@@ -2467,6 +2640,14 @@ public:
         }
     }
 
+    // Orders values of different storage kinds, an empty array sorts with arrays
+    int compare_storage_kind(const basic_json& rhs) const noexcept
+    {
+        storage_kind lhs_kind = storage() == storage_kind::empty_array_value ? storage_kind::array_value : storage();
+        storage_kind rhs_kind = rhs.storage() == storage_kind::empty_array_value ? storage_kind::array_value : rhs.storage();
+        return static_cast<int>(lhs_kind) - static_cast<int>(rhs_kind);
+    }
+
     int compare(const basic_json& rhs) const noexcept
     {
         if (this == &rhs)
@@ -2485,7 +2666,7 @@ public:
                 }
                 break;
             case storage_kind::null_value:
-                return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                return compare_storage_kind(rhs);
             case storage_kind::empty_object_value:
                 switch (rhs.storage())
                 {
@@ -2496,7 +2677,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::bool_value:
@@ -2507,7 +2688,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::int64_value:
@@ -2534,7 +2715,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::uint64_value:
@@ -2560,7 +2741,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::double_value:
@@ -2584,7 +2765,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::short_string_value:
@@ -2598,7 +2779,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::byte_string_value:
@@ -2611,12 +2792,27 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
+                }
+                break;
+            case storage_kind::empty_array_value:
+                switch (rhs.storage())
+                {
+                    case storage_kind::empty_array_value:
+                        return 0;
+                    case storage_kind::array_value:
+                        return rhs.empty() ? 0 : -1;
+                    case storage_kind::json_const_pointer:
+                        return compare(*(rhs.cast<json_const_pointer_storage>().value()));
+                    default:
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::array_value:
                 switch (rhs.storage())
                 {
+                    case storage_kind::empty_array_value:
+                        return empty() ? 0 : 1;
                     case storage_kind::array_value:
                     {
                         if (cast<array_storage>().value() == rhs.cast<array_storage>().value())
@@ -2627,7 +2823,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             case storage_kind::object_value:
@@ -2645,7 +2841,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return compare_storage_kind(rhs);
                 }
                 break;
             default:
@@ -2665,6 +2861,7 @@ public:
         {
             case storage_kind::null_value: swap_a<null_storage>(other); break;
             case storage_kind::empty_object_value : swap_a<empty_object_storage>(other); break;
+            case storage_kind::empty_array_value : swap_a<empty_array_storage>(other); break;
             case storage_kind::bool_value: swap_a<bool_storage>(other); break;
             case storage_kind::int64_value: swap_a<int64_storage>(other); break;
             case storage_kind::uint64_value: swap_a<uint64_storage>(other); break;
@@ -2907,8 +3104,14 @@ public:
     }
 
     explicit basic_json(json_array_arg_t, 
-                        semantic_tag tag = semantic_tag::none, 
-                        const Allocator& alloc = Allocator()) 
+                        semantic_tag tag = semantic_tag::none) 
+    {
+        construct_empty_array(tag, jsoncons::detail::is_stateless<Allocator>());
+    }
+
+    explicit basic_json(json_array_arg_t, 
+                        semantic_tag tag, 
+                        const Allocator& alloc) 
     {
         construct<array_storage>(array(alloc), tag);
     }
@@ -3616,6 +3819,7 @@ public:
     {
         switch (storage())
         {
+            case storage_kind::empty_array_value:
             case storage_kind::array_value:
                 return true;
             case storage_kind::json_const_pointer:
@@ -3715,6 +3919,7 @@ public:
                 return cast<long_string_storage>().length() == 0;
             case storage_kind::array_value:
                 return array_value().empty();
+            case storage_kind::empty_array_value:
             case storage_kind::empty_object_value:
                 return true;
             case storage_kind::object_value:
@@ -3757,21 +3962,39 @@ public:
         *this = basic_json(object(Allocator()), tag());
     }
 
+    template<class U=Allocator>
+    void create_array_implicitly()
+    {
+        create_array_implicitly(jsoncons::detail::is_stateless<U>());
+    }
+
+    void create_array_implicitly(std::false_type)
+    {
+        static_assert(std::true_type::value, "Cannot create array implicitly - alloc is stateful.");
+    }
+
+    void create_array_implicitly(std::true_type)
+    {
+        *this = basic_json(array(Allocator()), tag());
+    }
+
     void reserve(std::size_t n)
     {
         if (n > 0)
         {
             switch (storage())
             {
+                // The empty storages are trivially destructible, and are replaced by an
+                // array or object allocated with room for n elements
+                case storage_kind::empty_array_value:
+                    construct<array_storage>(n, tag(), Allocator());
+                    break;
                 case storage_kind::array_value:
                     array_value().reserve(n);
                     break;
                 case storage_kind::empty_object_value:
-                {
-                    create_object_implicitly();
-                    object_value().reserve(n);
-                }
-                break;
+                    construct<object_storage>(n, tag(), Allocator());
+                    break;
                 case storage_kind::object_value:
                 {
                     object_value().reserve(n);
@@ -3787,6 +4010,13 @@ public:
     {
         switch (storage())
         {
+            case storage_kind::empty_array_value:
+                if (n == 0)
+                {
+                    break;
+                }
+                create_array_implicitly();
+                JSONCONS_FALLTHROUGH;
             case storage_kind::array_value:
                 array_value().resize(n);
                 break;
@@ -3800,6 +4030,13 @@ public:
     {
         switch (storage())
         {
+            case storage_kind::empty_array_value:
+                if (n == 0)
+                {
+                    break;
+                }
+                create_array_implicitly();
+                JSONCONS_FALLTHROUGH;
             case storage_kind::array_value:
                 array_value().resize(n, val);
                 break;
@@ -4140,6 +4377,8 @@ public:
                     JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                 }
                 return array_value().operator[](i);
+            case storage_kind::empty_array_value:
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
             case storage_kind::object_value:
                 return object_value().at(i);
             default:
@@ -4157,6 +4396,8 @@ public:
                     JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                 }
                 return array_value().operator[](i);
+            case storage_kind::empty_array_value:
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
             case storage_kind::object_value:
                 return object_value().at(i);
             case storage_kind::json_const_pointer:
@@ -4329,6 +4570,8 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            break;
         case storage_kind::array_value:
             array_value().erase(pos);
             break;
@@ -4342,6 +4585,8 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            break;
         case storage_kind::array_value:
             array_value().erase(first, last);
             break;
@@ -4587,6 +4832,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             return array_value().insert(pos, std::forward<T>(val));
             break;
@@ -4602,6 +4850,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             return array_value().insert(pos, first, last);
             break;
@@ -4649,6 +4900,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             return array_value().emplace(pos, std::forward<Args>(args)...);
             break;
@@ -4664,6 +4918,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             return array_value().emplace_back(std::forward<Args>(args)...);
         default:
@@ -4683,6 +4940,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             array_value().push_back(std::forward<T>(val));
             break;
@@ -5326,6 +5586,8 @@ public:
     {
         switch (storage())
         {
+            case storage_kind::empty_array_value:
+                return range<array_iterator, const_array_iterator>(array_iterator(), array_iterator());
             case storage_kind::array_value:
                 return range<array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
             default:
@@ -5337,6 +5599,8 @@ public:
     {
         switch (storage())
         {
+            case storage_kind::empty_array_value:
+                return range<const_array_iterator, const_array_iterator>(const_array_iterator(), const_array_iterator());
             case storage_kind::array_value:
                 return range<const_array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
             case storage_kind::json_const_pointer:
@@ -5350,6 +5614,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::empty_array_value:
+            create_array_implicitly();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             return cast<array_storage>().value();
         default:
@@ -5362,6 +5629,8 @@ public:
     {
         switch (storage())
         {
+            case storage_kind::empty_array_value:
+                return empty_array(jsoncons::detail::is_stateless<Allocator>());
             case storage_kind::array_value:
                 return cast<array_storage>().value();
             case storage_kind::json_const_pointer:
@@ -5448,6 +5717,10 @@ private:
                 visitor.begin_object(0, tag(), context, ec);
                 visitor.end_object(context, ec);
                 break;
+            case storage_kind::empty_array_value:
+                visitor.begin_array(0, tag(), context, ec);
+                visitor.end_array(context, ec);
+                break;
             case storage_kind::object_value:
             {
                 bool more = visitor.begin_object(size(), tag(), context, ec);
@@ -5772,6 +6045,8 @@ using json = basic_json<char,sorted_policy,std::allocator<char>>;
 using wjson = basic_json<wchar_t,sorted_policy,std::allocator<char>>;
 using ojson = basic_json<char, preserve_order_policy, std::allocator<char>>;
 using wojson = basic_json<wchar_t, preserve_order_policy, std::allocator<char>>;
+using interned_json = basic_json<char, interned_key_policy<sorted_policy>, std::allocator<char>>;
+using interned_ojson = basic_json<char, interned_key_policy<preserve_order_policy>, std::allocator<char>>;
 
 #if !defined(JSONCONS_NO_DEPRECATED)
 JSONCONS_DEPRECATED_MSG("Instead, use wojson") typedef basic_json<wchar_t, preserve_order_policy, std::allocator<wchar_t>> owjson;
@@ -0,0 +1,783 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_BUFFERED_VECTOR_HPP
+#define JSONCONS_DETAIL_BUFFERED_VECTOR_HPP
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <memory> // std::allocator, std::allocator_traits, std::pointer_traits
+#include <iterator> // std::reverse_iterator, std::distance
+#include <initializer_list>
+#include <algorithm> // std::equal, std::lexicographical_compare, std::rotate, std::move
+#include <utility> // std::move, std::forward, std::move_if_noexcept
+#include <type_traits> // std::enable_if, std::aligned_storage, std::true_type
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <new> // placement new
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/more_type_traits.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Storage for the first elements of a buffered_vector, owned by whoever owns the vector
+    template <class T>
+    struct element_buffer
+    {
+        T* data;
+        std::size_t capacity;
+    };
+
+    // A sequence container with the interface of std::vector that can start out in an
+    // element_buffer, and moves its elements to the heap only when they outgrow it.
+    // json_array and json_object nodes are allocated with a buffer for their elements
+    // directly after them, so an array or object of known size costs one allocation.
+    template <class T, class Allocator = std::allocator<T>>
+    class buffered_vector
+    {
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using alloc_pointer = typename alloc_traits::pointer;
+
+        // An element constructed with the container's allocator outside the container,
+        // for arguments that may refer to the container's own elements
+        struct temporary_value
+        {
+            allocator_type& alloc_;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+
+            template <class... Args>
+            temporary_value(allocator_type& alloc, Args&&... args)
+                : alloc_(alloc)
+            {
+                alloc_traits::construct(alloc_, get(), std::forward<Args>(args)...);
+            }
+
+            temporary_value(const temporary_value&) = delete;
+            temporary_value& operator=(const temporary_value&) = delete;
+
+            ~temporary_value()
+            {
+                alloc_traits::destroy(alloc_, get());
+            }
+
+            T* get()
+            {
+                return reinterpret_cast<T*>(&storage_);
+            }
+        };
+
+        allocator_type alloc_;
+        T* data_;
+        size_type size_;
+        size_type capacity_;
+        T* buffer_;
+        size_type buffer_capacity_;
+    public:
+        buffered_vector()
+            : buffered_vector(Allocator())
+        {
+        }
+
+        explicit buffered_vector(const Allocator& alloc) noexcept
+            : alloc_(alloc), data_(nullptr), size_(0), capacity_(0), buffer_(nullptr), buffer_capacity_(0)
+        {
+        }
+
+        buffered_vector(element_buffer<T> buffer, const Allocator& alloc) noexcept
+            : alloc_(alloc), data_(buffer.data), size_(0), capacity_(buffer.capacity), 
+              buffer_(buffer.data), buffer_capacity_(buffer.capacity)
+        {
+        }
+
+        explicit buffered_vector(size_type n, const Allocator& alloc = Allocator())
+            : buffered_vector(alloc)
+        {
+            resize(n);
+        }
+
+        buffered_vector(size_type n, const T& value, const Allocator& alloc = Allocator())
+            : buffered_vector(alloc)
+        {
+            assign(n, value);
+        }
+
+        template <class InputIt,
+                  class = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        buffered_vector(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+            : buffered_vector(alloc)
+        {
+            assign(first, last);
+        }
+
+        buffered_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator())
+            : buffered_vector(alloc)
+        {
+            assign(init.begin(), init.end());
+        }
+
+        buffered_vector(const buffered_vector& other)
+            : buffered_vector(other, alloc_traits::select_on_container_copy_construction(other.alloc_))
+        {
+        }
+
+        buffered_vector(const buffered_vector& other, const Allocator& alloc)
+            : buffered_vector(alloc)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        buffered_vector(buffered_vector&& other)
+            : buffered_vector(other.alloc_)
+        {
+            take(other);
+        }
+
+        buffered_vector(buffered_vector&& other, const Allocator& alloc)
+            : buffered_vector(alloc)
+        {
+            if (alloc_ == other.alloc_)
+            {
+                take(other);
+            }
+            else
+            {
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
+        }
+
+        ~buffered_vector() noexcept
+        {
+            destroy_range(data_, data_ + size_);
+            free_heap();
+        }
+
+        buffered_vector& operator=(const buffered_vector& other)
+        {
+            if (this != &other)
+            {
+                if (alloc_traits::propagate_on_container_copy_assignment::value && !(alloc_ == other.alloc_))
+                {
+                    release();
+                }
+                assign_allocator(other.alloc_, typename alloc_traits::propagate_on_container_copy_assignment());
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        buffered_vector& operator=(buffered_vector&& other)
+        {
+            if (this != &other)
+            {
+                if (alloc_traits::propagate_on_container_move_assignment::value || alloc_ == other.alloc_)
+                {
+                    release();
+                    assign_allocator(other.alloc_, typename alloc_traits::propagate_on_container_move_assignment());
+                    take(other);
+                }
+                else
+                {
+                    assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                    other.clear();
+                }
+            }
+            return *this;
+        }
+
+        buffered_vector& operator=(std::initializer_list<T> init)
+        {
+            assign(init.begin(), init.end());
+            return *this;
+        }
+
+        void assign(size_type n, const T& value)
+        {
+            temporary_value temp(alloc_, value);
+            clear();
+            reserve(n);
+            for (size_type i = 0; i < n; ++i)
+            {
+                emplace_back(*temp.get());
+            }
+        }
+
+        template <class InputIt,
+                  class = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            reserve_for(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        void assign(std::initializer_list<T> init)
+        {
+            assign(init.begin(), init.end());
+        }
+
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
+
+        reference at(size_type pos)
+        {
+            if (pos >= size_)
+            {
+                JSONCONS_THROW(std::out_of_range("buffered_vector index out of range"));
+            }
+            return data_[pos];
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos >= size_)
+            {
+                JSONCONS_THROW(std::out_of_range("buffered_vector index out of range"));
+            }
+            return data_[pos];
+        }
+
+        reference operator[](size_type pos) {return data_[pos];}
+        const_reference operator[](size_type pos) const {return data_[pos];}
+
+        reference front() {return data_[0];}
+        const_reference front() const {return data_[0];}
+
+        reference back() {return data_[size_-1];}
+        const_reference back() const {return data_[size_-1];}
+
+        T* data() noexcept {return data_;}
+        const T* data() const noexcept {return data_;}
+
+        iterator begin() noexcept {return data_;}
+        iterator end() noexcept {return data_ + size_;}
+        const_iterator begin() const noexcept {return data_;}
+        const_iterator end() const noexcept {return data_ + size_;}
+        const_iterator cbegin() const noexcept {return data_;}
+        const_iterator cend() const noexcept {return data_ + size_;}
+
+        reverse_iterator rbegin() noexcept {return reverse_iterator(end());}
+        reverse_iterator rend() noexcept {return reverse_iterator(begin());}
+        const_reverse_iterator rbegin() const noexcept {return const_reverse_iterator(end());}
+        const_reverse_iterator rend() const noexcept {return const_reverse_iterator(begin());}
+        const_reverse_iterator crbegin() const noexcept {return const_reverse_iterator(end());}
+        const_reverse_iterator crend() const noexcept {return const_reverse_iterator(begin());}
+
+        bool empty() const noexcept {return size_ == 0;}
+
+        size_type size() const noexcept {return size_;}
+
+        size_type max_size() const noexcept {return alloc_traits::max_size(alloc_);}
+
+        size_type capacity() const noexcept {return capacity_;}
+
+        // The capacity of the element_buffer the container was constructed with, if any
+        size_type buffer_capacity() const noexcept {return buffer_capacity_;}
+
+        void reserve(size_type n)
+        {
+            if (n > capacity_)
+            {
+                if (n > max_size())
+                {
+                    JSONCONS_THROW(std::length_error("buffered_vector capacity exceeds max_size"));
+                }
+                reallocate(n);
+            }
+        }
+
+        void shrink_to_fit()
+        {
+            if (!is_buffered())
+            {
+                if (size_ <= buffer_capacity_)
+                {
+                    adopt(buffer_, buffer_capacity_);
+                }
+                else if (size_ < capacity_)
+                {
+                    reallocate(size_);
+                }
+            }
+        }
+
+        void clear() noexcept
+        {
+            destroy_range(data_, data_ + size_);
+            size_ = 0;
+        }
+
+        iterator insert(const_iterator pos, const T& value)
+        {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T&& value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        iterator insert(const_iterator pos, size_type n, const T& value)
+        {
+            size_type index = static_cast<size_type>(pos - data_);
+            temporary_value temp(alloc_, value);
+            size_type old_size = size_;
+            reserve(size_ + n);
+            for (size_type i = 0; i < n; ++i)
+            {
+                emplace_back(*temp.get());
+            }
+            std::rotate(data_ + index, data_ + old_size, data_ + size_);
+            return data_ + index;
+        }
+
+        template <class InputIt,
+                  class = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        iterator insert(const_iterator pos, InputIt first, InputIt last)
+        {
+            size_type index = static_cast<size_type>(pos - data_);
+            size_type old_size = size_;
+            reserve_for(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            std::rotate(data_ + index, data_ + old_size, data_ + size_);
+            return data_ + index;
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<T> init)
+        {
+            return insert(pos, init.begin(), init.end());
+        }
+
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            size_type index = static_cast<size_type>(pos - data_);
+            if (index == size_)
+            {
+                emplace_back(std::forward<Args>(args)...);
+            }
+            else
+            {
+                temporary_value temp(alloc_, std::forward<Args>(args)...);
+                if (size_ == capacity_)
+                {
+                    reallocate(next_capacity(size_ + 1));
+                }
+                alloc_traits::construct(alloc_, data_ + size_, std::move(data_[size_-1]));
+                ++size_;
+                std::move_backward(data_ + index, data_ + (size_ - 2), data_ + (size_ - 1));
+                data_[index] = std::move(*temp.get());
+            }
+            return data_ + index;
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            iterator it = data_ + (pos - data_);
+            std::move(it + 1, end(), it);
+            pop_back();
+            return it;
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            iterator it1 = data_ + (first - data_);
+            iterator it2 = data_ + (last - data_);
+            if (it1 != it2)
+            {
+                iterator new_end = std::move(it2, end(), it1);
+                destroy_range(new_end, end());
+                size_ = static_cast<size_type>(new_end - data_);
+            }
+            return it1;
+        }
+
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        template <class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (size_ < capacity_)
+            {
+                alloc_traits::construct(alloc_, data_ + size_, std::forward<Args>(args)...);
+                ++size_;
+            }
+            else
+            {
+                grow_emplace_back(std::forward<Args>(args)...);
+            }
+            return data_[size_-1];
+        }
+
+        void pop_back()
+        {
+            --size_;
+            alloc_traits::destroy(alloc_, data_ + size_);
+        }
+
+        void resize(size_type n)
+        {
+            if (n < size_)
+            {
+                destroy_range(data_ + n, data_ + size_);
+                size_ = n;
+            }
+            else
+            {
+                reserve(n);
+                while (size_ < n)
+                {
+                    emplace_back();
+                }
+            }
+        }
+
+        void resize(size_type n, const T& value)
+        {
+            if (n < size_)
+            {
+                destroy_range(data_ + n, data_ + size_);
+                size_ = n;
+            }
+            else if (n > size_)
+            {
+                temporary_value temp(alloc_, value);
+                reserve(n);
+                while (size_ < n)
+                {
+                    emplace_back(*temp.get());
+                }
+            }
+        }
+
+        void swap(buffered_vector& other)
+        {
+            if (this == &other)
+            {
+                return;
+            }
+            if (!is_buffered() && !other.is_buffered())
+            {
+                std::swap(data_, other.data_);
+                std::swap(size_, other.size_);
+                std::swap(capacity_, other.capacity_);
+                swap_allocator(other, typename alloc_traits::propagate_on_container_swap());
+            }
+            else
+            {
+                buffered_vector temp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(temp);
+            }
+        }
+
+        friend void swap(buffered_vector& lhs, buffered_vector& rhs)
+        {
+            lhs.swap(rhs);
+        }
+
+        friend bool operator==(const buffered_vector& lhs, const buffered_vector& rhs)
+        {
+            return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        friend bool operator!=(const buffered_vector& lhs, const buffered_vector& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const buffered_vector& lhs, const buffered_vector& rhs)
+        {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator<=(const buffered_vector& lhs, const buffered_vector& rhs)
+        {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>(const buffered_vector& lhs, const buffered_vector& rhs)
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator>=(const buffered_vector& lhs, const buffered_vector& rhs)
+        {
+            return !(lhs < rhs);
+        }
+    private:
+        // Whether the elements are in the element_buffer, or in no storage at all
+        bool is_buffered() const noexcept
+        {
+            return data_ == buffer_;
+        }
+
+        size_type next_capacity(size_type n) const
+        {
+            if (n > max_size())
+            {
+                JSONCONS_THROW(std::length_error("buffered_vector capacity exceeds max_size"));
+            }
+            return capacity_ > n/2 ? (capacity_ <= max_size()/2 ? capacity_*2 : max_size()) : n;
+        }
+
+        T* allocate(size_type n)
+        {
+            return to_plain_pointer(alloc_traits::allocate(alloc_, n));
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            alloc_traits::deallocate(alloc_, std::pointer_traits<alloc_pointer>::pointer_to(*p), n);
+        }
+
+        void free_heap() noexcept
+        {
+            if (!is_buffered())
+            {
+                deallocate(data_, capacity_);
+            }
+        }
+
+        void destroy_range(T* first, T* last) noexcept
+        {
+            for (; first != last; ++first)
+            {
+                alloc_traits::destroy(alloc_, first);
+            }
+        }
+
+        // Destroys the elements and returns to the element_buffer
+        void release() noexcept
+        {
+            destroy_range(data_, data_ + size_);
+            free_heap();
+            data_ = buffer_;
+            size_ = 0;
+            capacity_ = buffer_capacity_;
+        }
+
+        // Takes the elements of other, which has an equal allocator, leaving it empty.
+        // Elements in other's element_buffer are moved, since the buffer stays with other.
+        // Requires this container to be empty.
+        void take(buffered_vector& other)
+        {
+            if (other.is_buffered())
+            {
+                reserve(other.size_);
+                for (size_type i = 0; i < other.size_; ++i)
+                {
+                    alloc_traits::construct(alloc_, data_ + i, std::move(other.data_[i]));
+                    ++size_;
+                }
+                other.clear();
+            }
+            else
+            {
+                free_heap();
+                data_ = other.data_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+                other.data_ = other.buffer_;
+                other.size_ = 0;
+                other.capacity_ = other.buffer_capacity_;
+            }
+        }
+
+        // Moves the elements to storage p, which holds new_capacity elements, and takes
+        // ownership of it
+        void adopt(T* p, size_type new_capacity)
+        {
+            size_type i = 0;
+            JSONCONS_TRY
+            {
+                for (; i < size_; ++i)
+                {
+                    alloc_traits::construct(alloc_, p + i, std::move_if_noexcept(data_[i]));
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+                destroy_range(p, p + i);
+                JSONCONS_RETHROW;
+            }
+            destroy_range(data_, data_ + size_);
+            free_heap();
+            data_ = p;
+            capacity_ = new_capacity;
+        }
+
+        void reallocate(size_type new_capacity)
+        {
+            T* p = allocate(new_capacity);
+            JSONCONS_TRY
+            {
+                adopt(p, new_capacity);
+            }
+            JSONCONS_CATCH(...)
+            {
+                deallocate(p, new_capacity);
+                JSONCONS_RETHROW;
+            }
+        }
+
+        // The new element is constructed before the existing ones move, since args
+        // may refer to them
+        template <class... Args>
+        void grow_emplace_back(Args&&... args)
+        {
+            size_type new_capacity = next_capacity(size_ + 1);
+            T* p = allocate(new_capacity);
+            JSONCONS_TRY
+            {
+                alloc_traits::construct(alloc_, p + size_, std::forward<Args>(args)...);
+                JSONCONS_TRY
+                {
+                    adopt(p, new_capacity);
+                }
+                JSONCONS_CATCH(...)
+                {
+                    alloc_traits::destroy(alloc_, p + size_);
+                    JSONCONS_RETHROW;
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+                deallocate(p, new_capacity);
+                JSONCONS_RETHROW;
+            }
+            ++size_;
+        }
+
+        template <class InputIt>
+        void reserve_for(InputIt, InputIt, std::input_iterator_tag)
+        {
+        }
+
+        template <class ForwardIt>
+        void reserve_for(ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+        {
+            reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+        }
+
+        void assign_allocator(const allocator_type& alloc, std::true_type)
+        {
+            alloc_ = alloc;
+        }
+
+        void assign_allocator(const allocator_type&, std::false_type)
+        {
+        }
+
+        void swap_allocator(buffered_vector& other, std::true_type)
+        {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+
+        void swap_allocator(buffered_vector&, std::false_type)
+        {
+        }
+    };
+
+    template <class Container>
+    struct is_buffered_vector : std::false_type {};
+
+    template <class T, class Allocator>
+    struct is_buffered_vector<buffered_vector<T,Allocator>> : std::true_type {};
+
+    // Allocates a json_array or json_object together with an element_buffer for capacity
+    // elements directly after it. The block is allocated in units of the container's 
+    // alignment, so that an allocator that aligns by type aligns the container.
+    template <class Container>
+    class buffered_container_node
+    {
+        using allocator_type = typename Container::allocator_type;
+        using element_type = typename Container::buffer_element_type;
+        using unit_type = typename std::aligned_storage<alignof(Container), alignof(Container)>::type;
+        using unit_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<unit_type>;
+        using unit_pointer = typename std::allocator_traits<unit_allocator_type>::pointer;
+        using node_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<Container>;
+
+        static_assert(alignof(element_type) <= alignof(Container), "Elements must not need more alignment than their container");
+    public:
+        using pointer = typename std::allocator_traits<node_allocator_type>::pointer;
+
+        template <class... Args>
+        static pointer create(const allocator_type& alloc, std::size_t capacity, Args&&... args)
+        {
+            unit_allocator_type unit_alloc(alloc);
+            std::size_t n = node_size(capacity);
+            unit_pointer ptr = std::allocator_traits<unit_allocator_type>::allocate(unit_alloc, n);
+            char* storage = reinterpret_cast<char*>(to_plain_pointer(ptr));
+            element_buffer<element_type> buffer{reinterpret_cast<element_type*>(storage + header_size()), capacity};
+            Container* p = nullptr;
+            JSONCONS_TRY
+            {
+                p = ::new(storage) Container(buffer, std::forward<Args>(args)..., alloc);
+            }
+            JSONCONS_CATCH(...)
+            {
+                std::allocator_traits<unit_allocator_type>::deallocate(unit_alloc, ptr, n);
+                JSONCONS_RETHROW;
+            }
+            return std::pointer_traits<pointer>::pointer_to(*p);
+        }
+
+        static void destroy(pointer ptr) noexcept
+        {
+            Container* p = to_plain_pointer(ptr);
+            unit_allocator_type unit_alloc(p->get_allocator());
+            std::size_t n = node_size(p->buffer_capacity());
+            p->~Container();
+            unit_type* storage = reinterpret_cast<unit_type*>(p);
+            std::allocator_traits<unit_allocator_type>::deallocate(unit_alloc, std::pointer_traits<unit_pointer>::pointer_to(*storage), n);
+        }
+    private:
+        static constexpr std::size_t header_size()
+        {
+            return (sizeof(Container) + alignof(element_type) - 1)/alignof(element_type)*alignof(element_type);
+        }
+
+        static std::size_t node_size(std::size_t capacity)
+        {
+            return (header_size() + capacity*sizeof(element_type) + sizeof(unit_type) - 1)/sizeof(unit_type);
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,1088 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_JSON_SCANNER_HPP
+#define JSONCONS_DETAIL_JSON_SCANNER_HPP
+
+#include <memory> // std::allocator
+#include <string>
+#include <vector>
+#include <system_error>
+#include <functional> // std::function
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/ser_context.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Discards its input, for scanning without writing
+    template <class CharT>
+    class null_char_sink
+    {
+    public:
+        using value_type = CharT;
+
+        void flush()
+        {
+        }
+
+        void append(const CharT*, std::size_t)
+        {
+        }
+
+        void push_back(CharT)
+        {
+        }
+    };
+
+    // json_scanner checks that a complete JSON text is well formed, and optionally writes it to a sink
+    // without the whitespace and comments between tokens. Tokens are written as they appear in the input.
+    //
+    // It walks the structural index of basic_json_structural_parser, but only checks the grammar of numbers
+    // and literals, and only unescapes a string that has escapes, to validate its UTF-8. It stops at the first
+    // error, with the json_errc, line and column that basic_json_reader reports for the same input when its
+    // visitor never stops the parse. Comments are reported to the error handler as with basic_json_parser.
+
+    template <class CharT, class TempAllocator = std::allocator<char>>
+    class json_scanner : public ser_context
+    {
+    public:
+        using char_type = CharT;
+    private:
+        using temp_allocator_type = TempAllocator;
+        using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
+        using offset_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<std::size_t>;
+        using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<json_parse_state>;
+
+        static constexpr std::size_t block_size = 64;
+        static constexpr std::size_t window_blocks = 256;
+        static constexpr std::size_t index_capacity = (window_blocks + 1)*block_size;
+
+        const CharT* data_;
+        std::size_t length_;
+        int max_nesting_depth_;
+        std::function<bool(json_errc,const ser_context&)> err_handler_;
+        std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
+
+        jsoncons::detail::structural_indexer indexer_;
+        std::vector<std::size_t,offset_allocator_type> index_;
+        std::size_t index_size_;
+        std::size_t next_;
+        std::size_t indexed_;
+        bool tail_indexed_;
+
+        std::size_t pos_;
+        json_parse_state state_;
+        std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
+        int nesting_depth_;
+        bool more_;
+
+        std::size_t position_;
+        mutable std::size_t line_;
+        mutable std::size_t line_offset_;
+        mutable std::size_t mark_position_;
+
+        // Noncopyable and nonmoveable
+        json_scanner(const json_scanner&) = delete;
+        json_scanner& operator=(const json_scanner&) = delete;
+
+    public:
+        json_scanner(const CharT* data, std::size_t length,
+                     const basic_json_decode_options<CharT>& options,
+                     std::function<bool(json_errc,const ser_context&)> err_handler,
+                     const TempAllocator& alloc = TempAllocator())
+           : data_(data),
+             length_(length),
+             max_nesting_depth_(options.max_nesting_depth()),
+             err_handler_(err_handler),
+             string_buffer_(alloc),
+             index_(alloc),
+             index_size_(0),
+             next_(0),
+             indexed_(0),
+             tail_indexed_(false),
+             pos_(0),
+             state_(json_parse_state::start),
+             state_stack_(alloc),
+             nesting_depth_(0),
+             more_(true),
+             position_(0),
+             line_(1),
+             line_offset_(0),
+             mark_position_(0)
+        {
+            state_stack_.push_back(json_parse_state::root);
+        }
+
+        // Scans the text, writing its tokens to sink. On error, sink has the tokens before the error.
+        template <class Sink>
+        void scan(Sink& sink, std::error_code& ec)
+        {
+            // As basic_json_reader, skip a byte order mark and count positions from after it
+            auto result = unicons::skip_bom(data_, data_ + length_);
+            if (result.ec != unicons::encoding_errc())
+            {
+                ec = result.ec;
+                return;
+            }
+            length_ -= (result.it - data_);
+            data_ = result.it;
+
+            parse_tokens(sink, ec);
+            if (!ec)
+            {
+                check_done(ec);
+            }
+            sink.flush();
+        }
+
+        std::size_t line() const override
+        {
+            count_lines();
+            return line_;
+        }
+
+        std::size_t column() const override
+        {
+            count_lines();
+            return (position_ - mark_position_) + 1;
+        }
+
+        std::size_t position() const override
+        {
+            return position_;
+        }
+
+    private:
+
+        static bool is_whitespace(CharT c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        static bool is_delimiter(CharT c)
+        {
+            return is_whitespace(c) || c == ',' || c == '}' || c == ']' || c == '/';
+        }
+
+        static bool is_control_character(CharT c)
+        {
+            using uchar_type = typename std::make_unsigned<CharT>::type;
+            return static_cast<uchar_type>(c) < 0x20;
+        }
+
+        static bool is_digit(CharT c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        static bool is_hex_digit(CharT c)
+        {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        }
+
+        // Line breaks are counted when line() or column() is called
+        void count_lines() const
+        {
+            std::size_t end = position_ < length_ ? position_ : length_;
+            for (; line_offset_ < end; ++line_offset_)
+            {
+                switch (data_[line_offset_])
+                {
+                    case '\r':
+                        // basic_json_parser counts a carriage return when it reads the character after it
+                        if (line_offset_ + 1 == length_)
+                        {
+                            break;
+                        }
+                        ++line_;
+                        mark_position_ = line_offset_ + 1;
+                        if (data_[line_offset_ + 1] == '\n')
+                        {
+                            ++line_offset_;
+                        }
+                        break;
+                    case '\n':
+                        ++line_;
+                        mark_position_ = line_offset_ + 1;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        // As basic_json_parser, reports each extra character at the position of the first
+        void check_done(std::error_code& ec)
+        {
+            while (pos_ < length_ && is_whitespace(data_[pos_]))
+            {
+                ++pos_;
+            }
+            position_ = pos_;
+            for (; pos_ < length_; ++pos_)
+            {
+                if (!is_whitespace(data_[pos_]))
+                {
+                    more_ = err_handler_(json_errc::extra_character, *this);
+                    if (!more_)
+                    {
+                        ec = json_errc::extra_character;
+                        return;
+                    }
+                }
+            }
+        }
+
+        // Stage one
+
+        // Starts indexing again at offset, which must be outside of a string
+        void reset_index(std::size_t offset)
+        {
+            indexer_.reset();
+            indexed_ = offset;
+            tail_indexed_ = false;
+            index_size_ = 0;
+            next_ = 0;
+        }
+
+        // Indexes the next window of input, returns false if the input has all been indexed
+        bool fill_index()
+        {
+            if (index_.empty())
+            {
+                index_.resize(index_capacity);
+            }
+            index_size_ = 0;
+            next_ = 0;
+            while (index_size_ == 0)
+            {
+                if (length_ - indexed_ >= block_size)
+                {
+                    for (std::size_t i = 0; i < window_blocks && length_ - indexed_ >= block_size; ++i)
+                    {
+                        index_size_ += indexer_.index_block(data_ + indexed_, indexed_, index_.data() + index_size_);
+                        indexed_ += block_size;
+                    }
+                }
+                else if (indexed_ < length_ && !tail_indexed_)
+                {
+                    // The last partial block is indexed as if padded with spaces
+                    CharT block[block_size];
+                    std::size_t n = length_ - indexed_;
+                    std::char_traits<CharT>::copy(block, data_ + indexed_, n);
+                    std::char_traits<CharT>::assign(block + n, block_size - n, ' ');
+                    index_size_ += indexer_.index_block(block, indexed_, index_.data() + index_size_);
+                    indexed_ = length_;
+                    tail_indexed_ = true;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Stage two
+
+        template <class Sink>
+        void parse_tokens(Sink& sink, std::error_code& ec)
+        {
+            while (more_ && state_ != json_parse_state::before_done)
+            {
+                if (next_ == index_size_ && !fill_index())
+                {
+                    position_ = length_;
+                    pos_ = length_;
+                    report_error(json_errc::unexpected_eof, ec);
+                    return;
+                }
+                const std::size_t offset = index_[next_];
+                const CharT c = data_[offset];
+                position_ = offset;
+
+                if (c == '/')
+                {
+                    std::size_t end;
+                    if (skip_comment(offset, end, ec))
+                    {
+                        // Quotes in a comment throw the index out, start again after it
+                        pos_ = end;
+                        reset_index(end);
+                    }
+                }
+                else
+                {
+                    switch (state_)
+                    {
+                        case json_parse_state::start:
+                            switch (c)
+                            {
+                                case '{':
+                                    begin_object(sink, ec);
+                                    break;
+                                case '[':
+                                    begin_array(sink, ec);
+                                    break;
+                                case '}':
+                                    report_error(json_errc::unexpected_right_brace, ec);
+                                    break;
+                                case ']':
+                                    report_error(json_errc::unexpected_right_bracket, ec);
+                                    break;
+                                case '\"':case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':case 't':case 'f':case 'n':
+                                    parse_scalar(c, offset, false, sink, ec);
+                                    break;
+                                default:
+                                    report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::syntax_error, ec);
+                                    break;
+                            }
+                            break;
+                        case json_parse_state::expect_value:
+                        case json_parse_state::expect_value_or_end:
+                            switch (c)
+                            {
+                                case '{':
+                                    begin_object(sink, ec);
+                                    break;
+                                case '[':
+                                    begin_array(sink, ec);
+                                    break;
+                                case ']':
+                                    if (state_ == json_parse_state::expect_value_or_end)
+                                    {
+                                        end_array(sink, ec);
+                                    }
+                                    else
+                                    {
+                                        report_error(parent() == json_parse_state::array ? json_errc::extra_comma : json_errc::expected_value, ec);
+                                    }
+                                    break;
+                                case '\"':case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':case 't':case 'f':case 'n':
+                                    parse_scalar(c, offset, false, sink, ec);
+                                    break;
+                                case '\'':
+                                    report_error(json_errc::single_quote, ec);
+                                    break;
+                                default:
+                                    report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::expected_value, ec);
+                                    break;
+                            }
+                            break;
+                        case json_parse_state::expect_member_name_or_end:
+                        case json_parse_state::expect_member_name:
+                            switch (c)
+                            {
+                                case '\"':
+                                    parse_scalar(c, offset, true, sink, ec);
+                                    break;
+                                case '}':
+                                    if (state_ == json_parse_state::expect_member_name_or_end)
+                                    {
+                                        end_object(sink, ec);
+                                    }
+                                    else
+                                    {
+                                        report_error(json_errc::extra_comma, ec);
+                                    }
+                                    break;
+                                case '\'':
+                                    report_error(json_errc::single_quote, ec);
+                                    break;
+                                default:
+                                    report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::expected_key, ec);
+                                    break;
+                            }
+                            break;
+                        case json_parse_state::expect_colon:
+                            if (c == ':')
+                            {
+                                pos_ = offset + 1;
+                                ++next_;
+                                state_ = json_parse_state::expect_value;
+                                sink.push_back(':');
+                            }
+                            else
+                            {
+                                report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::expected_colon, ec);
+                            }
+                            break;
+                        case json_parse_state::expect_comma_or_end:
+                            switch (c)
+                            {
+                                case '}':
+                                    end_object(sink, ec);
+                                    break;
+                                case ']':
+                                    end_array(sink, ec);
+                                    break;
+                                case ',':
+                                    pos_ = offset + 1;
+                                    ++next_;
+                                    state_ = parent() == json_parse_state::object ? json_parse_state::expect_member_name : json_parse_state::expect_value;
+                                    sink.push_back(',');
+                                    break;
+                                default:
+                                    expected_comma_or_end(c, ec);
+                                    break;
+                            }
+                            break;
+                        default:
+                            JSONCONS_UNREACHABLE();
+                    }
+                }
+            }
+        }
+
+        json_parse_state parent() const
+        {
+            return state_stack_.back();
+        }
+
+        void report_error(json_errc code, std::error_code& ec)
+        {
+            err_handler_(code, *this);
+            ec = code;
+            more_ = false;
+        }
+
+        // A value or comment runs to the end of the input
+        void unexpected_eof(std::error_code& ec)
+        {
+            position_ = length_;
+            report_error(json_errc::unexpected_eof, ec);
+        }
+
+        void expected_comma_or_end(CharT c, std::error_code& ec)
+        {
+            if (is_control_character(c))
+            {
+                report_error(json_errc::illegal_control_character, ec);
+            }
+            else if (parent() == json_parse_state::array)
+            {
+                report_error(json_errc::expected_comma_or_right_bracket, ec);
+            }
+            else
+            {
+                report_error(json_errc::expected_comma_or_right_brace, ec);
+            }
+        }
+
+        // Reports the comment that starts at offset and finds its end as basic_json_parser does,
+        // returns false on error. Line breaks in the comment are counted here, as basic_json_parser
+        // counts them.
+        bool skip_comment(std::size_t offset, std::size_t& end, std::error_code& ec)
+        {
+            position_ = offset;
+            count_lines();
+
+            std::size_t p = offset + 1;
+            // A character that does not start a comment is skipped if the error handler returns true,
+            // and a line break among them is not counted
+            while (p < length_ && data_[p] != '*' && data_[p] != '/')
+            {
+                position_ = line_offset_ = p;
+                more_ = err_handler_(json_errc::syntax_error, *this);
+                if (!more_)
+                {
+                    ec = json_errc::syntax_error;
+                    return false;
+                }
+                ++p;
+            }
+            if (p == length_)
+            {
+                line_offset_ = p;
+                unexpected_eof(ec);
+                return false;
+            }
+            position_ = line_offset_ = p;
+            more_ = err_handler_(json_errc::illegal_comment, *this);
+            if (!more_)
+            {
+                ec = json_errc::illegal_comment;
+                return false;
+            }
+            if (data_[p] == '/')
+            {
+                // Ends before a line break, not at the end of the input
+                ++p;
+                while (p < length_ && data_[p] != '\n' && data_[p] != '\r')
+                {
+                    ++p;
+                }
+                end = p;
+            }
+            else
+            {
+                // Ends at a '/' after a '*', but the '*' of "**/" is taken by the '*' before it,
+                // and a line break right after a '*' is not counted
+                ++p;
+                bool star = false;
+                for (; p < length_; ++p)
+                {
+                    const CharT c = data_[p];
+                    if (star)
+                    {
+                        if (c == '/')
+                        {
+                            break;
+                        }
+                        star = false;
+                    }
+                    else if (c == '*')
+                    {
+                        star = true;
+                    }
+                    else if (c == '\n' || (c == '\r' && p + 1 < length_))
+                    {
+                        ++line_;
+                        mark_position_ = p + 1;
+                        if (c == '\r' && data_[p + 1] == '\n')
+                        {
+                            ++p;
+                        }
+                    }
+                }
+                line_offset_ = p;
+                end = p + 1;
+            }
+            if (p == length_)
+            {
+                unexpected_eof(ec);
+                return false;
+            }
+            return true;
+        }
+
+        template <class Sink>
+        void begin_object(Sink& sink, std::error_code& ec)
+        {
+            if (JSONCONS_UNLIKELY(++nesting_depth_ > max_nesting_depth_))
+            {
+                report_error(json_errc::max_nesting_depth_exceeded, ec);
+                return;
+            }
+            pos_ = position_ + 1;
+            ++next_;
+            state_stack_.push_back(json_parse_state::object);
+            state_ = json_parse_state::expect_member_name_or_end;
+            sink.push_back('{');
+        }
+
+        template <class Sink>
+        void begin_array(Sink& sink, std::error_code& ec)
+        {
+            if (JSONCONS_UNLIKELY(++nesting_depth_ > max_nesting_depth_))
+            {
+                report_error(json_errc::max_nesting_depth_exceeded, ec);
+                return;
+            }
+            pos_ = position_ + 1;
+            ++next_;
+            state_stack_.push_back(json_parse_state::array);
+            state_ = json_parse_state::expect_value_or_end;
+            sink.push_back('[');
+        }
+
+        template <class Sink>
+        void end_object(Sink& sink, std::error_code& ec)
+        {
+            if (parent() == json_parse_state::array)
+            {
+                report_error(json_errc::expected_comma_or_right_bracket, ec);
+                return;
+            }
+            pos_ = position_ + 1;
+            ++next_;
+            --nesting_depth_;
+            state_stack_.pop_back();
+            sink.push_back('}');
+            after_value(sink);
+        }
+
+        template <class Sink>
+        void end_array(Sink& sink, std::error_code& ec)
+        {
+            if (parent() == json_parse_state::object)
+            {
+                report_error(json_errc::expected_comma_or_right_brace, ec);
+                return;
+            }
+            pos_ = position_ + 1;
+            ++next_;
+            --nesting_depth_;
+            state_stack_.pop_back();
+            sink.push_back(']');
+            after_value(sink);
+        }
+
+        // Takes a ',' that follows the value here, rather than in another pass through parse_tokens
+        template <class Sink>
+        void after_value(Sink& sink)
+        {
+            switch (parent())
+            {
+                case json_parse_state::root:
+                    state_ = json_parse_state::before_done;
+                    break;
+                case json_parse_state::object:
+                    if (next_ < index_size_ && data_[index_[next_]] == ',')
+                    {
+                        pos_ = index_[next_++] + 1;
+                        state_ = json_parse_state::expect_member_name;
+                        sink.push_back(',');
+                    }
+                    else
+                    {
+                        state_ = json_parse_state::expect_comma_or_end;
+                    }
+                    break;
+                default:
+                    if (next_ < index_size_ && data_[index_[next_]] == ',')
+                    {
+                        pos_ = index_[next_++] + 1;
+                        state_ = json_parse_state::expect_value;
+                        sink.push_back(',');
+                    }
+                    else
+                    {
+                        state_ = json_parse_state::expect_comma_or_end;
+                    }
+                    break;
+            }
+        }
+
+        // Checks the string, number or literal that starts at offset
+        template <class Sink>
+        void parse_scalar(CharT c, std::size_t offset, bool is_key, Sink& sink, std::error_code& ec)
+        {
+            ++next_;
+            switch (c)
+            {
+                case '\"':
+                    parse_string(offset, is_key, sink, ec);
+                    break;
+                case 't':
+                    parse_literal(offset, "true", sink, ec);
+                    break;
+                case 'f':
+                    parse_literal(offset, "false", sink, ec);
+                    break;
+                case 'n':
+                    parse_literal(offset, "null", sink, ec);
+                    break;
+                default:
+                    parse_number(offset, sink, ec);
+                    if (!ec && state_ == json_parse_state::before_done && pos_ < length_)
+                    {
+                        after_root_number(ec);
+                    }
+                    break;
+            }
+        }
+
+        // basic_json_parser ends a number at the root on the character after it. It takes a ',',
+        // reads one comment after a '/', and rejects a '}' or ']' as closing the root. What
+        // follows is left to check_done.
+        void after_root_number(std::error_code& ec)
+        {
+            switch (data_[pos_])
+            {
+                case ',':
+                    ++pos_;
+                    break;
+                case '/':
+                {
+                    std::size_t end;
+                    if (skip_comment(pos_, end, ec))
+                    {
+                        pos_ = end;
+                    }
+                    break;
+                }
+                case '}':
+                    position_ = pos_;
+                    report_error(json_errc::unexpected_right_brace, ec);
+                    break;
+                case ']':
+                    position_ = pos_;
+                    report_error(json_errc::unexpected_right_bracket, ec);
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        template <class Sink>
+        void parse_literal(std::size_t offset, const char* literal, Sink& sink, std::error_code& ec)
+        {
+            std::size_t i = 1;
+            for (; literal[i] != 0; ++i)
+            {
+                if (offset + i >= length_)
+                {
+                    unexpected_eof(ec);
+                    return;
+                }
+                if (data_[offset + i] != literal[i])
+                {
+                    // basic_json_parser matches a literal as a whole when it is all in the input, otherwise character by character
+                    position_ = offset + std::char_traits<char>::length(literal) <= length_ ? offset : offset + i;
+                    report_error(json_errc::invalid_value, ec);
+                    return;
+                }
+            }
+            pos_ = offset + i;
+
+            // In a container, a literal must be followed by a delimiter. At the root, anything
+            // that follows is left to check_done.
+            if (pos_ == length_ || parent() == json_parse_state::root || is_delimiter(data_[pos_]))
+            {
+                sink.append(data_ + offset, i);
+                after_value(sink);
+            }
+            else
+            {
+                position_ = pos_;
+                expected_comma_or_end(data_[pos_], ec);
+            }
+        }
+
+        template <class Sink>
+        void parse_number(std::size_t offset, Sink& sink, std::error_code& ec)
+        {
+            const CharT* first = data_ + offset;
+            const CharT* last = data_ + length_;
+            const CharT* p = first;
+
+            if (*p == '-')
+            {
+                ++p;
+                if (p == last)
+                {
+                    unexpected_eof(ec);
+                    return;
+                }
+                if (!is_digit(*p))
+                {
+                    position_ = p - data_;
+                    err_handler_(json_errc::invalid_number, *this);
+                    ec = json_errc::expected_value;
+                    more_ = false;
+                    return;
+                }
+            }
+            if (*p == '0')
+            {
+                ++p;
+                if (p != last && is_digit(*p))
+                {
+                    position_ = p - data_;
+                    report_error(json_errc::leading_zero, ec);
+                    return;
+                }
+            }
+            else
+            {
+                while (p != last && is_digit(*p))
+                {
+                    ++p;
+                }
+            }
+            if (p != last && *p == '.')
+            {
+                ++p;
+                if (p == last)
+                {
+                    unexpected_eof(ec);
+                    return;
+                }
+                if (!is_digit(*p))
+                {
+                    position_ = p - data_;
+                    report_error(json_errc::invalid_number, ec);
+                    return;
+                }
+                while (p != last && is_digit(*p))
+                {
+                    ++p;
+                }
+            }
+            if (p != last && (*p == 'e' || *p == 'E'))
+            {
+                ++p;
+                if (p != last && (*p == '+' || *p == '-'))
+                {
+                    ++p;
+                }
+                if (p == last)
+                {
+                    unexpected_eof(ec);
+                    return;
+                }
+                if (!is_digit(*p))
+                {
+                    position_ = p - data_;
+                    err_handler_(json_errc::invalid_number, *this);
+                    ec = json_errc::expected_value;
+                    more_ = false;
+                    return;
+                }
+                while (p != last && is_digit(*p))
+                {
+                    ++p;
+                }
+            }
+            if (p != last && !is_delimiter(*p))
+            {
+                position_ = p - data_;
+                report_error(json_errc::invalid_number, ec);
+                return;
+            }
+            pos_ = p - data_;
+            sink.append(first, p - first);
+            after_value(sink);
+        }
+
+        template <class Sink>
+        void parse_string(std::size_t offset, bool is_key, Sink& sink, std::error_code& ec)
+        {
+            const CharT* last = data_ + length_;
+            const CharT* sb = data_ + offset + 1;
+            const CharT* p = sb;
+            bool unescaped = false;
+
+            for (;;)
+            {
+                p = jsoncons::detail::find_string_delimiter(p, last);
+                if (p == last)
+                {
+                    position_ = length_ + 1;
+                    report_error(json_errc::unexpected_eof, ec);
+                    return;
+                }
+                if (*p == '\"')
+                {
+                    break;
+                }
+                if (*p == '\\')
+                {
+                    // A string with escapes is unescaped to validate it as basic_json_parser does
+                    if (!unescaped)
+                    {
+                        string_buffer_.clear();
+                        unescaped = true;
+                    }
+                    string_buffer_.append(sb, p - sb);
+                    p = unescape(p + 1, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    sb = p;
+                    continue;
+                }
+                // Reported where basic_json_parser reports them, after the character: after a line feed 
+                // on the next line, after a carriage return on the same line
+                position_ = p - data_;
+                switch (*p)
+                {
+                    case '\r':
+                        count_lines();
+                        ++line_offset_;
+                        ++position_;
+                        report_error(json_errc::illegal_character_in_string, ec);
+                        break;
+                    case '\n':
+                    case '\t':
+                        ++position_;
+                        report_error(json_errc::illegal_character_in_string, ec);
+                        break;
+                    default:
+                        ++position_;
+                        report_error(json_errc::illegal_control_character, ec);
+                        break;
+                }
+                return;
+            }
+
+            const CharT* s;
+            std::size_t length;
+            if (unescaped)
+            {
+                string_buffer_.append(sb, p - sb);
+                s = string_buffer_.data();
+                length = string_buffer_.length();
+            }
+            else
+            {
+                s = sb;
+                length = p - sb;
+            }
+
+            // ASCII is always well formed, only validate from the first non-ASCII character
+            auto result = unicons::validate(jsoncons::detail::skip_ascii(s, s + length), s + length);
+            if (result.ec != unicons::conv_errc())
+            {
+                // basic_json_parser calls the error handler at the start of the text that follows the
+                // last escape, and then counts from there, which may be past the string, but on the
+                // line that the string ends
+                position_ = p - data_;
+                count_lines();
+                position_ = sb - data_;
+                report_error(translate_conv_errc(result.ec), ec);
+                position_ = (sb - data_) + (result.it - s);
+                if (line_offset_ < position_)
+                {
+                    line_offset_ = position_;
+                }
+                return;
+            }
+            pos_ = (p - data_) + 1;
+            sink.append(data_ + offset, pos_ - offset);
+
+            if (is_key)
+            {
+                if (next_ < index_size_ && data_[index_[next_]] == ':')
+                {
+                    pos_ = index_[next_++] + 1;
+                    state_ = json_parse_state::expect_value;
+                    sink.push_back(':');
+                }
+                else
+                {
+                    state_ = json_parse_state::expect_colon;
+                }
+            }
+            else
+            {
+                after_value(sink);
+            }
+        }
+
+        // Appends the character for the escape sequence that starts at p to string_buffer_,
+        // returns a pointer past the sequence
+        const CharT* unescape(const CharT* p, std::error_code& ec)
+        {
+            const CharT* last = data_ + length_;
+            if (p == last)
+            {
+                unexpected_eof(ec);
+                return p;
+            }
+            switch (*p)
+            {
+                case '\"':
+                case '\\':
+                case '/':
+                    string_buffer_.push_back(*p);
+                    return p + 1;
+                case 'b':
+                    string_buffer_.push_back('\b');
+                    return p + 1;
+                case 'f':
+                    string_buffer_.push_back('\f');
+                    return p + 1;
+                case 'n':
+                    string_buffer_.push_back('\n');
+                    return p + 1;
+                case 'r':
+                    string_buffer_.push_back('\r');
+                    return p + 1;
+                case 't':
+                    string_buffer_.push_back('\t');
+                    return p + 1;
+                case 'u':
+                {
+                    uint32_t cp = 0;
+                    p = read_codepoint(p + 1, cp, ec);
+                    if (ec)
+                    {
+                        return p;
+                    }
+                    if (unicons::is_high_surrogate(cp))
+                    {
+                        if (p == last || (*p == '\\' && p + 1 == last))
+                        {
+                            unexpected_eof(ec);
+                            return p;
+                        }
+                        if (*p != '\\' || *(p + 1) != 'u')
+                        {
+                            position_ = (p - data_) + (*p == '\\' ? 1 : 0);
+                            report_error(json_errc::expected_codepoint_surrogate_pair, ec);
+                            return p;
+                        }
+                        uint32_t cp2 = 0;
+                        p = read_codepoint(p + 2, cp2, ec);
+                        if (ec)
+                        {
+                            return p;
+                        }
+                        cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                    }
+                    unicons::convert(&cp, &cp + 1, std::back_inserter(string_buffer_));
+                    return p;
+                }
+                default:
+                    position_ = p - data_;
+                    report_error(json_errc::illegal_escaped_character, ec);
+                    return p;
+            }
+        }
+
+        const CharT* read_codepoint(const CharT* p, uint32_t& cp, std::error_code& ec)
+        {
+            const CharT* last = data_ + length_;
+            for (int i = 0; i < 4; ++i, ++p)
+            {
+                if (p == last)
+                {
+                    unexpected_eof(ec);
+                    return p;
+                }
+                CharT c = *p;
+                if (!is_hex_digit(c))
+                {
+                    position_ = p - data_;
+                    report_error(json_errc::invalid_unicode_escape_sequence, ec);
+                    return p;
+                }
+                cp = cp*16 + (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+            }
+            return p;
+        }
+
+        static json_errc translate_conv_errc(unicons::conv_errc result)
+        {
+            switch (result)
+            {
+                case unicons::conv_errc::over_long_utf8_sequence:
+                    return json_errc::over_long_utf8_sequence;
+                case unicons::conv_errc::unpaired_high_surrogate:
+                    return json_errc::unpaired_high_surrogate;
+                case unicons::conv_errc::expected_continuation_byte:
+                    return json_errc::expected_continuation_byte;
+                case unicons::conv_errc::illegal_surrogate_value:
+                    return json_errc::illegal_surrogate_value;
+                default:
+                    return json_errc::illegal_codepoint;
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
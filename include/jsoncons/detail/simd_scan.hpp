@@ -0,0 +1,852 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_SCAN_HPP
+#define JSONCONS_DETAIL_SIMD_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+// Define JSONCONS_NO_SIMD to force the scalar kernels
+
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_HAS_SSE2 1
+#  endif
+#  if defined(JSONCONS_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#    if defined(__AVX2__)
+#      define JSONCONS_HAS_AVX2 1
+#    elif (defined(__clang__) && __clang_major__ >= 4) || (!defined(__clang__) && __GNUC__ >= 5)
+#      define JSONCONS_HAS_AVX2_DISPATCH 1
+#    endif
+#  endif
+#endif
+
+#if defined(JSONCONS_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace jsoncons {
+namespace detail {
+
+    // Scalar kernels, used for wide characters, short runs and the tail of a buffer
+
+    template <class CharT>
+    bool is_string_delimiter(CharT c)
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        return c == '\"' || c == '\\' || static_cast<uchar_type>(c) < 0x20;
+    }
+
+    template <class CharT>
+    const CharT* scalar_find_string_delimiter(const CharT* first, const CharT* last)
+    {
+        while (first != last && !is_string_delimiter(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT>
+    const CharT* scalar_skip_blanks(const CharT* first, const CharT* last)
+    {
+        while (first != last && (*first == ' ' || *first == '\t'))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT>
+    const CharT* scalar_skip_ascii(const CharT* first, const CharT* last)
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        while (first != last && static_cast<uchar_type>(*first) < 0x80)
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // A character that escape_string must escape: '"', '\\', a control character, 
+    // '/' if escape_solidus, or a non-ASCII character if escape_all_non_ascii 
+    template <class CharT>
+    bool is_escape_character(CharT c, bool escape_all_non_ascii, bool escape_solidus)
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        uchar_type u = static_cast<uchar_type>(c);
+        return c == '\"' || c == '\\' || u < 0x20 || u == 0x7f || (escape_solidus && c == '/') 
+            || (escape_all_non_ascii && u >= 0x80);
+    }
+
+    template <class CharT>
+    const CharT* scalar_find_escape_character(const CharT* first, const CharT* last, 
+                                              bool escape_all_non_ascii, bool escape_solidus)
+    {
+        while (first != last && !is_escape_character(*first, escape_all_non_ascii, escape_solidus))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    inline
+    unsigned count_trailing_zeros64(uint64_t mask)
+    {
+    #if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+    #elif defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        if (_BitScanForward(&index, static_cast<uint32_t>(mask)))
+        {
+            return static_cast<unsigned>(index);
+        }
+        _BitScanForward(&index, static_cast<uint32_t>(mask >> 32));
+        return static_cast<unsigned>(index) + 32;
+    #else
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+    #endif
+    }
+
+#if defined(JSONCONS_HAS_SSE2)
+
+    inline
+    unsigned count_trailing_zeros(uint32_t mask)
+    {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+    #else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+    #endif
+    }
+
+    // Returns a pointer to the first '"', '\\' or control character in [first,last), 16 bytes at a time
+    inline
+    const char* sse2_find_string_delimiter(const char* first, const char* last)
+    {
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i max_control = _mm_set1_epi8(0x1f);
+
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash));
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_min_epu8(v, max_control), v));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+        return scalar_find_string_delimiter(first, last);
+    }
+
+    // Returns a pointer to the first character in [first,last) that is not a space or tab, 16 bytes at a time
+    inline
+    const char* sse2_skip_blanks(const char* first, const char* last)
+    {
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab));
+            uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(m)) & 0xffff;
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+        return scalar_skip_blanks(first, last);
+    }
+
+    // Returns a pointer to the first character in [first,last) with the high bit set, 16 bytes at a time
+    inline
+    const char* sse2_skip_ascii(const char* first, const char* last)
+    {
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+        return scalar_skip_ascii(first, last);
+    }
+
+    // Returns a pointer to the first character in [first,last) that must be escaped, 16 bytes at a time.
+    // When '/' is not escaped its comparand is '"', which is matched anyway.
+    inline
+    const char* sse2_find_escape_character(const char* first, const char* last, 
+                                           bool escape_all_non_ascii, bool escape_solidus)
+    {
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i max_control = _mm_set1_epi8(0x1f);
+        const __m128i del = _mm_set1_epi8(0x7f);
+        const __m128i solidus = _mm_set1_epi8(escape_solidus ? '/' : '\"');
+        const uint32_t non_ascii_mask = escape_all_non_ascii ? 0xffff : 0;
+
+        while (last - first >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash));
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(_mm_min_epu8(v, max_control), v));
+            m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, del), _mm_cmpeq_epi8(v, solidus)));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m)) 
+                | (static_cast<uint32_t>(_mm_movemask_epi8(v)) & non_ascii_mask);
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 16;
+        }
+        return scalar_find_escape_character(first, last, escape_all_non_ascii, escape_solidus);
+    }
+
+#endif // defined(JSONCONS_HAS_SSE2)
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+#if defined(JSONCONS_HAS_AVX2_DISPATCH)
+#define JSONCONS_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define JSONCONS_AVX2_TARGET
+#endif
+
+    JSONCONS_AVX2_TARGET inline
+    const char* avx2_find_string_delimiter(const char* first, const char* last)
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i max_control = _mm256_set1_epi8(0x1f);
+
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash));
+            m = _mm256_or_si256(m, _mm256_cmpeq_epi8(_mm256_min_epu8(v, max_control), v));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return sse2_find_string_delimiter(first, last);
+    }
+
+    JSONCONS_AVX2_TARGET inline
+    const char* avx2_skip_blanks(const char* first, const char* last)
+    {
+        const __m256i space = _mm256_set1_epi8(' ');
+        const __m256i tab = _mm256_set1_epi8('\t');
+
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab));
+            uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(m));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return sse2_skip_blanks(first, last);
+    }
+
+    JSONCONS_AVX2_TARGET inline
+    const char* avx2_skip_ascii(const char* first, const char* last)
+    {
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return sse2_skip_ascii(first, last);
+    }
+
+    JSONCONS_AVX2_TARGET inline
+    const char* avx2_find_escape_character(const char* first, const char* last, 
+                                           bool escape_all_non_ascii, bool escape_solidus)
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i max_control = _mm256_set1_epi8(0x1f);
+        const __m256i del = _mm256_set1_epi8(0x7f);
+        const __m256i solidus = _mm256_set1_epi8(escape_solidus ? '/' : '\"');
+        const uint32_t non_ascii_mask = escape_all_non_ascii ? 0xffffffff : 0;
+
+        while (last - first >= 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash));
+            m = _mm256_or_si256(m, _mm256_cmpeq_epi8(_mm256_min_epu8(v, max_control), v));
+            m = _mm256_or_si256(m, _mm256_or_si256(_mm256_cmpeq_epi8(v, del), _mm256_cmpeq_epi8(v, solidus)));
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(m)) 
+                | (static_cast<uint32_t>(_mm256_movemask_epi8(v)) & non_ascii_mask);
+            if (mask != 0)
+            {
+                return first + count_trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return sse2_find_escape_character(first, last, escape_all_non_ascii, escape_solidus);
+    }
+
+#undef JSONCONS_AVX2_TARGET
+
+    inline
+    bool has_avx2()
+    {
+    #if defined(JSONCONS_HAS_AVX2)
+        return true;
+    #else
+        static const bool value = __builtin_cpu_supports("avx2") != 0;
+        return value;
+    #endif
+    }
+
+#endif // defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    // Stage one of the structural parser: classify 64 characters at a time and record the
+    // offsets of structural characters, opening quotes and the first character of each scalar.
+    // A '/' is recorded as a structural character, it may start a comment.
+
+    struct structural_block
+    {
+        uint64_t quote;
+        uint64_t backslash;
+        uint64_t whitespace;
+        uint64_t op;
+        uint64_t control;
+        uint64_t non_ascii;
+    };
+
+    template <class CharT>
+    void scalar_classify_block(const CharT* p, structural_block& block)
+    {
+        block = structural_block();
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            uint64_t bit = uint64_t(1) << i;
+            switch (p[i])
+            {
+                case '\"':
+                    block.quote |= bit;
+                    break;
+                case '\\':
+                    block.backslash |= bit;
+                    break;
+                case ' ':case '\t':case '\n':case '\r':
+                    block.whitespace |= bit;
+                    break;
+                case '{':case '}':case '[':case ']':case ':':case ',':case '/':
+                    block.op |= bit;
+                    break;
+                default:
+                    break;
+            }
+            if (static_cast<typename std::make_unsigned<CharT>::type>(p[i]) < 0x20)
+            {
+                block.control |= bit;
+            }
+            else if (static_cast<typename std::make_unsigned<CharT>::type>(p[i]) > 0x7f)
+            {
+                block.non_ascii |= bit;
+            }
+        }
+    }
+
+#if defined(JSONCONS_HAS_SSE2)
+
+    inline
+    uint64_t sse2_match(__m128i v, char c)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)))));
+    }
+
+    inline
+    void sse2_classify_block(const char* p, structural_block& block)
+    {
+        block = structural_block();
+        for (unsigned i = 0; i < 4; ++i)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            unsigned shift = 16*i;
+            block.quote |= sse2_match(v, '\"') << shift;
+            block.backslash |= sse2_match(v, '\\') << shift;
+            block.whitespace |= (sse2_match(v, ' ') | sse2_match(v, '\t') | sse2_match(v, '\n') | sse2_match(v, '\r')) << shift;
+            // '{' '}' differ from '[' ']' only in bit 0x20
+            __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+            block.op |= (sse2_match(folded, '{') | sse2_match(folded, '}') | sse2_match(v, ':')
+                         | sse2_match(v, ',') | sse2_match(v, '/')) << shift;
+            __m128i max_control = _mm_set1_epi8(0x1f);
+            block.control |= static_cast<uint64_t>(static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, max_control), v)))) << shift;
+            block.non_ascii |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(v))) << shift;
+        }
+    }
+
+#endif // defined(JSONCONS_HAS_SSE2)
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+#if defined(JSONCONS_HAS_AVX2_DISPATCH)
+#define JSONCONS_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define JSONCONS_AVX2_TARGET
+#endif
+
+    JSONCONS_AVX2_TARGET inline
+    uint64_t avx2_mask(__m256i m)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(m)));
+    }
+
+    JSONCONS_AVX2_TARGET inline
+    void avx2_classify_block(const char* p, structural_block& block)
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i space = _mm256_set1_epi8(' ');
+        const __m256i tab = _mm256_set1_epi8('\t');
+        const __m256i lf = _mm256_set1_epi8('\n');
+        const __m256i cr = _mm256_set1_epi8('\r');
+        const __m256i case_bit = _mm256_set1_epi8(0x20);
+        const __m256i left_brace = _mm256_set1_epi8('{');
+        const __m256i right_brace = _mm256_set1_epi8('}');
+        const __m256i colon = _mm256_set1_epi8(':');
+        const __m256i comma = _mm256_set1_epi8(',');
+        const __m256i slash = _mm256_set1_epi8('/');
+        const __m256i max_control = _mm256_set1_epi8(0x1f);
+
+        block = structural_block();
+        for (unsigned i = 0; i < 2; ++i)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32*i));
+            unsigned shift = 32*i;
+            block.quote |= avx2_mask(_mm256_cmpeq_epi8(v, quote)) << shift;
+            block.backslash |= avx2_mask(_mm256_cmpeq_epi8(v, backslash)) << shift;
+            __m256i ws = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+                                         _mm256_or_si256(_mm256_cmpeq_epi8(v, lf), _mm256_cmpeq_epi8(v, cr)));
+            block.whitespace |= avx2_mask(ws) << shift;
+            // '{' '}' differ from '[' ']' only in bit 0x20
+            __m256i folded = _mm256_or_si256(v, case_bit);
+            __m256i op = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(folded, left_brace), _mm256_cmpeq_epi8(folded, right_brace)),
+                                         _mm256_or_si256(_mm256_cmpeq_epi8(v, colon), _mm256_cmpeq_epi8(v, comma)));
+            op = _mm256_or_si256(op, _mm256_cmpeq_epi8(v, slash));
+            block.op |= avx2_mask(op) << shift;
+            block.control |= avx2_mask(_mm256_cmpeq_epi8(_mm256_min_epu8(v, max_control), v)) << shift;
+            block.non_ascii |= avx2_mask(v) << shift;
+        }
+    }
+
+#undef JSONCONS_AVX2_TARGET
+
+#endif // defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char)>::type
+    classify_block(const CharT* p, structural_block& block)
+    {
+        scalar_classify_block(p, block);
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char)>::type
+    classify_block(const CharT* p, structural_block& block)
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (has_avx2())
+        {
+            avx2_classify_block(reinterpret_cast<const char*>(p), block);
+            return;
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        sse2_classify_block(reinterpret_cast<const char*>(p), block);
+    #else
+        scalar_classify_block(p, block);
+    #endif
+    }
+
+    // Bit i set if character i is inside a string, including the opening quote
+    inline
+    uint64_t prefix_xor(uint64_t x)
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+    // Bit i set if character i is preceded by an odd length run of backslashes
+    inline
+    uint64_t escaped_characters(uint64_t backslash, uint64_t& prev_escaped)
+    {
+        const uint64_t even_bits = 0x5555555555555555ULL;
+
+        backslash &= ~prev_escaped;
+        uint64_t follows_escape = (backslash << 1) | prev_escaped;
+        uint64_t odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+        uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+        prev_escaped = sequences_starting_on_even_bits < odd_sequence_starts ? 1 : 0;
+        uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+        return (even_bits ^ invert_mask) & follows_escape;
+    }
+
+    // Raw skipping of the contents of an array or object: classify 64 characters at a time by
+    // the characters that matter when only looking for the end of a container
+
+    struct skip_block
+    {
+        uint64_t quote;
+        uint64_t backslash;
+        uint64_t open; // '[' or '{'
+        uint64_t close; // ']' or '}'
+        uint64_t slash;
+        uint64_t lf;
+        uint64_t cr;
+    };
+
+    inline
+    unsigned count_leading_zeros64(uint64_t mask)
+    {
+    #if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, mask);
+        return 63 - static_cast<unsigned>(index);
+    #elif defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        if (_BitScanReverse(&index, static_cast<uint32_t>(mask >> 32)))
+        {
+            return 31 - static_cast<unsigned>(index);
+        }
+        _BitScanReverse(&index, static_cast<uint32_t>(mask));
+        return 63 - static_cast<unsigned>(index);
+    #else
+        return static_cast<unsigned>(__builtin_clzll(mask));
+    #endif
+    }
+
+    inline
+    unsigned popcount64(uint64_t x)
+    {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<unsigned>((x * 0x0101010101010101ULL) >> 56);
+    #else
+        return static_cast<unsigned>(__builtin_popcountll(x));
+    #endif
+    }
+
+    template <class CharT>
+    void scalar_classify_skip_block(const CharT* p, skip_block& block)
+    {
+        block = skip_block();
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            uint64_t bit = uint64_t(1) << i;
+            switch (p[i])
+            {
+                case '\"':
+                    block.quote |= bit;
+                    break;
+                case '\\':
+                    block.backslash |= bit;
+                    break;
+                case '[':case '{':
+                    block.open |= bit;
+                    break;
+                case ']':case '}':
+                    block.close |= bit;
+                    break;
+                case '/':
+                    block.slash |= bit;
+                    break;
+                case '\n':
+                    block.lf |= bit;
+                    break;
+                case '\r':
+                    block.cr |= bit;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+#if defined(JSONCONS_HAS_SSE2)
+
+    inline
+    void sse2_classify_skip_block(const char* p, skip_block& block)
+    {
+        block = skip_block();
+        for (unsigned i = 0; i < 4; ++i)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            unsigned shift = 16*i;
+            // '{' '}' differ from '[' ']' only in bit 0x20
+            __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+            block.quote |= sse2_match(v, '\"') << shift;
+            block.backslash |= sse2_match(v, '\\') << shift;
+            block.open |= sse2_match(folded, '{') << shift;
+            block.close |= sse2_match(folded, '}') << shift;
+            block.slash |= sse2_match(v, '/') << shift;
+            block.lf |= sse2_match(v, '\n') << shift;
+            block.cr |= sse2_match(v, '\r') << shift;
+        }
+    }
+
+#endif // defined(JSONCONS_HAS_SSE2)
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char)>::type
+    classify_skip_block(const CharT* p, skip_block& block)
+    {
+        scalar_classify_skip_block(p, block);
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char)>::type
+    classify_skip_block(const CharT* p, skip_block& block)
+    {
+    #if defined(JSONCONS_HAS_SSE2)
+        sse2_classify_skip_block(reinterpret_cast<const char*>(p), block);
+    #else
+        scalar_classify_skip_block(p, block);
+    #endif
+    }
+
+    // find_string_delimiter
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    find_string_delimiter(const CharT* first, const CharT* last)
+    {
+        return scalar_find_string_delimiter(first, last);
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    find_string_delimiter(const CharT* first, const CharT* last)
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 64 && has_avx2())
+        {
+            const char* p = avx2_find_string_delimiter(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last));
+            return first + (p - reinterpret_cast<const char*>(first));
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const char* p = sse2_find_string_delimiter(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last));
+        return first + (p - reinterpret_cast<const char*>(first));
+    #else
+        return scalar_find_string_delimiter(first, last);
+    #endif
+    }
+
+    // find_escape_character
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    find_escape_character(const CharT* first, const CharT* last, bool escape_all_non_ascii, bool escape_solidus)
+    {
+        return scalar_find_escape_character(first, last, escape_all_non_ascii, escape_solidus);
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    find_escape_character(const CharT* first, const CharT* last, bool escape_all_non_ascii, bool escape_solidus)
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 64 && has_avx2())
+        {
+            const char* p = avx2_find_escape_character(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last),
+                                                       escape_all_non_ascii, escape_solidus);
+            return first + (p - reinterpret_cast<const char*>(first));
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const char* p = sse2_find_escape_character(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last),
+                                                   escape_all_non_ascii, escape_solidus);
+        return first + (p - reinterpret_cast<const char*>(first));
+    #else
+        return scalar_find_escape_character(first, last, escape_all_non_ascii, escape_solidus);
+    #endif
+    }
+
+    // skip_blanks
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    skip_blanks(const CharT* first, const CharT* last)
+    {
+        return scalar_skip_blanks(first, last);
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    skip_blanks(const CharT* first, const CharT* last)
+    {
+        // Most runs of blanks are a single space, check that before vectorizing
+        if (first == last || (*first != ' ' && *first != '\t'))
+        {
+            return first;
+        }
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 64 && has_avx2())
+        {
+            const char* p = avx2_skip_blanks(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last));
+            return first + (p - reinterpret_cast<const char*>(first));
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const char* p = sse2_skip_blanks(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last));
+        return first + (p - reinterpret_cast<const char*>(first));
+    #else
+        return scalar_skip_blanks(first, last);
+    #endif
+    }
+
+    // skip_ascii
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    skip_ascii(const CharT* first, const CharT* last)
+    {
+        return scalar_skip_ascii(first, last);
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    skip_ascii(const CharT* first, const CharT* last)
+    {
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+        if (last - first >= 64 && has_avx2())
+        {
+            const char* p = avx2_skip_ascii(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last));
+            return first + (p - reinterpret_cast<const char*>(first));
+        }
+    #endif
+    #if defined(JSONCONS_HAS_SSE2)
+        const char* p = sse2_skip_ascii(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last));
+        return first + (p - reinterpret_cast<const char*>(first));
+    #else
+        return scalar_skip_ascii(first, last);
+    #endif
+    }
+
+    // Stage one of the structural parser, see structural_block
+    class structural_indexer
+    {
+        uint64_t prev_in_string_;
+        uint64_t prev_escaped_;
+        uint64_t prev_scalar_;
+    public:
+        structural_indexer()
+            : prev_in_string_(0), prev_escaped_(0), prev_scalar_(0)
+        {
+        }
+
+        // Starts again outside of a string
+        void reset()
+        {
+            prev_in_string_ = 0;
+            prev_escaped_ = 0;
+            prev_scalar_ = 0;
+        }
+
+        // Writes the offsets (base + i) of the structural characters in the block [p, p+64) to out,
+        // which must have room for 64 offsets, and returns the number written
+        template <class CharT>
+        std::size_t index_block(const CharT* p, std::size_t base, std::size_t* out)
+        {
+            return write_offsets(structural_bits(p, false), base, out);
+        }
+
+        // As index_block, and also writes the offsets of closing quotes, of backslashes and control
+        // characters inside strings, and of the first non-ASCII character of a string in each block.
+        // A string whose opening quote is followed in the index by its closing quote has none of them,
+        // and needs no scanning or UTF-8 validation.
+        template <class CharT>
+        std::size_t index_block_with_strings(const CharT* p, std::size_t base, std::size_t* out)
+        {
+            return write_offsets(structural_bits(p, true), base, out);
+        }
+    private:
+        template <class CharT>
+        uint64_t structural_bits(const CharT* p, bool with_strings)
+        {
+            structural_block block;
+            classify_block(p, block);
+
+            uint64_t escaped = escaped_characters(block.backslash, prev_escaped_);
+            uint64_t quote = block.quote & ~escaped;
+            uint64_t in_string = prefix_xor(quote) ^ prev_in_string_;
+            prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+            uint64_t scalar = ~(block.whitespace | block.op | quote) & ~in_string;
+            uint64_t scalar_start = scalar & ~((scalar << 1) | prev_scalar_);
+            prev_scalar_ = scalar >> 63;
+
+            if (with_strings)
+            {
+                uint64_t non_ascii = block.non_ascii & in_string;
+                return (block.op & ~in_string) | quote | scalar_start | ((block.backslash | block.control) & in_string)
+                    | (non_ascii & (~non_ascii + 1));
+            }
+            return (block.op & ~in_string) | (quote & in_string) | scalar_start;
+        }
+
+        static std::size_t write_offsets(uint64_t bits, std::size_t base, std::size_t* out)
+        {
+            std::size_t count = 0;
+            while (bits != 0)
+            {
+                out[count++] = base + count_trailing_zeros64(bits);
+                bits &= bits - 1;
+            }
+            return count;
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
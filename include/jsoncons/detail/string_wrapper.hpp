@@ -190,6 +190,7 @@ namespace detail {
 
             std::size_t mem_size = aligned_size(ptr->length_*sizeof(char_type));
             byte_allocator_type byte_alloc(ptr->get_allocator());
+            rawp->~str_t();
             byte_alloc.deallocate(p,mem_size);
         }
     };
@@ -360,6 +361,7 @@ namespace detail {
 
             std::size_t mem_size = aligned_size(ptr->length_*sizeof(char_type));
             byte_allocator_type byte_alloc(ptr->get_allocator());
+            rawp->~str_t();
             byte_alloc.deallocate(p,mem_size);
         }
     };
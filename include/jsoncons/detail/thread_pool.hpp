@@ -0,0 +1,114 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_THREAD_POOL_HPP
+#define JSONCONS_DETAIL_THREAD_POOL_HPP
+
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <utility> // std::move
+
+namespace jsoncons { namespace detail {
+
+    // A fixed set of worker threads that run tasks in submission order.
+    // A task receives the index of the worker that runs it, so that callers
+    // can keep per-worker state (e.g. a parser) without locking.
+    // Tasks must not throw. Tasks still queued on destruction are discarded.
+
+    class thread_pool
+    {
+    public:
+        using task_type = std::function<void(std::size_t)>;
+    private:
+        std::vector<std::thread> workers_;
+        std::deque<task_type> tasks_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_;
+
+        // Noncopyable and nonmoveable
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+    public:
+        // num_threads of 0 means one per hardware thread
+        explicit thread_pool(std::size_t num_threads)
+            : stop_(false)
+        {
+            if (num_threads == 0)
+            {
+                num_threads = default_concurrency();
+            }
+            workers_.reserve(num_threads);
+            for (std::size_t i = 0; i < num_threads; ++i)
+            {
+                workers_.emplace_back([this, i]() {run(i);});
+            }
+        }
+
+        ~thread_pool() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+                tasks_.clear();
+            }
+            cv_.notify_all();
+            for (auto& worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        static std::size_t default_concurrency()
+        {
+            std::size_t n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+        }
+
+        std::size_t size() const
+        {
+            return workers_.size();
+        }
+
+        void submit(task_type task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.push_back(std::move(task));
+            }
+            cv_.notify_one();
+        }
+
+    private:
+        void run(std::size_t index)
+        {
+            for (;;)
+            {
+                task_type task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this]() {return stop_ || !tasks_.empty();});
+                    if (stop_)
+                    {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+                task(index);
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_THREAD_POOL_HPP
@@ -14,9 +14,13 @@
 #include <limits> // std::numeric_limits
 #include <exception>
 #include <stdio.h> // snprintf
+#include <cstring> // std::memcpy
+#include <clocale> // localeconv
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_options.hpp>
-#include <jsoncons/detail/grisu3.hpp>
+#include <jsoncons/bigint.hpp>
+#include <jsoncons/detail/eisel_lemire.hpp> // leading_zeroes
+#include <jsoncons/detail/ryu.hpp>
 #include <jsoncons/detail/parse_number.hpp>
 #include <jsoncons/detail/more_type_traits.hpp>
 
@@ -31,8 +35,109 @@ namespace detail {
 
     // from_integer
 
+    template <class T = void>
+    struct integer_digits_tables
+    {
+        static const char digit_pairs[201];
+        static const uint64_t powers_of_ten[20];
+    };
+
+    template <class T>
+    const char integer_digits_tables<T>::digit_pairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    // powers_of_ten[0] is 0 rather than 1 so that count_digits(0) is 1
+    template <class T>
+    const uint64_t integer_digits_tables<T>::powers_of_ten[20] = {
+        0,
+        10ULL,
+        100ULL,
+        1000ULL,
+        10000ULL,
+        100000ULL,
+        1000000ULL,
+        10000000ULL,
+        100000000ULL,
+        1000000000ULL,
+        10000000000ULL,
+        100000000000ULL,
+        1000000000000ULL,
+        10000000000000ULL,
+        100000000000000ULL,
+        1000000000000000ULL,
+        10000000000000000ULL,
+        100000000000000000ULL,
+        1000000000000000000ULL,
+        10000000000000000000ULL
+    };
+
+    // The number of decimal digits of value. bits*1233/4096 approximates bits*log10(2) from below
+    // by at most one, which one comparison corrects.
+    inline int count_digits(uint64_t value)
+    {
+        const int bits = 64 - leading_zeroes(value | 1);
+        const int t = (bits * 1233) >> 12;
+        return t + 1 - (value < integer_digits_tables<>::powers_of_ten[t] ? 1 : 0);
+    }
+
+    // Writes the digits of value two at a time, backwards from last
+    template <class CharT>
+    void write_digits_backwards(uint64_t value, CharT* last)
+    {
+        const char* pairs = integer_digits_tables<>::digit_pairs;
+        while (value >= 100)
+        {
+            const std::size_t i = static_cast<std::size_t>(value % 100) * 2;
+            value /= 100;
+            *--last = static_cast<CharT>(pairs[i+1]);
+            *--last = static_cast<CharT>(pairs[i]);
+        }
+        if (value >= 10)
+        {
+            const std::size_t i = static_cast<std::size_t>(value) * 2;
+            *--last = static_cast<CharT>(pairs[i+1]);
+            *--last = static_cast<CharT>(pairs[i]);
+        }
+        else
+        {
+            *--last = static_cast<CharT>('0' + value);
+        }
+    }
+
+    // Integers of up to 64 bits are formatted with the length known in advance, 
+    // and appended to the result in one call
     template<class Integer,class Result>
-    typename std::enable_if<jsoncons::detail::is_integer<Integer>::value,std::size_t>::type
+    typename std::enable_if<jsoncons::detail::is_integer<Integer>::value && sizeof(Integer) <= sizeof(uint64_t),std::size_t>::type
+    from_integer(Integer value, Result& result)
+    {
+        using char_type = typename Result::value_type;
+
+        const bool is_negative = value < 0;
+        // two's complement negation is also correct for the most negative value
+        const uint64_t magnitude = is_negative ? uint64_t(0) - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        const std::size_t length = static_cast<std::size_t>(count_digits(magnitude)) + (is_negative ? 1 : 0);
+
+        char_type buf[21];
+        write_digits_backwards(magnitude, buf + length);
+        if (is_negative)
+        {
+            buf[0] = '-';
+        }
+        result.append(buf, length);
+        return length;
+    }
+
+    template<class Integer,class Result>
+    typename std::enable_if<jsoncons::detail::is_integer<Integer>::value && (sizeof(Integer) > sizeof(uint64_t)),std::size_t>::type
     from_integer(Integer value, Result& result)
     {
         using char_type = typename Result::value_type;
@@ -283,8 +388,282 @@ namespace detail {
         }
     }
 
+    // Digits of a finite positive double. digits[0..length) are significant and val = 0.d1d2...dn * 10^point
+    struct decimal_digits
+    {
+        char buffer[20];
+        std::string exact; // only used when more digits are needed than the shortest representation has
+        const char* digits;
+        int length;
+        int point;
+
+        explicit decimal_digits(double val)
+        {
+            decimal_fp64 d = shortest_decimal(val);
+            length = write_decimal_digits(d.mantissa, buffer);
+            point = length + d.exponent;
+            digits = buffer;
+        }
+
+        decimal_digits(const decimal_digits&) = delete;
+        decimal_digits& operator=(const decimal_digits&) = delete;
+
+        // Rounds to the first keep digits, to nearest with ties to even, as printf does. If
+        // significant, keep counts significant digits, otherwise it counts digits from the
+        // position of the leading digit before rounding (the fixed formats.)
+        void round(double val, int keep, bool significant)
+        {
+            if (keep == length)
+            {
+                // the shortest representation is the closest decimal with this many digits
+                return;
+            }
+            if (keep < 0)
+            {
+                length = 0;
+                return;
+            }
+            if (keep > length || (digits[keep] == '5' && keep + 1 == length))
+            {
+                // Digits beyond the shortest representation, and ties, depend on the exact binary value
+                round_exact(val, keep, significant);
+                return;
+            }
+            // A rounding boundary that lay between val and its shortest representation would
+            // be a shorter representation, so rounding the shortest representation rounds val
+            bool round_up = digits[keep] >= '5';
+            length = keep;
+            if (round_up)
+            {
+                while (length > 0 && digits[length-1] == '9')
+                {
+                    --length;
+                }
+                if (length == 0)
+                {
+                    buffer[0] = '1';
+                    length = 1;
+                    ++point;
+                }
+                else
+                {
+                    ++buffer[length-1];
+                }
+            }
+        }
+
+    private:
+        void round_exact(double val, int keep, bool significant)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &val, sizeof(double));
+            uint64_t m2 = bits & ((uint64_t(1) << 52) - 1);
+            int e2 = static_cast<int>((bits >> 52) & 0x7ff);
+            if (e2 == 0)
+            {
+                e2 = 1;
+            }
+            else
+            {
+                m2 |= uint64_t(1) << 52;
+            }
+            e2 -= 1075;
+
+            // The shortest representation may have rounded up to the next power of ten, 
+            // making point one too large
+            int s = keep - point;
+            for (int pass = 0; pass < 2; ++pass, ++s)
+            {
+                // q = round(val * 10^s) = round(m2 * 5^s * 2^(e2+s))
+                bigint num(m2);
+                bigint den(1);
+                multiply_by_pow5(s >= 0 ? num : den, s >= 0 ? s : -s);
+                if (e2 + s >= 0)
+                {
+                    num <<= static_cast<uint64_t>(e2 + s);
+                }
+                else
+                {
+                    den <<= static_cast<uint64_t>(-(e2 + s));
+                }
+                bigint q;
+                bigint r;
+                num.divide(den, q, r, true);
+                r <<= 1;
+                int c = r.compare(den);
+                if (c > 0 || (c == 0 && ((uint64_t)(q % bigint(2)) != 0)))
+                {
+                    q += bigint(1);
+                }
+                write_digits(q);
+                point = length - s;
+                if (!significant || length >= keep || length == 0)
+                {
+                    break;
+                }
+            }
+            digits = exact.data();
+        }
+
+        static void multiply_by_pow5(bigint& n, int k)
+        {
+            const uint64_t pow5_27 = 7450580596923828125ULL;
+            for (; k >= 27; k -= 27)
+            {
+                n *= pow5_27;
+            }
+            uint64_t p = 1;
+            for (; k > 0; --k)
+            {
+                p *= 5;
+            }
+            n *= p;
+        }
+
+        void write_digits(bigint q)
+        {
+            exact.clear();
+            const uint64_t pow10_19 = 10000000000000000000ULL;
+            const bigint divisor(pow10_19);
+            char chunk[20];
+            // least significant chunks first
+            std::string reversed;
+            while (q >= divisor)
+            {
+                bigint quot;
+                bigint rem;
+                q.divide(divisor, quot, rem, true);
+                uint64_t r = (uint64_t)rem;
+                for (int i = 0; i < 19; ++i)
+                {
+                    reversed.push_back(static_cast<char>('0' + r % 10));
+                    r /= 10;
+                }
+                q = quot;
+            }
+            uint64_t top = (uint64_t)q;
+            if (top != 0)
+            {
+                int n = write_decimal_digits(top, chunk);
+                exact.append(chunk, n);
+            }
+            exact.append(reversed.rbegin(), reversed.rend());
+            length = static_cast<int>(exact.size());
+        }
+    };
+
+    // %.*f
+    template <class Result>
+    void write_fixed(double val, int precision, Result& result)
+    {
+        if (std::signbit(val))
+        {
+            result.push_back('-');
+            val = -val;
+        }
+        if (val == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            for (int i = 0; i < precision; ++i)
+            {
+                result.push_back('0');
+            }
+            return;
+        }
+        decimal_digits d(val);
+        d.round(val, d.point + precision, false);
+        if (d.length == 0)
+        {
+            d.point = 1;
+        }
+        if (d.point <= 0)
+        {
+            result.push_back('0');
+        }
+        for (int i = 0; i < d.point; ++i)
+        {
+            result.push_back(i < d.length ? d.digits[i] : '0');
+        }
+        result.push_back('.');
+        for (int i = d.point; i < d.point + precision; ++i)
+        {
+            result.push_back(i >= 0 && i < d.length ? d.digits[i] : '0');
+        }
+    }
+
+    // %.*e, or the shortest representation if precision is 0
+    template <class Result>
+    void write_scientific(double val, int precision, Result& result)
+    {
+        if (std::signbit(val))
+        {
+            result.push_back('-');
+            val = -val;
+        }
+        if (val == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            for (int i = 0; i < precision; ++i)
+            {
+                result.push_back('0');
+            }
+            result.push_back('e');
+            fill_exponent(0, result);
+            return;
+        }
+        decimal_digits d(val);
+        if (precision > 0)
+        {
+            d.round(val, precision + 1, true);
+        }
+        else
+        {
+            precision = d.length - 1;
+        }
+        result.push_back(d.digits[0]);
+        if (precision > 0)
+        {
+            result.push_back('.');
+            for (int i = 1; i <= precision; ++i)
+            {
+                result.push_back(i < d.length ? d.digits[i] : '0');
+            }
+        }
+        result.push_back('e');
+        fill_exponent(d.point - 1, result);
+    }
+
+    // %.*g, with .0 appended to integral values
+    template <class Result>
+    void write_general(double val, int precision, Result& result)
+    {
+        if (std::signbit(val))
+        {
+            result.push_back('-');
+            val = -val;
+        }
+        if (val == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return;
+        }
+        decimal_digits d(val);
+        d.round(val, precision, true);
+        int length = d.length;
+        while (length > 1 && d.digits[length-1] == '0')
+        {
+            --length;
+        }
+        // fixed notation if -4 <= exponent < precision
+        prettify_string(d.digits, length, d.point - length, -4, precision, result);
+    }
+
     template<class Result>
-    bool dtoa_scientific(double val, char decimal_point, Result& result)
+    bool dtoa_scientific(double val, char decimal_point, Result& result, std::false_type)
     {
         if (val == 0)
         {
@@ -303,7 +682,7 @@ namespace detail {
         {
             return false;
         }
-        if (to_double_(buffer, sizeof(buffer)) != val)
+        if (to_double_(buffer, static_cast<std::size_t>(length)) != val)
         {
             const int precision2 = std::numeric_limits<double>::max_digits10;
             length = snprintf(buffer, sizeof(buffer), "%1.*e", precision2, val);
@@ -316,6 +695,24 @@ namespace detail {
         return true;
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result, std::true_type)
+    {
+        if (v == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return true;
+        }
+        if (!std::isfinite(v))
+        {
+            return dtoa_scientific(v, decimal_point, result, std::false_type());
+        }
+        write_scientific(v, 0, result);
+        return true;
+    }
+
     template<class Result>
     bool dtoa_general(double val, char decimal_point, Result& result, std::false_type)
     {
@@ -336,7 +733,7 @@ namespace detail {
         {
             return false;
         }
-        if (to_double_(buffer, sizeof(buffer)) != val)
+        if (to_double_(buffer, static_cast<std::size_t>(length)) != val)
         {
             const int precision2 = std::numeric_limits<double>::max_digits10;
             length = snprintf(buffer, sizeof(buffer), "%1.*g", precision2, val);
@@ -359,28 +756,23 @@ namespace detail {
             result.push_back('0');
             return true;
         }
-
-        int length = 0;
-        int k;
-
-        char buffer[100];
-
-        double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        if (!std::isfinite(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            // min exp: -4 is consistent with sprintf
-            // max exp: std::numeric_limits<double>::max_digits10
-            jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
-            return true;
+            return dtoa_general(v, decimal_point, result, std::false_type());
         }
-        else
+
+        double u = std::signbit(v) ? -v : v;
+        decimal_fp64 d = jsoncons::detail::shortest_decimal(u);
+        char buffer[20];
+        int length = jsoncons::detail::write_decimal_digits(d.mantissa, buffer);
+        if (std::signbit(v))
         {
-            return dtoa_general(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        // min exp: -4 is consistent with sprintf
+        // max exp: std::numeric_limits<double>::max_digits10
+        jsoncons::detail::prettify_string(buffer, length, d.exponent, -4, std::numeric_limits<double>::max_digits10, result);
+        return true;
     }
 
     template<class Result>
@@ -403,7 +795,7 @@ namespace detail {
         {
             return false;
         }
-        if (to_double_(buffer, sizeof(buffer)) != val)
+        if (to_double_(buffer, static_cast<std::size_t>(length)) != val)
         {
             const int precision2 = std::numeric_limits<double>::max_digits10;
             length = snprintf(buffer, sizeof(buffer), "%1.*f", precision2, val);
@@ -426,26 +818,21 @@ namespace detail {
             result.push_back('0');
             return true;
         }
-
-        int length = 0;
-        int k;
-
-        char buffer[100];
-
-        double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        if (!std::isfinite(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
-            return true;
+            return dtoa_fixed(v, decimal_point, result, std::false_type());
         }
-        else
+
+        double u = std::signbit(v) ? -v : v;
+        decimal_fp64 d = jsoncons::detail::shortest_decimal(u);
+        char buffer[20];
+        int length = jsoncons::detail::write_decimal_digits(d.mantissa, buffer);
+        if (std::signbit(v))
         {
-            return dtoa_fixed(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        jsoncons::detail::prettify_string(buffer, length, d.exponent, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
+        return true;
     }
 
     template<class Result>
@@ -460,24 +847,37 @@ namespace detail {
         return dtoa_general(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result)
+    {
+        return dtoa_scientific(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
+    // The decimal point of the C locale, which snprintf uses
+    inline char locale_decimal_point()
+    {
+        char decimal_point = '.';
+    #if !defined(JSONCONS_NO_LOCALECONV)
+        struct lconv *lc = localeconv();
+        if (lc != nullptr && lc->decimal_point[0] != 0)
+        {
+            decimal_point = lc->decimal_point[0];
+        }
+    #endif
+        return decimal_point;
+    }
+
+    // On IEEE 754 platforms finite values are formatted without snprintf, 
+    // so output does not depend on the C locale.
     class write_double
     {
     private:
-        to_double_t to_double_;
         float_chars_format float_format_;
         int precision_;
-        char decimal_point_;
     public:
         write_double(float_chars_format float_format, int precision)
-           : float_format_(float_format), precision_(precision), decimal_point_('.')
+           : float_format_(float_format), precision_(precision)
         {
-    #if !defined(JSONCONS_NO_LOCALECONV)
-            struct lconv *lc = localeconv();
-            if (lc != nullptr && lc->decimal_point[0] != 0)
-            {
-                decimal_point_ = lc->decimal_point[0];
-            }
-    #endif
         }
         write_double(const write_double&) = default;
 
@@ -488,76 +888,80 @@ namespace detail {
         {
             std::size_t count = 0;
 
-            char number_buffer[200];
-            int length = 0;
-
-            switch (float_format_)
+            bool ok = true;
+            if (precision_ <= 0)
             {
-            case float_chars_format::fixed:
+                switch (float_format_)
                 {
-                    if (precision_ > 0)
-                    {
-                        length = snprintf(number_buffer, sizeof(number_buffer), "%1.*f", precision_, val);
-                        if (length < 0)
-                        {
-                            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
-                        }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
-                    }
-                    else
-                    {
-                        if (!dtoa_fixed(val, decimal_point_, result))
-                        {
-                            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
-                        }
-                    }
+                    case float_chars_format::fixed:
+                        ok = dtoa_fixed(val, '.', result);
+                        break;
+                    case float_chars_format::scientific:
+                        ok = dtoa_scientific(val, '.', result);
+                        break;
+                    case float_chars_format::general:
+                        ok = dtoa_general(val, '.', result);
+                        break;
+                    default:
+                        ok = false;
+                        break;
                 }
-                break;
-            case float_chars_format::scientific:
+            }
+            else if (std::numeric_limits<double>::is_iec559 && std::isfinite(val))
+            {
+                switch (float_format_)
                 {
-                    if (precision_ > 0)
-                    {
-                        length = snprintf(number_buffer, sizeof(number_buffer), "%1.*e", precision_, val);
-                        if (length < 0)
-                        {
-                            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
-                        }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
-                    }
-                    else
-                    {
-                        if (!dtoa_scientific(val, decimal_point_, result))
-                        {
-                            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
-                        }
-                    }
+                    case float_chars_format::fixed:
+                        write_fixed(val, precision_, result);
+                        break;
+                    case float_chars_format::scientific:
+                        write_scientific(val, precision_, result);
+                        break;
+                    case float_chars_format::general:
+                        write_general(val, precision_, result);
+                        break;
+                    default:
+                        ok = false;
+                        break;
                 }
-                break;
-            case float_chars_format::general:
-                {
-                    if (precision_ > 0)
-                    {
-                        length = snprintf(number_buffer, sizeof(number_buffer), "%1.*g", precision_, val);
-                        if (length < 0)
-                        {
-                            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
-                        }
-                        dump_buffer(number_buffer, length, decimal_point_, result);
-                    }
-                    else
-                    {
-                        if (!dtoa_general(val, decimal_point_, result))
-                        {
-                            JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
-                        }
-                    }             
+            }
+            else
+            {
+                ok = write_with_snprintf(val, result);
+            }
+            if (!ok)
+            {
+                JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
+            }
+            return count;
+        }
+    private:
+        template<class Result>
+        bool write_with_snprintf(double val, Result& result)
+        {
+            char number_buffer[200];
+            int length = 0;
+
+            switch (float_format_)
+            {
+                case float_chars_format::fixed:
+                    length = snprintf(number_buffer, sizeof(number_buffer), "%1.*f", precision_, val);
                     break;
-                }
-                default:
-                    JSONCONS_THROW(json_runtime_error<std::invalid_argument>("write_double failed."));
+                case float_chars_format::scientific:
+                    length = snprintf(number_buffer, sizeof(number_buffer), "%1.*e", precision_, val);
                     break;
+                case float_chars_format::general:
+                    length = snprintf(number_buffer, sizeof(number_buffer), "%1.*g", precision_, val);
+                    break;
+                default:
+                    return false;
             }
-            return count;
+            if (length < 0)
+            {
+                return false;
+            }
+            dump_buffer(number_buffer, length, locale_decimal_point(), result);
+            return true;
         }
     };
 
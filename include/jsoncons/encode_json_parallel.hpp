@@ -0,0 +1,461 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ENCODE_JSON_PARALLEL_HPP
+#define JSONCONS_ENCODE_JSON_PARALLEL_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <deque>
+#include <future>
+#include <memory> // std::shared_ptr
+#include <iterator> // std::next
+#include <ostream>
+#include <system_error>
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/sink.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // Encodes a document by splitting one container, the split container, into ranges of
+    // elements (or members) that are encoded on a pool of threads, each range into its
+    // own buffer with its own encoder, and writing the buffers to the sink in order.
+    //
+    // The split container is the root, or, while a container has fewer elements than
+    // there are threads, its largest child. A worker reproduces the encoder state at the
+    // start of its range by encoding the containers on the path to the split container,
+    // and a null placeholder element, and discards that output. This state differs from
+    // the serial state only in the column and in the counts of the enclosing containers,
+    // so ranges may only begin at elements that the encoder starts on a new line. With
+    // the compact encoder that is every element, with the pretty encoder it depends on
+    // the line split options. The first range also encodes the members that precede the
+    // path, and the last range those that follow it. If the document cannot be split,
+    // it is encoded serially.
+
+    template <class Json>
+    class parallel_json_encode
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_view_type = typename Json::string_view_type;
+        using string_type = std::basic_string<char_type>;
+    private:
+        static constexpr std::size_t ranges_per_thread = 4;
+
+        struct step
+        {
+            const Json* container;
+            std::size_t index; // of the member or element on the path
+        };
+
+        struct range
+        {
+            std::size_t first;
+            std::size_t last;
+            string_type text;
+            std::size_t offset; // length of the discarded prefix
+            std::promise<void> done;
+
+            range(std::size_t first, std::size_t last)
+                : first(first), last(last), offset(0)
+            {
+            }
+        };
+
+        const Json& root_;
+        const basic_json_encode_options<char_type>& options_;
+        bool pretty_;
+        std::vector<step> path_;
+        const Json* split_;
+    public:
+        parallel_json_encode(const Json& root, const basic_json_encode_options<char_type>& options,
+                             indenting line_indent)
+            : root_(root), options_(options), pretty_(line_indent == indenting::indent), split_(nullptr)
+        {
+        }
+
+        template <class Sink>
+        void encode(Sink& sink, std::size_t num_threads)
+        {
+            if (num_threads == 0)
+            {
+                num_threads = thread_pool::default_concurrency();
+            }
+            std::vector<std::size_t> bounds;
+            if (num_threads > 1)
+            {
+                find_split_container(num_threads);
+            }
+            if (split_ != nullptr)
+            {
+                make_bounds(num_threads*ranges_per_thread, bounds);
+            }
+            if (bounds.size() < 3)
+            {
+                encode_serially(sink);
+                return;
+            }
+
+            thread_pool pool(num_threads);
+            const std::size_t max_in_flight = pool.size()*ranges_per_thread;
+            const std::size_t num_ranges = bounds.size() - 1;
+            std::deque<std::pair<std::shared_ptr<range>,std::future<void>>> in_flight;
+            std::size_t next = 0;
+            while (next < num_ranges || !in_flight.empty())
+            {
+                while (next < num_ranges && in_flight.size() < max_in_flight)
+                {
+                    std::shared_ptr<range> r = std::make_shared<range>(bounds[next], bounds[next+1]);
+                    in_flight.emplace_back(r, r->done.get_future());
+                    bool is_first = next == 0;
+                    bool is_last = next + 1 == num_ranges;
+                    pool.submit([this, r, is_first, is_last](std::size_t) {run(*r, is_first, is_last);});
+                    ++next;
+                }
+                std::shared_ptr<range> r = std::move(in_flight.front().first);
+                std::future<void> ready = std::move(in_flight.front().second);
+                in_flight.pop_front();
+                ready.get(); // rethrows an exception thrown while encoding the range
+                sink.append(r->text.data() + r->offset, r->text.size() - r->offset);
+            }
+            sink.flush();
+        }
+
+    private:
+        line_split_kind line_splits(bool parent_is_object, bool is_object) const
+        {
+            if (parent_is_object)
+            {
+                return is_object ? options_.object_object_line_splits() : options_.object_array_line_splits();
+            }
+            return is_object ? options_.array_object_line_splits() : options_.array_array_line_splits();
+        }
+
+        // True if the encoder writes a new line before the element (or member) at the
+        // index of the container, whatever the column
+        bool starts_on_new_line(const Json& container, line_split_kind splits, const Json& value) const
+        {
+            if (!pretty_)
+            {
+                return true;
+            }
+            if (container.is_object())
+            {
+                return splits == line_split_kind::multi_line;
+            }
+            if (value.is_object())
+            {
+                return options_.array_object_line_splits() != line_split_kind::same_line;
+            }
+            if (value.is_array())
+            {
+                return splits == line_split_kind::multi_line ||
+                       options_.array_array_line_splits() != line_split_kind::same_line;
+            }
+            return splits == line_split_kind::multi_line;
+        }
+
+        void find_split_container(std::size_t num_threads)
+        {
+            const Json* current = &root_;
+            line_split_kind splits = line_split_kind::multi_line;
+            while ((current->is_array() || current->is_object()) && current->size() > 0)
+            {
+                if (current->size() >= num_threads)
+                {
+                    split_ = current;
+                    return;
+                }
+                // Descend into the largest child container
+                std::size_t index = 0;
+                const Json* child = nullptr;
+                if (current->is_object())
+                {
+                    std::size_t i = 0;
+                    for (const auto& member : current->object_range())
+                    {
+                        const Json& value = member.value();
+                        if ((value.is_array() || value.is_object()) && (child == nullptr || value.size() > child->size()))
+                        {
+                            child = &value;
+                            index = i;
+                        }
+                        ++i;
+                    }
+                }
+                else
+                {
+                    std::size_t i = 0;
+                    for (const auto& value : current->array_range())
+                    {
+                        if ((value.is_array() || value.is_object()) && (child == nullptr || value.size() > child->size()))
+                        {
+                            child = &value;
+                            index = i;
+                        }
+                        ++i;
+                    }
+                }
+                if (child == nullptr || !starts_on_new_line(*current, splits, *child))
+                {
+                    return;
+                }
+                path_.push_back(step{current, index});
+                splits = line_splits(current->is_object(), child->is_object());
+                current = child;
+            }
+        }
+
+        // Splits the elements of the split container into about num_ranges ranges
+        // that begin at elements that start on a new line
+        void make_bounds(std::size_t num_ranges, std::vector<std::size_t>& bounds) const
+        {
+            line_split_kind splits = path_.empty() ? line_split_kind::multi_line
+                                                   : line_splits(path_.back().container->is_object(), split_->is_object());
+            const std::size_t size = split_->size();
+            const std::size_t target = (size + num_ranges - 1) / num_ranges;
+
+            bounds.push_back(0);
+            std::size_t index = target;
+            while (index < size)
+            {
+                if (starts_on_new_line(*split_, splits, element(*split_, index)))
+                {
+                    bounds.push_back(index);
+                    index += target;
+                }
+                else
+                {
+                    ++index;
+                }
+            }
+            bounds.push_back(size);
+        }
+
+        static const Json& element(const Json& container, std::size_t index)
+        {
+            if (container.is_object())
+            {
+                return std::next(container.object_range().begin(), index)->value();
+            }
+            return *std::next(container.array_range().begin(), index);
+        }
+
+        template <class Sink>
+        void encode_serially(Sink& sink) const
+        {
+            if (pretty_)
+            {
+                basic_json_encoder<char_type,Sink&> encoder(sink, options_);
+                root_.dump(encoder);
+            }
+            else
+            {
+                basic_compact_json_encoder<char_type,Sink&> encoder(sink, options_);
+                root_.dump(encoder);
+            }
+        }
+
+        void run(range& r, bool is_first, bool is_last) const
+        {
+            JSONCONS_TRY
+            {
+                if (pretty_)
+                {
+                    basic_json_encoder<char_type,string_sink<string_type>> encoder(r.text, options_);
+                    encode_range(encoder, r, is_first, is_last);
+                }
+                else
+                {
+                    basic_compact_json_encoder<char_type,string_sink<string_type>> encoder(r.text, options_);
+                    encode_range(encoder, r, is_first, is_last);
+                }
+                r.done.set_value();
+            }
+            JSONCONS_CATCH(...)
+            {
+                r.done.set_exception(std::current_exception());
+            }
+        }
+
+        void encode_range(basic_json_visitor<char_type>& visitor, range& r, bool is_first, bool is_last) const
+        {
+            const ser_context context{};
+            std::error_code ec;
+
+            for (const auto& s : path_)
+            {
+                begin_container(*s.container, visitor, ec);
+                if (is_first)
+                {
+                    encode_members(*s.container, 0, s.index, visitor, ec);
+                }
+                if (s.container->is_object())
+                {
+                    const auto& key = std::next(s.container->object_range().begin(), s.index)->key();
+                    visitor.key(string_view_type(key.data(), key.size()), context, ec);
+                }
+            }
+            begin_container(*split_, visitor, ec);
+            if (!is_first)
+            {
+                if (split_->is_object())
+                {
+                    visitor.key(string_view_type(), context, ec);
+                }
+                visitor.null_value(semantic_tag::none, context, ec);
+                r.offset = r.text.size();
+            }
+
+            encode_members(*split_, r.first, r.last, visitor, ec);
+
+            if (is_last)
+            {
+                end_container(*split_, visitor, ec);
+                for (auto it = path_.rbegin(); it != path_.rend(); ++it)
+                {
+                    encode_members(*it->container, it->index + 1, it->container->size(), visitor, ec);
+                    end_container(*it->container, visitor, ec);
+                }
+            }
+            visitor.flush();
+        }
+
+        static void begin_container(const Json& container, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+        {
+            const ser_context context{};
+            if (container.is_object())
+            {
+                visitor.begin_object(container.size(), container.tag(), context, ec);
+            }
+            else
+            {
+                visitor.begin_array(container.size(), container.tag(), context, ec);
+            }
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        static void end_container(const Json& container, basic_json_visitor<char_type>& visitor, std::error_code& ec)
+        {
+            const ser_context context{};
+            if (container.is_object())
+            {
+                visitor.end_object(context, ec);
+            }
+            else
+            {
+                visitor.end_array(context, ec);
+            }
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        static void encode_members(const Json& container, std::size_t first, std::size_t last,
+                                   basic_json_visitor<char_type>& visitor, std::error_code& ec)
+        {
+            if (first >= last)
+            {
+                return;
+            }
+            const ser_context context{};
+            if (container.is_object())
+            {
+                auto it = std::next(container.object_range().begin(), first);
+                for (std::size_t i = first; i < last; ++i, ++it)
+                {
+                    visitor.key(string_view_type(it->key().data(), it->key().size()), context, ec);
+                    it->value().dump(visitor, ec);
+                    if (ec)
+                    {
+                        JSONCONS_THROW(ser_error(ec));
+                    }
+                }
+            }
+            else
+            {
+                auto it = std::next(container.array_range().begin(), first);
+                for (std::size_t i = first; i < last; ++i, ++it)
+                {
+                    it->dump(visitor, ec);
+                    if (ec)
+                    {
+                        JSONCONS_THROW(ser_error(ec));
+                    }
+                }
+            }
+        }
+    };
+
+    template <class Json>
+    constexpr std::size_t parallel_json_encode<Json>::ranges_per_thread;
+
+} // namespace detail
+
+    // Encodes a basic_json value on a pool of threads, num_threads of 0 means one per
+    // hardware thread. The output is the same as that of encode_json.
+
+    template <class T, class Container>
+    typename std::enable_if<is_basic_json<T>::value &&
+                            jsoncons::detail::is_back_insertable_char_container<Container>::value>::type
+    encode_json_parallel(const T& val,
+                         Container& s,
+                         const basic_json_encode_options<typename Container::value_type>& options,
+                         indenting line_indent = indenting::no_indent,
+                         std::size_t num_threads = 0)
+    {
+        jsoncons::string_sink<Container> sink(s);
+        jsoncons::detail::parallel_json_encode<T> encoder(val, options, line_indent);
+        encoder.encode(sink, num_threads);
+    }
+
+    template <class T, class Container>
+    typename std::enable_if<is_basic_json<T>::value &&
+                            jsoncons::detail::is_back_insertable_char_container<Container>::value>::type
+    encode_json_parallel(const T& val,
+                         Container& s,
+                         indenting line_indent = indenting::no_indent,
+                         std::size_t num_threads = 0)
+    {
+        encode_json_parallel(val, s, basic_json_encode_options<typename Container::value_type>(), line_indent, num_threads);
+    }
+
+    template <class T, class CharT>
+    typename std::enable_if<is_basic_json<T>::value>::type
+    encode_json_parallel(const T& val,
+                         std::basic_ostream<CharT>& os,
+                         const basic_json_encode_options<CharT>& options,
+                         indenting line_indent = indenting::no_indent,
+                         std::size_t num_threads = 0)
+    {
+        jsoncons::stream_sink<CharT> sink(os);
+        jsoncons::detail::parallel_json_encode<T> encoder(val, options, line_indent);
+        encoder.encode(sink, num_threads);
+    }
+
+    template <class T, class CharT>
+    typename std::enable_if<is_basic_json<T>::value>::type
+    encode_json_parallel(const T& val,
+                         std::basic_ostream<CharT>& os,
+                         indenting line_indent = indenting::no_indent,
+                         std::size_t num_threads = 0)
+    {
+        encode_json_parallel(val, os, basic_json_encode_options<CharT>(), line_indent, num_threads);
+    }
+
+} // namespace jsoncons
+
+#endif // JSONCONS_ENCODE_JSON_PARALLEL_HPP
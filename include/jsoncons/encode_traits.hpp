@@ -10,6 +10,7 @@
 #include <string>
 #include <tuple>
 #include <array>
+#include <iterator> // std::distance
 #include <memory>
 #include <type_traits> // std::enable_if, std::true_type, std::false_type
 #include <jsoncons/json_visitor.hpp>
@@ -254,7 +255,7 @@ namespace jsoncons {
                            const Json& proto, 
                            std::error_code& ec)
         {
-            encoder.begin_array(val.size(),semantic_tag::none,ser_context(),ec);
+            encoder.begin_array(size(val),semantic_tag::none,ser_context(),ec);
             if (ec) return;
             for (auto it = std::begin(val); it != std::end(val); ++it)
             {
@@ -263,6 +264,20 @@ namespace jsoncons {
             }
             encoder.end_array(ser_context(), ec);
         }
+    private:
+        template <class U = T>
+        static typename std::enable_if<jsoncons::detail::has_size<U>::value,std::size_t>::type
+        size(const U& val)
+        {
+            return val.size();
+        }
+        // e.g. std::forward_list
+        template <class U = T>
+        static typename std::enable_if<!jsoncons::detail::has_size<U>::value,std::size_t>::type
+        size(const U& val)
+        {
+            return static_cast<std::size_t>(std::distance(std::begin(val), std::end(val)));
+        }
     };
 
     template <class T, class CharT>
@@ -0,0 +1,224 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_FD_SINK_HPP
+#define JSONCONS_FD_SINK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <cstring> // std::memcpy
+#include <vector>
+#include <utility> // std::swap
+#include <system_error>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+#if defined(_WIN32)
+#  include <io.h>
+#else
+#  include <sys/uio.h>
+#  include <unistd.h>
+#endif
+
+namespace jsoncons {
+
+namespace detail {
+
+    // Writes all of first, then all of second, to a blocking file descriptor,
+    // retrying after partial writes and interrupted calls
+    inline std::error_code write_fd(int fd, const void* first, std::size_t first_length,
+                                    const void* second, std::size_t second_length)
+    {
+#if defined(_WIN32)
+        const void* data[2] = {first, second};
+        std::size_t lengths[2] = {first_length, second_length};
+        for (int i = 0; i < 2; ++i)
+        {
+            const char* p = static_cast<const char*>(data[i]);
+            std::size_t remaining = lengths[i];
+            while (remaining > 0)
+            {
+                unsigned int n = remaining > 0x40000000 ? 0x40000000u : static_cast<unsigned int>(remaining);
+                int written = ::_write(fd, p, n);
+                if (written < 0)
+                {
+                    return std::error_code(errno, std::system_category());
+                }
+                p += written;
+                remaining -= static_cast<std::size_t>(written);
+            }
+        }
+        return std::error_code();
+#else
+        struct iovec iov[2];
+        iov[0].iov_base = const_cast<void*>(first);
+        iov[0].iov_len = first_length;
+        iov[1].iov_base = const_cast<void*>(second);
+        iov[1].iov_len = second_length;
+
+        struct iovec* next = iov;
+        int count = 2;
+        while (count > 0 && next->iov_len == 0)
+        {
+            ++next;
+            --count;
+        }
+        while (count > 0)
+        {
+            ssize_t written = ::writev(fd, next, count);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return std::error_code(errno, std::system_category());
+            }
+            std::size_t n = static_cast<std::size_t>(written);
+            while (count > 0 && n >= next->iov_len)
+            {
+                n -= next->iov_len;
+                ++next;
+                --count;
+            }
+            if (count > 0)
+            {
+                next->iov_base = static_cast<char*>(next->iov_base) + n;
+                next->iov_len -= n;
+            }
+        }
+        return std::error_code();
+#endif
+    }
+
+} // namespace detail
+
+    // A sink that buffers output and writes it to a file descriptor owned by the caller,
+    // for example a socket or a pipe, without going through std::ostream. When an append
+    // does not fit in the buffer, the buffered output and the appended characters are
+    // written with one writev. The descriptor should be in blocking mode. After a write fails,
+    // further output is discarded and error() reports the failure.
+
+    template <class CharT>
+    class basic_fd_sink
+    {
+        static_assert(sizeof(CharT) == 1, "basic_fd_sink requires a one byte character type");
+    public:
+        using value_type = CharT;
+        static constexpr std::size_t default_buffer_length = 16384;
+    private:
+        int fd_;
+        std::vector<CharT> buffer_;
+        CharT* begin_buffer_;
+        const CharT* end_buffer_;
+        CharT* p_;
+        std::error_code ec_;
+
+        // Noncopyable
+        basic_fd_sink(const basic_fd_sink&) = delete;
+        basic_fd_sink& operator=(const basic_fd_sink&) = delete;
+    public:
+        explicit basic_fd_sink(int fd, std::size_t buflen = default_buffer_length)
+            : fd_(fd), buffer_(buflen == 0 ? 1 : buflen),
+              begin_buffer_(buffer_.data()), end_buffer_(begin_buffer_+buffer_.size()), p_(begin_buffer_)
+        {
+        }
+
+        basic_fd_sink(basic_fd_sink&& other) noexcept
+            : fd_(-1), begin_buffer_(nullptr), end_buffer_(nullptr), p_(nullptr)
+        {
+            swap(other);
+        }
+
+        basic_fd_sink& operator=(basic_fd_sink&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        // Writes the buffered output, does not close the descriptor
+        ~basic_fd_sink() noexcept
+        {
+            write_buffer(nullptr, 0);
+        }
+
+        // Writes the buffered output
+        void flush()
+        {
+            write_buffer(nullptr, 0);
+        }
+
+        void append(const CharT* s, std::size_t length)
+        {
+            std::size_t diff = end_buffer_ - p_;
+            if (diff >= length)
+            {
+                std::memcpy(p_, s, length*sizeof(CharT));
+                p_ += length;
+            }
+            else
+            {
+                write_buffer(s, length);
+            }
+        }
+
+        void push_back(CharT ch)
+        {
+            if (p_ == end_buffer_)
+            {
+                write_buffer(nullptr, 0);
+            }
+            *p_++ = ch;
+        }
+
+        int fd() const
+        {
+            return fd_;
+        }
+
+        bool is_error() const
+        {
+            return static_cast<bool>(ec_);
+        }
+
+        // Set if a write failed
+        std::error_code error() const
+        {
+            return ec_;
+        }
+
+        void swap(basic_fd_sink& other) noexcept
+        {
+            std::swap(fd_, other.fd_);
+            buffer_.swap(other.buffer_);
+            std::swap(begin_buffer_, other.begin_buffer_);
+            std::swap(end_buffer_, other.end_buffer_);
+            std::swap(p_, other.p_);
+            std::swap(ec_, other.ec_);
+        }
+    private:
+        // Writes the buffered output followed by s, and empties the buffer
+        void write_buffer(const CharT* s, std::size_t length)
+        {
+            std::size_t buffered = p_ - begin_buffer_;
+            p_ = begin_buffer_;
+            if (fd_ < 0 || ec_ || (buffered == 0 && length == 0))
+            {
+                return;
+            }
+            ec_ = detail::write_fd(fd_, begin_buffer_, buffered*sizeof(CharT), s, length*sizeof(CharT));
+        }
+    };
+
+    template <class CharT>
+    constexpr std::size_t basic_fd_sink<CharT>::default_buffer_length;
+
+    using fd_sink = basic_fd_sink<char>;
+    using binary_fd_sink = basic_fd_sink<uint8_t>;
+
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,258 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_FD_SOURCE_HPP
+#define JSONCONS_FD_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <cstring> // std::memcpy
+#include <algorithm> // std::min
+#include <vector>
+#include <utility> // std::swap
+#include <system_error>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/detail/span.hpp>
+
+#if defined(_WIN32)
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+namespace jsoncons {
+
+namespace detail {
+
+    // Reads at most length bytes from a file descriptor, retrying interrupted calls.
+    // Returns the number of bytes read, 0 at end of file, or -1 on error.
+    inline std::ptrdiff_t read_fd(int fd, void* p, std::size_t length)
+    {
+#if defined(_WIN32)
+        unsigned int n = length > 0x40000000 ? 0x40000000u : static_cast<unsigned int>(length);
+        return ::_read(fd, p, n);
+#else
+        for (;;)
+        {
+            ssize_t count = ::read(fd, p, length);
+            if (count < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            return static_cast<std::ptrdiff_t>(count);
+        }
+#endif
+    }
+
+} // namespace detail
+
+    // A source that reads from a file descriptor owned by the caller, for example a socket
+    // or a pipe, without going through std::istream. Each read call fills the buffer with
+    // whatever the descriptor has available, up to the buffer length. Like string_source,
+    // it provides read_buffer(), so readers and cursors parse the buffer in place.
+
+    template <class CharT>
+    class basic_fd_source
+    {
+        static_assert(sizeof(CharT) == 1, "basic_fd_source requires a one byte character type");
+    public:
+        using value_type = CharT;
+        static constexpr std::size_t default_buffer_length = 16384;
+    private:
+        int fd_;
+        std::vector<CharT> buffer_;
+        std::size_t current_;
+        std::size_t end_;
+        std::size_t position_;
+        bool eof_;
+        std::error_code ec_;
+
+        // Noncopyable
+        basic_fd_source(const basic_fd_source&) = delete;
+        basic_fd_source& operator=(const basic_fd_source&) = delete;
+    public:
+        basic_fd_source()
+            : fd_(-1), current_(0), end_(0), position_(0), eof_(true)
+        {
+        }
+
+        explicit basic_fd_source(int fd, std::size_t buflen = default_buffer_length)
+            : fd_(fd), buffer_(buflen == 0 ? 1 : buflen), current_(0), end_(0), position_(0), eof_(false)
+        {
+        }
+
+        basic_fd_source(basic_fd_source&& other) noexcept
+            : fd_(-1), current_(0), end_(0), position_(0), eof_(true)
+        {
+            swap(other);
+        }
+
+        basic_fd_source& operator=(basic_fd_source&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        // Does not close the descriptor
+        ~basic_fd_source() noexcept = default;
+
+        bool eof() const
+        {
+            return eof_ && current_ == end_;
+        }
+
+        bool is_error() const
+        {
+            return static_cast<bool>(ec_);
+        }
+
+        // Set if a read failed
+        std::error_code error() const
+        {
+            return ec_;
+        }
+
+        std::size_t position() const
+        {
+            return position_;
+        }
+
+        int fd() const
+        {
+            return fd_;
+        }
+
+        character_result<value_type> get_character()
+        {
+            if (current_ == end_ && !fill())
+            {
+                return character_result<value_type>();
+            }
+            ++position_;
+            return character_result<value_type>(buffer_[current_++]);
+        }
+
+        character_result<value_type> peek_character()
+        {
+            if (current_ == end_ && !fill())
+            {
+                return character_result<value_type>();
+            }
+            return character_result<value_type>(buffer_[current_]);
+        }
+
+        void ignore(std::size_t count)
+        {
+            while (count > 0)
+            {
+                if (current_ == end_ && !fill())
+                {
+                    return;
+                }
+                std::size_t n = (std::min)(count, end_ - current_);
+                current_ += n;
+                position_ += n;
+                count -= n;
+            }
+        }
+
+        std::size_t read(value_type* p, std::size_t length)
+        {
+            std::size_t count = 0;
+            while (count < length)
+            {
+                if (current_ < end_)
+                {
+                    std::size_t n = (std::min)(length - count, end_ - current_);
+                    std::memcpy(p + count, buffer_.data() + current_, n*sizeof(value_type));
+                    current_ += n;
+                    count += n;
+                }
+                else if (length - count >= buffer_.size() && !eof_)
+                {
+                    // Large reads bypass the buffer
+                    std::ptrdiff_t n = detail::read_fd(fd_, p + count, length - count);
+                    if (n <= 0)
+                    {
+                        set_eof(n);
+                        break;
+                    }
+                    count += static_cast<std::size_t>(n);
+                }
+                else if (!fill())
+                {
+                    break;
+                }
+            }
+            position_ += count;
+            return count;
+        }
+
+        // Returns the buffered characters, reading more if there are none, and consumes them.
+        // Returns an empty span at end of file.
+        jsoncons::detail::span<const value_type> read_buffer()
+        {
+            if (current_ == end_)
+            {
+                fill();
+            }
+            const value_type* p = buffer_.data() + current_;
+            std::size_t length = end_ - current_;
+            current_ = end_;
+            position_ += length;
+            return jsoncons::detail::span<const value_type>(p, length);
+        }
+
+        void swap(basic_fd_source& other) noexcept
+        {
+            std::swap(fd_, other.fd_);
+            buffer_.swap(other.buffer_);
+            std::swap(current_, other.current_);
+            std::swap(end_, other.end_);
+            std::swap(position_, other.position_);
+            std::swap(eof_, other.eof_);
+            std::swap(ec_, other.ec_);
+        }
+    private:
+        bool fill()
+        {
+            current_ = 0;
+            end_ = 0;
+            if (eof_)
+            {
+                return false;
+            }
+            std::ptrdiff_t n = detail::read_fd(fd_, buffer_.data(), buffer_.size());
+            if (n <= 0)
+            {
+                set_eof(n);
+                return false;
+            }
+            end_ = static_cast<std::size_t>(n);
+            return true;
+        }
+
+        void set_eof(std::ptrdiff_t n)
+        {
+            if (n < 0)
+            {
+                ec_ = std::error_code(errno, std::system_category());
+            }
+            eof_ = true;
+        }
+    };
+
+    template <class CharT>
+    constexpr std::size_t basic_fd_source<CharT>::default_buffer_length;
+
+    using fd_source = basic_fd_source<char>;
+    using binary_fd_source = basic_fd_source<uint8_t>;
+
+} // namespace jsoncons
+
+#endif
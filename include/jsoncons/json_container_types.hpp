@@ -11,16 +11,19 @@
 #include <vector>
 #include <exception>
 #include <cstring>
+#include <cstdint>
 #include <algorithm> // std::sort, std::stable_sort, std::lower_bound, std::unique
 #include <utility>
 #include <initializer_list>
 #include <iterator> // std::iterator_traits
+#include <limits> // std::numeric_limits
 #include <memory> // std::allocator
 #include <utility> // std::move
 #include <cassert> // assert
 #include <type_traits> // std::enable_if
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/detail/buffered_vector.hpp>
 
 namespace jsoncons {
 
@@ -43,6 +46,11 @@ namespace jsoncons {
         using reference = typename std::iterator_traits<iterator>::reference;
         using const_reference = typename std::iterator_traits<const_iterator>::reference;
 
+        // Whether the elements can start out in storage allocated with the array, 
+        // see detail::buffered_container_node
+        using has_element_buffer = jsoncons::detail::is_buffered_vector<value_container_type>;
+        using buffer_element_type = value_type;
+
         using allocator_holder<allocator_type>::get_allocator;
 
         json_array()
@@ -104,6 +112,22 @@ namespace jsoncons {
               elements_(init,value_allocator_type(alloc))
         {
         }
+
+        json_array(jsoncons::detail::element_buffer<value_type> buffer, 
+                   const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              elements_(buffer,value_allocator_type(alloc))
+        {
+        }
+
+        json_array(jsoncons::detail::element_buffer<value_type> buffer, 
+                   const json_array& val, 
+                   const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              elements_(buffer,value_allocator_type(alloc))
+        {
+            elements_.assign(val.elements_.begin(), val.elements_.end());
+        }
         ~json_array() noexcept
         {
             destroy();
@@ -138,6 +162,8 @@ namespace jsoncons {
 
         std::size_t capacity() const {return elements_.capacity();}
 
+        std::size_t buffer_capacity() const {return elements_.buffer_capacity();}
+
         void clear() {elements_.clear();}
 
         void shrink_to_fit() 
@@ -280,6 +306,9 @@ namespace jsoncons {
 
         json_array& operator=(const json_array<Json>&) = delete;
 
+        // Uses elements_ as an explicit stack of the non-empty containers still to be
+        // destroyed, so that destroying a deeply nested value does not recurse. The
+        // objects' destroy() hand their containers to a json_array for the same reason.
         void destroy() noexcept
         {
             while (!elements_.empty())
@@ -520,6 +549,11 @@ namespace jsoncons {
         explicit preserve_key_order() = default; 
     };
 
+    struct hash_key_order
+    {
+        explicit hash_key_order() = default; 
+    };
+
     template <class KeyT,class Json,class Enable = void>
     class json_object
     {
@@ -547,6 +581,11 @@ namespace jsoncons {
         using iterator = typename key_value_container_type::iterator;
         using const_iterator = typename key_value_container_type::const_iterator;
 
+        // Whether the members can start out in storage allocated with the object, 
+        // see detail::buffered_container_node
+        using has_element_buffer = jsoncons::detail::is_buffered_vector<key_value_container_type>;
+        using buffer_element_type = key_value_type;
+
         using allocator_holder<allocator_type>::get_allocator;
 
         json_object()
@@ -595,6 +634,22 @@ namespace jsoncons {
         {
         }
 
+        json_object(jsoncons::detail::element_buffer<key_value_type> buffer, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(buffer,key_value_allocator_type(alloc))
+        {
+        }
+
+        json_object(jsoncons::detail::element_buffer<key_value_type> buffer, 
+                    const json_object& val, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(buffer,key_value_allocator_type(alloc))
+        {
+            members_.assign(val.members_.begin(), val.members_.end());
+        }
+
         template<class InputIt>
         json_object(InputIt first, InputIt last)
         {
@@ -681,6 +736,8 @@ namespace jsoncons {
 
         std::size_t capacity() const {return members_.capacity();}
 
+        std::size_t buffer_capacity() const {return members_.buffer_capacity();}
+
         void clear() {members_.clear();}
 
         void shrink_to_fit() 
@@ -1248,6 +1305,11 @@ namespace jsoncons {
         using iterator = typename key_value_container_type::iterator;
         using const_iterator = typename key_value_container_type::const_iterator;
 
+        // Whether the members can start out in storage allocated with the object, 
+        // see detail::buffered_container_node
+        using has_element_buffer = jsoncons::detail::is_buffered_vector<key_value_container_type>;
+        using buffer_element_type = key_value_type;
+
         using allocator_holder<allocator_type>::get_allocator;
 
         json_object()
@@ -1288,6 +1350,24 @@ namespace jsoncons {
         {
         }
 
+        json_object(jsoncons::detail::element_buffer<key_value_type> buffer, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(buffer,key_value_allocator_type(alloc)), 
+              index_(index_allocator_type(alloc))
+        {
+        }
+
+        json_object(jsoncons::detail::element_buffer<key_value_type> buffer, 
+                    const json_object& val, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(buffer,key_value_allocator_type(alloc)), 
+              index_(val.index_,index_allocator_type(alloc))
+        {
+            members_.assign(val.members_.begin(), val.members_.end());
+        }
+
         template<class InputIt>
         json_object(InputIt first, InputIt last)
         {
@@ -1397,6 +1477,7 @@ namespace jsoncons {
         void swap(json_object& val) noexcept
         {
             members_.swap(val.members_);
+            index_.swap(val.index_);
         }
 
         bool empty() const
@@ -1428,6 +1509,8 @@ namespace jsoncons {
 
         std::size_t capacity() const {return members_.capacity();}
 
+        std::size_t buffer_capacity() const {return members_.buffer_capacity();}
+
         void clear() 
         {
             members_.clear();
@@ -1979,18 +2062,9 @@ namespace jsoncons {
 
             const size_t offset = pos2 - pos1;
             const size_t n = index_.size() - offset;
-            for (std::size_t i = 0; i < index_.size(); ++i)
-            {
-                if (offset == index_.size())
-                {
-                    index_.erase(index_.begin()+i,index_.end());
-                    i += offset;
-                }
-                else if (index_[i] >= pos1 && index_[i] < pos2)
-                {
-                    index_.erase(index_.begin()+i);
-                }
-            }
+            index_.erase(std::remove_if(index_.begin(), index_.end(), 
+                                        [pos1,pos2](std::size_t i) {return i >= pos1 && i < pos2;}),
+                         index_.end());
             for (std::size_t i = 0; i < index_.size(); ++i)
             {
                 if (index_[i] >= pos2)
@@ -2014,6 +2088,807 @@ namespace jsoncons {
         }
     };
 
+    // Preserve order, with a hash index
+    template <class KeyT,class Json>
+    class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,hash_key_order>::value>::type> : 
+        public allocator_holder<typename Json::allocator_type>
+    {
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using char_type = typename Json::char_type;
+        using key_type = KeyT;
+        //using mapped_type = Json;
+        using string_view_type = typename Json::string_view_type;
+        using key_value_type = key_value<KeyT,Json>;
+    private:
+        using implementation_policy = typename Json::implementation_policy;
+        using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;                       
+        using key_value_container_type = typename implementation_policy::template sequence_container_type<key_value_type,key_value_allocator_type>;
+        typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::size_t> index_allocator_type;
+        using index_container_type = typename implementation_policy::template sequence_container_type<std::size_t,index_allocator_type>;
+
+        // Objects with no more members than this are searched linearly, and have no index
+        static constexpr std::size_t max_unindexed_size = 8;
+        static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+        // members_ are kept in insertion order. index_ is either empty or an open addressing 
+        // hash table with linear probing, its size a power of two and at most half full. 
+        // A slot holds a position in members_ plus one, or zero if the slot is empty.
+        key_value_container_type members_;
+        index_container_type index_;
+    public:
+        using iterator = typename key_value_container_type::iterator;
+        using const_iterator = typename key_value_container_type::const_iterator;
+
+        // Whether the members can start out in storage allocated with the object, 
+        // see detail::buffered_container_node
+        using has_element_buffer = jsoncons::detail::is_buffered_vector<key_value_container_type>;
+        using buffer_element_type = key_value_type;
+
+        using allocator_holder<allocator_type>::get_allocator;
+
+        json_object()
+        {
+        }
+        json_object(const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)), 
+              index_(index_allocator_type(alloc))
+        {
+        }
+
+        json_object(const json_object& val)
+            : allocator_holder<allocator_type>(val.get_allocator()), 
+              members_(val.members_),
+              index_(val.index_)
+        {
+        }
+
+        json_object(json_object&& val)
+            : allocator_holder<allocator_type>(val.get_allocator()), 
+              members_(std::move(val.members_)),
+              index_(std::move(val.index_))
+        {
+        }
+
+        json_object(const json_object& val, const allocator_type& alloc) 
+            : allocator_holder<allocator_type>(alloc), 
+              members_(val.members_,key_value_allocator_type(alloc)),
+              index_(val.index_,index_allocator_type(alloc))
+        {
+        }
+
+        json_object(json_object&& val,const allocator_type& alloc) 
+            : allocator_holder<allocator_type>(alloc), 
+              members_(std::move(val.members_),key_value_allocator_type(alloc)),
+              index_(std::move(val.index_),index_allocator_type(alloc))
+        {
+        }
+
+        json_object(jsoncons::detail::element_buffer<key_value_type> buffer, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(buffer,key_value_allocator_type(alloc)), 
+              index_(index_allocator_type(alloc))
+        {
+        }
+
+        json_object(jsoncons::detail::element_buffer<key_value_type> buffer, 
+                    const json_object& val, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(buffer,key_value_allocator_type(alloc)), 
+              index_(val.index_,index_allocator_type(alloc))
+        {
+            members_.assign(val.members_.begin(), val.members_.end());
+        }
+
+        template<class InputIt>
+        json_object(InputIt first, InputIt last)
+        {
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(get_key_value<KeyT,Json>()(*s));
+                index_back_if_unique();
+            }
+        }
+
+        template<class InputIt>
+        json_object(InputIt first, InputIt last, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)), 
+              index_(index_allocator_type(alloc))
+        {
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(get_key_value<KeyT,Json>()(*s));
+                index_back_if_unique();
+            }
+        }
+
+        json_object(std::initializer_list<std::pair<std::basic_string<char_type>,Json>> init, 
+                    const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)), 
+              index_(index_allocator_type(alloc))
+        {
+            members_.reserve(init.size());
+            for (auto& item : init)
+            {
+                insert_or_assign(item.first, item.second);
+            }
+        }
+
+        ~json_object() noexcept
+        {
+            destroy();
+        }
+
+        json_object& operator=(json_object&& val)
+        {
+            val.swap(*this);
+            return *this;
+        }
+
+        json_object& operator=(const json_object& val)
+        {
+            allocator_holder<allocator_type>::operator=(val.get_allocator());
+            members_ = val.members_;
+            index_ = val.index_;
+            return *this;
+        }
+
+        void swap(json_object& val) noexcept
+        {
+            members_.swap(val.members_);
+            index_.swap(val.index_);
+        }
+
+        bool empty() const
+        {
+            return members_.empty();
+        }
+
+        iterator begin()
+        {
+            return members_.begin();
+        }
+
+        iterator end()
+        {
+            return members_.end();
+        }
+
+        const_iterator begin() const
+        {
+            return members_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return members_.end();
+        }
+
+        std::size_t size() const {return members_.size();}
+
+        std::size_t capacity() const {return members_.capacity();}
+
+        std::size_t buffer_capacity() const {return members_.buffer_capacity();}
+
+        void clear() 
+        {
+            members_.clear();
+            index_.clear();
+        }
+
+        void shrink_to_fit() 
+        {
+            for (std::size_t i = 0; i < members_.size(); ++i)
+            {
+                members_[i].shrink_to_fit();
+            }
+            members_.shrink_to_fit();
+            if (index_.size() > 2*table_size_for(members_.size()))
+            {
+                build_index();
+            }
+            index_.shrink_to_fit();
+        }
+
+        void reserve(std::size_t n) 
+        {
+            members_.reserve(n);
+            if (n > max_unindexed_size && index_.size() < table_size_for(n))
+            {
+                rehash(table_size_for(n));
+            }
+        }
+
+        Json& at(std::size_t i) 
+        {
+            if (i >= members_.size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return members_[i].value();
+        }
+
+        const Json& at(std::size_t i) const 
+        {
+            if (i >= members_.size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return members_[i].value();
+        }
+
+        iterator find(const string_view_type& name) noexcept
+        {
+            std::size_t pos = find_position(name, members_.size());
+            return pos == npos ? members_.end() : members_.begin() + pos;
+        }
+
+        const_iterator find(const string_view_type& name) const noexcept
+        {
+            std::size_t pos = find_position(name, members_.size());
+            return pos == npos ? members_.end() : members_.begin() + pos;
+        }
+
+        void erase(const_iterator first, const_iterator last) 
+        {
+            std::size_t pos1 = first == members_.end() ? members_.size() : first - members_.begin();
+            std::size_t pos2 = last == members_.end() ? members_.size() : last - members_.begin();
+
+            if (pos1 < members_.size() && pos2 <= members_.size())
+            {
+    #if defined(JSONCONS_NO_ERASE_TAKING_CONST_ITERATOR)
+                iterator it1 = members_.begin() + (first - members_.begin());
+                iterator it2 = members_.begin() + (last - members_.begin());
+                members_.erase(it1,it2);
+    #else
+                members_.erase(first,last);
+    #endif
+                if (!index_.empty())
+                {
+                    build_index();
+                }
+            }
+        }
+
+        void erase(const string_view_type& name) 
+        {
+            std::size_t pos = find_position(name, members_.size());
+            if (pos != npos)
+            {
+                if (!index_.empty())
+                {
+                    erase_index_entry(pos);
+                }
+                members_.erase(members_.begin() + pos);
+            }
+        }
+
+        template<class InputIt, class Convert>
+        void insert(InputIt first, InputIt last, Convert convert)
+        {
+            std::size_t count = std::distance(first,last);
+            reserve(members_.size() + count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(convert(*s));
+                index_back_if_unique();
+            }
+        }
+
+        template<class InputIt, class Convert>
+        void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
+        {
+            insert(first, last, convert);
+        }
+
+        template <class T, class A=allocator_type>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,std::pair<iterator,bool>>::type
+        insert_or_assign(const string_view_type& name, T&& value)
+        {
+            std::size_t pos = find_position(name, members_.size());
+            if (pos == npos)
+            {
+                members_.emplace_back(key_type(name.begin(), name.end()), std::forward<T>(value));
+                index_inserted(members_.size()-1);
+                return std::make_pair(members_.end()-1,true);
+            }
+            else
+            {
+                auto it = members_.begin() + pos;
+                it->value(Json(std::forward<T>(value)));
+                return std::make_pair(it,false);
+            }
+        }
+
+        template <class T, class A=allocator_type>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,std::pair<iterator,bool>>::type
+        insert_or_assign(const string_view_type& name, T&& value)
+        {
+            std::size_t pos = find_position(name, members_.size());
+            if (pos == npos)
+            {
+                members_.emplace_back(key_type(name.begin(),name.end(),get_allocator()), 
+                                      std::forward<T>(value),get_allocator());
+                index_inserted(members_.size()-1);
+                return std::make_pair(members_.end()-1,true);
+            }
+            else
+            {
+                auto it = members_.begin() + pos;
+                it->value(Json(std::forward<T>(value),get_allocator()));
+                return std::make_pair(it,false);
+            }
+        }
+
+        template <class A=allocator_type, class T>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,iterator>::type 
+        insert_or_assign(iterator hint, const string_view_type& key, T&& value)
+        {
+            if (hint == members_.end())
+            {
+                auto result = insert_or_assign(key, std::forward<T>(value));
+                return result.first;
+            }
+            else
+            {
+                std::size_t pos = find_position(key, members_.size());
+                if (pos == npos)
+                {
+                    pos = hint - members_.begin();
+                    auto it = members_.emplace(hint, key_type(key.begin(), key.end()), std::forward<T>(value));
+                    index_inserted(pos);
+                    return it;
+                }
+                else
+                {
+                    auto it = members_.begin() + pos;
+                    it->value(Json(std::forward<T>(value)));
+                    return it;
+                }
+            }
+        }
+
+        template <class A=allocator_type, class T>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,iterator>::type 
+        insert_or_assign(iterator hint, const string_view_type& key, T&& value)
+        {
+            if (hint == members_.end())
+            {
+                auto result = insert_or_assign(key, std::forward<T>(value));
+                return result.first;
+            }
+            else
+            {
+                std::size_t pos = find_position(key, members_.size());
+                if (pos == npos)
+                {
+                    pos = hint - members_.begin();
+                    auto it = members_.emplace(hint, 
+                                               key_type(key.begin(),key.end(),get_allocator()), 
+                                               std::forward<T>(value),get_allocator());
+                    index_inserted(pos);
+                    return it;
+                }
+                else
+                {
+                    auto it = members_.begin() + pos;
+                    it->value(Json(std::forward<T>(value),get_allocator()));
+                    return it;
+                }
+            }
+        }
+
+        // merge
+
+        void merge(const json_object& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                try_emplace((*it).key(),(*it).value());
+            }
+        }
+
+        void merge(json_object&& source)
+        {
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                try_emplace((*it).key(),std::move((*it).value()));
+            }
+        }
+
+        void merge(iterator hint, const json_object& source)
+        {
+            std::size_t pos = hint - members_.begin();
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                hint = try_emplace(hint, (*it).key(),(*it).value());
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        void merge(iterator hint, json_object&& source)
+        {
+            std::size_t pos = hint - members_.begin();
+
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                hint = try_emplace(hint, (*it).key(), std::move((*it).value()));
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        // merge_or_update
+
+        void merge_or_update(const json_object& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                insert_or_assign((*it).key(),(*it).value());
+            }
+        }
+
+        void merge_or_update(json_object&& source)
+        {
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                insert_or_assign((*it).key(),std::move((*it).value()));
+            }
+        }
+
+        void merge_or_update(iterator hint, const json_object& source)
+        {
+            std::size_t pos = hint - members_.begin();
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                hint = insert_or_assign(hint, (*it).key(),(*it).value());
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        void merge_or_update(iterator hint, json_object&& source)
+        {
+            std::size_t pos = hint - members_.begin();
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                hint = insert_or_assign(hint, (*it).key(), std::move((*it).value()));
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        // try_emplace
+
+        template <class A=allocator_type, class... Args>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,std::pair<iterator,bool>>::type
+        try_emplace(const string_view_type& name, Args&&... args)
+        {
+            std::size_t pos = find_position(name, members_.size());
+            if (pos == npos)
+            {
+                members_.emplace_back(key_type(name.begin(), name.end()), std::forward<Args>(args)...);
+                index_inserted(members_.size()-1);
+                return std::make_pair(members_.end()-1,true);
+            }
+            else
+            {
+                return std::make_pair(members_.begin() + pos,false);
+            }
+        }
+
+        template <class A=allocator_type, class... Args>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,std::pair<iterator,bool>>::type
+        try_emplace(const string_view_type& key, Args&&... args)
+        {
+            std::size_t pos = find_position(key, members_.size());
+            if (pos == npos)
+            {
+                members_.emplace_back(key_type(key.begin(),key.end(), get_allocator()), 
+                                      std::forward<Args>(args)...);
+                index_inserted(members_.size()-1);
+                return std::make_pair(members_.end()-1,true);
+            }
+            else
+            {
+                return std::make_pair(members_.begin() + pos,false);
+            }
+        }
+     
+        template <class A=allocator_type, class ... Args>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,iterator>::type
+        try_emplace(iterator hint, const string_view_type& key, Args&&... args)
+        {
+            if (hint == members_.end())
+            {
+                auto result = try_emplace(key, std::forward<Args>(args)...);
+                return result.first;
+            }
+            else
+            {
+                std::size_t pos = find_position(key, members_.size());
+                if (pos == npos)
+                {
+                    pos = hint - members_.begin();
+                    auto it = members_.emplace(hint, key_type(key.begin(), key.end()), std::forward<Args>(args)...);
+                    index_inserted(pos);
+                    return it;
+                }
+                else
+                {
+                    return members_.begin() + pos;
+                }
+            }
+        }
+
+        template <class A=allocator_type, class ... Args>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,iterator>::type
+        try_emplace(iterator hint, const string_view_type& key, Args&&... args)
+        {
+            if (hint == members_.end())
+            {
+                auto result = try_emplace(key, std::forward<Args>(args)...);
+                return result.first;
+            }
+            else
+            {
+                std::size_t pos = find_position(key, members_.size());
+                if (pos == npos)
+                {
+                    pos = hint - members_.begin();
+                    auto it = members_.emplace(hint, 
+                                               key_type(key.begin(),key.end(), get_allocator()), 
+                                               std::forward<Args>(args)...);
+                    index_inserted(pos);
+                    return it;
+                }
+                else
+                {
+                    return members_.begin() + pos;
+                }
+            }
+        }
+
+        bool operator==(const json_object& rhs) const
+        {
+            return members_ == rhs.members_;
+        }
+     
+        bool operator<(const json_object& rhs) const
+        {
+            return members_ < rhs.members_;
+        }
+    private:
+
+        void destroy() noexcept
+        {
+            if (!members_.empty())
+            {
+                json_array<Json> temp(get_allocator());
+
+                for (auto&& kv : members_)
+                {
+                    if (kv.value().size() > 0)
+                    {
+                        temp.emplace_back(std::move(kv.value()));
+                    }
+                }
+            }
+        }
+
+        // FNV-1a
+        static std::size_t hash_key(const string_view_type& key) noexcept
+        {
+            uint64_t h = 14695981039346656037ULL;
+            for (auto c : key)
+            {
+                h ^= static_cast<uint64_t>(static_cast<typename std::make_unsigned<char_type>::type>(c));
+                h *= 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+        static std::size_t table_size_for(std::size_t count) noexcept
+        {
+            std::size_t n = 16;
+            while (n < 2*count)
+            {
+                n *= 2;
+            }
+            return n;
+        }
+
+        // Returns the position of the member with this key among the first count members, 
+        // or npos. Members at positions count and above are not yet in the index.
+        std::size_t find_position(const string_view_type& key, std::size_t count) const noexcept
+        {
+            if (index_.empty())
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    if (string_view_type(members_[i].key()) == key)
+                    {
+                        return i;
+                    }
+                }
+                return npos;
+            }
+            const std::size_t mask = index_.size() - 1;
+            for (std::size_t i = hash_key(key) & mask; index_[i] != 0; i = (i + 1) & mask)
+            {
+                if (string_view_type(members_[index_[i]-1].key()) == key)
+                {
+                    return index_[i]-1;
+                }
+            }
+            return npos;
+        }
+
+        void insert_index_slot(std::size_t pos)
+        {
+            const std::size_t mask = index_.size() - 1;
+            std::size_t i = hash_key(members_[pos].key()) & mask;
+            while (index_[i] != 0)
+            {
+                i = (i + 1) & mask;
+            }
+            index_[i] = pos + 1;
+        }
+
+        // Called after a member with a new key has been inserted at pos
+        void index_inserted(std::size_t pos)
+        {
+            if (index_.empty())
+            {
+                if (members_.size() > max_unindexed_size)
+                {
+                    build_index();
+                }
+                return;
+            }
+            if (pos + 1 != members_.size())
+            {
+                for (auto& slot : index_)
+                {
+                    if (slot > pos)
+                    {
+                        ++slot;
+                    }
+                }
+            }
+            if (2*members_.size() > index_.size())
+            {
+                rehash(2*index_.size());
+            }
+            else
+            {
+                insert_index_slot(pos);
+            }
+        }
+
+        // Indexes the last member, or removes it if its key is already present
+        void index_back_if_unique()
+        {
+            std::size_t pos = members_.size() - 1;
+            if (find_position(members_[pos].key(), pos) != npos)
+            {
+                members_.pop_back();
+            }
+            else
+            {
+                index_inserted(pos);
+            }
+        }
+
+        // Removes the slot of the member at pos, shifting back the entries that follow it 
+        // in its probe sequence, and renumbers the members after pos
+        void erase_index_entry(std::size_t pos)
+        {
+            const std::size_t mask = index_.size() - 1;
+            std::size_t i = hash_key(members_[pos].key()) & mask;
+            while (index_[i] != pos + 1)
+            {
+                i = (i + 1) & mask;
+            }
+            std::size_t j = i;
+            while (true)
+            {
+                j = (j + 1) & mask;
+                if (index_[j] == 0)
+                {
+                    break;
+                }
+                std::size_t k = hash_key(members_[index_[j]-1].key()) & mask;
+                // Move the entry at j into the hole at i unless its home slot k lies cyclically in (i,j]
+                if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j)))
+                {
+                    index_[i] = index_[j];
+                    i = j;
+                }
+            }
+            index_[i] = 0;
+            for (auto& slot : index_)
+            {
+                if (slot > pos + 1)
+                {
+                    --slot;
+                }
+            }
+        }
+
+        void rehash(std::size_t n)
+        {
+            index_.assign(n, 0);
+            for (std::size_t i = 0; i < members_.size(); ++i)
+            {
+                insert_index_slot(i);
+            }
+        }
+
+        void build_index()
+        {
+            if (members_.size() <= max_unindexed_size)
+            {
+                index_.clear();
+            }
+            else
+            {
+                rehash(table_size_for(members_.size()));
+            }
+        }
+    };
+
 } // namespace jsoncons
 
 #endif
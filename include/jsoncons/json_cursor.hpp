@@ -58,9 +58,9 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
                       const Allocator& alloc = Allocator(),
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
-         cursor_visitor_(accept_all),
+         cursor_visitor_(),
          buffer_(alloc),
          buffer_length_(default_max_buffer_length),
          eof_(false),
@@ -80,7 +80,7 @@ public:
                       const Allocator& alloc = Allocator(),
                       typename std::enable_if<std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
        : parser_(options, err_handler, alloc),
-         cursor_visitor_(accept_all),
+         cursor_visitor_(),
          buffer_(alloc),
          buffer_length_(0),
          eof_(false),
@@ -145,9 +145,9 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler,
                       std::error_code& ec,
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
-         cursor_visitor_(accept_all),
+         cursor_visitor_(),
          buffer_(alloc),
          buffer_length_(default_max_buffer_length),
          eof_(false),
@@ -168,7 +168,7 @@ public:
                       std::error_code& ec,
                       typename std::enable_if<std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
        : parser_(options, err_handler, alloc),
-         cursor_visitor_(accept_all),
+         cursor_visitor_(),
          buffer_(alloc),
          buffer_length_(0),
          eof_(false),
@@ -244,31 +244,111 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Scans for the end of the container without unescaping strings or converting numbers
+    void skip(std::error_code& ec) override
+    {
+        if (done())
+        {
+            return;
+        }
+        staj_event_type event_type = current().event_type();
+        if (event_type != staj_event_type::begin_object && event_type != staj_event_type::begin_array)
+        {
+            return;
+        }
+        parser_.restart();
+        while (!parser_.stopped())
+        {
+            if (parser_.source_exhausted())
+            {
+                if (!source_.eof())
+                {
+                    read_buffer(ec);
+                    if (ec) return;
+                }
+                else
+                {
+                    eof_ = true;
+                }
+            }
+            parser_.skip_some(cursor_visitor_, ec);
+            if (ec) return;
+        }
+    }
+
+    void read_batch(basic_staj_event_batch<CharT>& batch) override
+    {
+        std::error_code ec;
+        read_batch(batch, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // The parser puts the events after the current one in the batch, without stopping after each
+    void read_batch(basic_staj_event_batch<CharT>& batch, std::error_code& ec) override
+    {
+        if (cursor_visitor_.filtered())
+        {
+            basic_staj_cursor<CharT>::read_batch(batch, ec);
+            return;
+        }
+        batch.clear();
+        if (done() || batch.full())
+        {
+            return;
+        }
+        batch.push_back(current());
+        if (!batch.full())
+        {
+            basic_staj_batch_visitor<CharT> visitor(batch, cursor_visitor_);
+            read_next(visitor, ec);
+            if (ec || done())
+            {
+                return;
+            }
+        }
+        read_next(ec);
+    }
+
     void read_buffer(std::error_code& ec)
     {
-        buffer_.clear();
-        buffer_.resize(buffer_length_);
-        std::size_t count = source_.read(buffer_.data(), buffer_length_);
-        buffer_.resize(static_cast<std::size_t>(count));
-        if (buffer_.size() == 0)
+        auto s = source_reader<Src>::read_buffer(source_, buffer_, buffer_length_);
+        if (s.size() == 0)
         {
+            if (source_.is_error())
+            {
+                ec = json_errc::source_error;
+                return;
+            }
             eof_ = true;
         }
         else if (begin_)
         {
-            auto result = unicons::skip_bom(buffer_.begin(), buffer_.end());
+            auto result = unicons::skip_bom(s.begin(), s.end());
             if (result.ec != unicons::encoding_errc())
             {
                 ec = result.ec;
                 return;
             }
-            std::size_t offset = result.it - buffer_.begin();
-            parser_.update(buffer_.data()+offset,buffer_.size()-offset);
+            std::size_t offset = result.it - s.begin();
+            parser_.update(s.data()+offset,s.size()-offset);
             begin_ = false;
         }
         else
         {
-            parser_.update(buffer_.data(),buffer_.size());
+            parser_.update(s.data(),s.size());
         }
     }
 
@@ -356,7 +436,7 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
                       const Allocator& alloc = Allocator(),
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(filter),
          buffer_(alloc),
@@ -452,7 +532,7 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler,
                       std::error_code& ec,
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(filter),
          buffer_(alloc),
@@ -513,11 +593,6 @@ public:
 #endif
 private:
 
-    static bool accept_all(const basic_staj_event<CharT>&, const ser_context&) 
-    {
-        return true;
-    }
-
     void read_next(std::error_code& ec)
     {
         parser_.restart();
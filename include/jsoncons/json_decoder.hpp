@@ -15,6 +15,7 @@
 #include <utility> // std::move
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/key_pool.hpp>
 
 namespace jsoncons {
 
@@ -67,7 +68,10 @@ private:
 
     };
 
+    static constexpr std::size_t key_cache_size = 64;
+
     using temp_allocator_type = TempAllocator;
+    using key_pool_type = basic_key_pool<char_type>;
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<stack_item> stack_item_allocator_type;
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<structure_info> structure_info_allocator_type;
  
@@ -80,6 +84,9 @@ private:
     std::vector<stack_item,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
     bool is_valid_;
+    key_pool_type* key_pool_;
+    // Recently interned keys, so that repeated keys usually don't lock the pool
+    std::vector<key_type> key_cache_;
 
 public:
     json_decoder(const temp_allocator_type& temp_alloc = temp_allocator_type())
@@ -89,7 +96,8 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
-          is_valid_(false) 
+          is_valid_(false),
+          key_pool_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -104,7 +112,8 @@ public:
           name_(result_allocator_),
           item_stack_(),
           structure_stack_(),
-          is_valid_(false)
+          is_valid_(false),
+          key_pool_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -120,13 +129,33 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
-          is_valid_(false)
+          is_valid_(false),
+          key_pool_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
         structure_stack_.emplace_back(structure_type::root_t, 0);
     }
 
+    // Member names are interned in pool, which must outlive the decoder
+    json_decoder(key_pool_type& pool,
+                 const temp_allocator_type& temp_alloc = temp_allocator_type())
+        : result_allocator_(result_allocator_type()),
+          temp_allocator_(temp_alloc),
+          result_(),
+          name_(result_allocator_),
+          item_stack_(temp_allocator_),
+          structure_stack_(temp_allocator_),
+          is_valid_(false),
+          key_pool_(std::addressof(pool)),
+          key_cache_(key_cache_size)
+    {
+        static_assert(is_interned_key<key_type>::value, "Interning keys requires a Json type with an interned_key_policy");
+        item_stack_.reserve(1000);
+        structure_stack_.reserve(100);
+        structure_stack_.emplace_back(structure_type::root_t, 0);
+    }
+
     void reset()
     {
         is_valid_ = false;
@@ -168,7 +197,7 @@ private:
             item_stack_.clear();
             is_valid_ = false;
         }
-        item_stack_.emplace_back(std::forward<key_type>(name_), json_object_arg, tag, result_allocator_);
+        push_container(json_object_arg, tag, jsoncons::detail::is_stateless<result_allocator_type>());
         structure_stack_.emplace_back(structure_type::object_t, item_stack_.size()-1);
         return true;
     }
@@ -180,14 +209,18 @@ private:
         const size_t structure_index = structure_stack_.back().container_index_;
         JSONCONS_ASSERT(item_stack_.size() > structure_index);
         const size_t count = item_stack_.size() - (structure_index + 1);
-        auto first = item_stack_.begin() + (structure_index+1);
-        auto last = first + count;
-        item_stack_[structure_index].value_.object_value().insert(
-            std::make_move_iterator(first),
-            std::make_move_iterator(last),
-            [](stack_item&& val){return key_value_type(std::move(val.name_), std::move(val.value_));}
-        );
-        item_stack_.erase(item_stack_.begin()+structure_index+1, item_stack_.end());
+        if (count > 0)
+        {
+            auto first = item_stack_.begin() + (structure_index+1);
+            auto last = first + count;
+            item_stack_[structure_index].value_.reserve(count);
+            item_stack_[structure_index].value_.object_value().insert(
+                std::make_move_iterator(first),
+                std::make_move_iterator(last),
+                [](stack_item&& val){return key_value_type(std::move(val.name_), std::move(val.value_));}
+            );
+            item_stack_.erase(item_stack_.begin()+structure_index+1, item_stack_.end());
+        }
         structure_stack_.pop_back();
         if (structure_stack_.back().type_ == structure_type::root_t)
         {
@@ -206,7 +239,7 @@ private:
             item_stack_.clear();
             is_valid_ = false;
         }
-        item_stack_.emplace_back(std::forward<key_type>(name_), json_array_arg, tag, result_allocator_);
+        push_container(json_array_arg, tag, jsoncons::detail::is_stateless<result_allocator_type>());
         structure_stack_.emplace_back(structure_type::array_t, item_stack_.size()-1);
         return true;
     }
@@ -246,9 +279,50 @@ private:
         return true;
     }
 
+    // With a stateless allocator, a container starts out as an empty object or array, 
+    // which needs no allocation, and is only allocated if it has members or elements
+    void push_container(json_object_arg_t, semantic_tag tag, std::true_type)
+    {
+        item_stack_.emplace_back(std::forward<key_type>(name_), tag);
+    }
+
+    void push_container(json_object_arg_t, semantic_tag tag, std::false_type)
+    {
+        item_stack_.emplace_back(std::forward<key_type>(name_), json_object_arg, tag, result_allocator_);
+    }
+
+    void push_container(json_array_arg_t, semantic_tag tag, std::true_type)
+    {
+        item_stack_.emplace_back(std::forward<key_type>(name_), json_array_arg, tag);
+    }
+
+    void push_container(json_array_arg_t, semantic_tag tag, std::false_type)
+    {
+        item_stack_.emplace_back(std::forward<key_type>(name_), json_array_arg, tag, result_allocator_);
+    }
+
+    key_type make_key(const string_view_type& name, std::false_type)
+    {
+        return key_type(name.data(),name.length(),result_allocator_);
+    }
+
+    key_type make_key(const string_view_type& name, std::true_type)
+    {
+        if (key_pool_ == nullptr)
+        {
+            return key_type(name.data(),name.length(),result_allocator_);
+        }
+        key_type& cached = key_cache_[key_pool_type::hash_key(name) & (key_cache_size-1)];
+        if (!(cached == name))
+        {
+            cached = key_pool_->template intern<typename key_type::allocator_type>(name);
+        }
+        return cached;
+    }
+
     bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
-        name_ = key_type(name.data(),name.length(),result_allocator_);
+        name_ = make_key(name, is_interned_key<key_type>());
         return true;
     }
 
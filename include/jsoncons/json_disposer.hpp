@@ -0,0 +1,132 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_DISPOSER_HPP
+#define JSONCONS_JSON_DISPOSER_HPP
+
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <utility> // std::move
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+    // Destroys values handed to it on a background thread. dispose() moves the value
+    // into a queue, which costs the calling thread a 16 byte move and, at most,
+    // an amortized push_back. The worker destroys the queued values in batches.
+    // Values must have allocators that may be used from another thread.
+
+    template <class Json>
+    class json_disposer
+    {
+    public:
+        using value_type = Json;
+    private:
+        std::vector<value_type> queue_;
+        std::mutex mutex_;
+        std::condition_variable work_cv_;
+        std::condition_variable idle_cv_;
+        std::size_t pending_;
+        bool stop_;
+        std::thread worker_;
+
+        // Noncopyable and nonmoveable
+        json_disposer(const json_disposer&) = delete;
+        json_disposer& operator=(const json_disposer&) = delete;
+    public:
+        json_disposer()
+            : pending_(0), stop_(false)
+        {
+            worker_ = std::thread([this]() {run();});
+        }
+
+        // Destroys the values still queued, then stops the worker
+        ~json_disposer() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            work_cv_.notify_one();
+            worker_.join();
+        }
+
+        void dispose(value_type&& val)
+        {
+            if (!needs_disposal(val))
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.push_back(std::move(val));
+                ++pending_;
+            }
+            work_cv_.notify_one();
+        }
+
+        // Blocks until every value disposed so far has been destroyed
+        void flush()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_cv_.wait(lock, [this]() {return pending_ == 0;});
+        }
+
+        std::size_t pending()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return pending_;
+        }
+
+    private:
+        // Values without heap storage are cheaper to destroy in place than to queue
+        static bool needs_disposal(const value_type& val) noexcept
+        {
+            switch (val.storage())
+            {
+                case storage_kind::long_string_value:
+                case storage_kind::byte_string_value:
+                case storage_kind::array_value:
+                case storage_kind::object_value:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        void run()
+        {
+            std::vector<value_type> batch;
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    work_cv_.wait(lock, [this]() {return stop_ || !queue_.empty();});
+                    if (queue_.empty())
+                    {
+                        return;
+                    }
+                    // the emptied batch keeps its capacity, so after warming up neither
+                    // side allocates
+                    batch.swap(queue_);
+                }
+                std::size_t count = batch.size();
+                batch.clear();
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    pending_ -= count;
+                }
+                idle_cv_.notify_all();
+            }
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_DISPOSER_HPP
@@ -23,6 +23,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/sink.hpp>
 #include <jsoncons/detail/write_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
 
 namespace jsoncons { 
 namespace detail {
@@ -39,117 +40,110 @@ namespace detail {
         return cp >= 0x80;
     }
 
+    template <class CharT, class Sink>
+    void append_escaped_codepoint(uint32_t cp, Sink& sink)
+    {
+        CharT buf[6] = {'\\','u',
+                        jsoncons::detail::to_hex_character(cp >> 12 & 0x000F),
+                        jsoncons::detail::to_hex_character(cp >> 8 & 0x000F),
+                        jsoncons::detail::to_hex_character(cp >> 4 & 0x000F),
+                        jsoncons::detail::to_hex_character(cp & 0x000F)};
+        sink.append(buf, 6);
+    }
+
+    // Runs of characters that need no escaping are found with find_escape_character
+    // and written with one append
     template <class CharT, class Sink>
     std::size_t escape_string(const CharT* s, std::size_t length,
                          bool escape_all_non_ascii, bool escape_solidus,
                          Sink& sink)
     {
         std::size_t count = 0;
-        const CharT* begin = s;
+        const CharT* it = s;
         const CharT* end = s + length;
-        for (const CharT* it = begin; it != end; ++it)
+        while (it != end)
         {
+            const CharT* run_end = find_escape_character(it, end, escape_all_non_ascii, escape_solidus);
+            if (run_end != it)
+            {
+                sink.append(it, static_cast<std::size_t>(run_end - it));
+                count += static_cast<std::size_t>(run_end - it);
+                it = run_end;
+                if (it == end)
+                {
+                    break;
+                }
+            }
+
             CharT c = *it;
+            CharT escaped = 0;
             switch (c)
             {
                 case '\\':
-                    sink.push_back('\\');
-                    sink.push_back('\\');
-                    count += 2;
+                    escaped = '\\';
                     break;
                 case '"':
-                    sink.push_back('\\');
-                    sink.push_back('\"');
-                    count += 2;
+                    escaped = '\"';
                     break;
                 case '\b':
-                    sink.push_back('\\');
-                    sink.push_back('b');
-                    count += 2;
+                    escaped = 'b';
                     break;
                 case '\f':
-                    sink.push_back('\\');
-                    sink.push_back('f');
-                    count += 2;
+                    escaped = 'f';
                     break;
                 case '\n':
-                    sink.push_back('\\');
-                    sink.push_back('n');
-                    count += 2;
+                    escaped = 'n';
                     break;
                 case '\r':
-                    sink.push_back('\\');
-                    sink.push_back('r');
-                    count += 2;
+                    escaped = 'r';
                     break;
                 case '\t':
-                    sink.push_back('\\');
-                    sink.push_back('t');
-                    count += 2;
+                    escaped = 't';
                     break;
                 default:
                     if (escape_solidus && c == '/')
                     {
-                        sink.push_back('\\');
-                        sink.push_back('/');
-                        count += 2;
-                    }
-                    else if (is_control_character(c) || escape_all_non_ascii)
-                    {
-                        // convert utf8 to codepoint
-                        unicons::sequence_generator<const CharT*> g(it, end, unicons::conv_flags::strict);
-                        if (g.done() || g.status() != unicons::conv_errc())
-                        {
-                            JSONCONS_THROW(ser_error(json_errc::illegal_codepoint));
-                        }
-                        uint32_t cp = g.get().codepoint();
-                        it += (g.get().length() - 1);
-                        if (is_non_ascii_codepoint(cp) || is_control_character(c))
-                        {
-                            if (cp > 0xFFFF)
-                            {
-                                cp -= 0x10000;
-                                uint32_t first = (cp >> 10) + 0xD800;
-                                uint32_t second = ((cp & 0x03FF) + 0xDC00);
-
-                                sink.push_back('\\');
-                                sink.push_back('u');
-                                sink.push_back(jsoncons::detail::to_hex_character(first >> 12 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(first >> 8 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(first >> 4 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(first & 0x000F));
-                                sink.push_back('\\');
-                                sink.push_back('u');
-                                sink.push_back(jsoncons::detail::to_hex_character(second >> 12 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(second >> 8 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(second >> 4 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(second & 0x000F));
-                                count += 12;
-                            }
-                            else
-                            {
-                                sink.push_back('\\');
-                                sink.push_back('u');
-                                sink.push_back(jsoncons::detail::to_hex_character(cp >> 12 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(cp >> 8 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(cp >> 4 & 0x000F));
-                                sink.push_back(jsoncons::detail::to_hex_character(cp & 0x000F));
-                                count += 6;
-                            }
-                        }
-                        else
-                        {
-                            sink.push_back(c);
-                            ++count;
-                        }
-                    }
-                    else
-                    {
-                        sink.push_back(c);
-                        ++count;
+                        escaped = '/';
                     }
                     break;
             }
+            if (escaped != 0)
+            {
+                CharT buf[2] = {'\\', escaped};
+                sink.append(buf, 2);
+                count += 2;
+                ++it;
+                continue;
+            }
+
+            // A control character, or a non-ASCII character when escape_all_non_ascii
+            unicons::sequence_generator<const CharT*> g(it, end, unicons::conv_flags::strict);
+            if (g.done() || g.status() != unicons::conv_errc())
+            {
+                JSONCONS_THROW(ser_error(json_errc::illegal_codepoint));
+            }
+            uint32_t cp = g.get().codepoint();
+            it += g.get().length();
+            if (is_non_ascii_codepoint(cp) || is_control_character(cp))
+            {
+                if (cp > 0xFFFF)
+                {
+                    cp -= 0x10000;
+                    append_escaped_codepoint<CharT>((cp >> 10) + 0xD800, sink);
+                    append_escaped_codepoint<CharT>((cp & 0x03FF) + 0xDC00, sink);
+                    count += 12;
+                }
+                else
+                {
+                    append_escaped_codepoint<CharT>(cp, sink);
+                    count += 6;
+                }
+            }
+            else
+            {
+                sink.push_back(c);
+                ++count;
+            }
         }
         return count;
     }
@@ -191,6 +185,8 @@ namespace detail {
     template<class CharT,class Sink=jsoncons::stream_sink<CharT>,class Allocator=std::allocator<char>>
     class basic_json_encoder final : public basic_json_visitor<CharT>
     {
+        template <class Visitor> friend class static_json_visitor;
+
         static const std::array<CharT, 4>& null_k()
         {
             static constexpr std::array<CharT,4> k{'n','u','l','l'};
@@ -1037,6 +1033,8 @@ namespace detail {
     template<class CharT,class Sink=jsoncons::stream_sink<CharT>,class Allocator=std::allocator<char>>
     class basic_compact_json_encoder final : public basic_json_visitor<CharT>
     {
+        template <class Visitor> friend class static_json_visitor;
+
         static const std::array<CharT, 4>& null_k()
         {
             static constexpr std::array<CharT,4> k{'n','u','l','l'};
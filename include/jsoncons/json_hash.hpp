@@ -0,0 +1,328 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_HASH_HPP
+#define JSONCONS_JSON_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <functional> // std::hash
+#include <memory> // std::addressof
+#include <unordered_map>
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // murmur3 finalizer
+    inline uint64_t hash_mix(uint64_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    inline uint64_t hash_combine(uint64_t seed, uint64_t value) noexcept
+    {
+        return hash_mix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+    }
+
+    // Consumes eight bytes a step. Results depend on the byte order of the platform.
+    inline uint64_t hash_bytes(const void* data, std::size_t length, uint64_t seed) noexcept
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        uint64_t h = seed ^ (static_cast<uint64_t>(length) * 0x9e3779b97f4a7c15ULL);
+        while (length >= 8)
+        {
+            uint64_t word;
+            std::memcpy(&word, p, 8);
+            h = (h ^ hash_mix(word)) * 0x100000001b3ULL;
+            p += 8;
+            length -= 8;
+        }
+        if (length > 0)
+        {
+            uint64_t word = 0;
+            std::memcpy(&word, p, length);
+            h = (h ^ hash_mix(word)) * 0x100000001b3ULL;
+        }
+        return hash_mix(h);
+    }
+
+    enum class hash_seed : uint64_t
+    {
+        null_value = 0x6a09e667f3bcc908ULL,
+        bool_value = 0xbb67ae8584caa73bULL,
+        number_value = 0x3c6ef372fe94f82bULL,
+        string_value = 0xa54ff53a5f1d36f1ULL,
+        byte_string_value = 0x510e527fade682d1ULL,
+        array_value = 0x9b05688c2b3e6c1fULL,
+        object_value = 0x1f83d9abfb41bd6bULL
+    };
+
+    struct no_json_hash_cache
+    {
+        bool find(const void*, uint64_t&) const noexcept
+        {
+            return false;
+        }
+        void insert(const void*, uint64_t) noexcept
+        {
+        }
+    };
+
+    // Hashes a value that is not a non-empty array or object, or whose hash is cached.
+    // Returns false if the elements of the value have to be visited.
+    template <class Json,class Cache>
+    bool hash_json_value(const Json& val, Cache& cache, uint64_t& h)
+    {
+        switch (val.type())
+        {
+            case json_type::null_value:
+                h = static_cast<uint64_t>(hash_seed::null_value);
+                return true;
+            case json_type::bool_value:
+                h = hash_combine(static_cast<uint64_t>(hash_seed::bool_value), val.as_bool() ? 1 : 0);
+                return true;
+            case json_type::int64_value:
+            case json_type::uint64_value:
+            case json_type::half_value:
+            case json_type::double_value:
+            {
+                double d = val.as_double();
+                if (d == 0)
+                {
+                    d = 0; // -0.0 == 0.0
+                }
+                uint64_t bits;
+                std::memcpy(&bits, &d, sizeof(double));
+                h = hash_combine(static_cast<uint64_t>(hash_seed::number_value), bits);
+                return true;
+            }
+            case json_type::string_value:
+            {
+                auto sv = val.as_string_view();
+                h = hash_bytes(sv.data(), sv.size()*sizeof(typename Json::char_type),
+                               static_cast<uint64_t>(hash_seed::string_value));
+                return true;
+            }
+            case json_type::byte_string_value:
+            {
+                auto bytes = val.as_byte_string_view();
+                h = hash_bytes(bytes.data(), bytes.size(), static_cast<uint64_t>(hash_seed::byte_string_value));
+                return true;
+            }
+            case json_type::array_value:
+                if (val.empty())
+                {
+                    h = hash_combine(static_cast<uint64_t>(hash_seed::array_value), 0);
+                    return true;
+                }
+                return cache.find(&val, h);
+            case json_type::object_value:
+                if (val.empty())
+                {
+                    h = hash_combine(static_cast<uint64_t>(hash_seed::object_value), 0);
+                    return true;
+                }
+                return cache.find(&val, h);
+            default:
+                h = 0;
+                return true;
+        }
+    }
+
+    // Equal values (basic_json::operator==) have equal hashes. Tags are ignored,
+    // integers and doubles that compare equal are hashed as the same double, and
+    // the members of an object are combined independently of their order.
+    //
+    // Nested arrays and objects are visited with an explicit stack, so deeply nested
+    // documents do not exhaust the call stack.
+    template <class Json,class Cache>
+    uint64_t hash_json(const Json& val, Cache& cache)
+    {
+        struct frame
+        {
+            const Json* val;
+            typename Json::const_array_iterator array_it;
+            typename Json::const_array_iterator array_end;
+            typename Json::const_object_iterator object_it;
+            typename Json::const_object_iterator object_end;
+            uint64_t h;
+            uint64_t key_hash;
+
+            explicit frame(const Json& v)
+                : val(std::addressof(v)), h(0), key_hash(0)
+            {
+                if (v.type() == json_type::array_value)
+                {
+                    auto range = v.array_range();
+                    array_it = range.begin();
+                    array_end = range.end();
+                    h = static_cast<uint64_t>(hash_seed::array_value);
+                }
+                else
+                {
+                    auto range = v.object_range();
+                    object_it = range.begin();
+                    object_end = range.end();
+                }
+            }
+        };
+
+        uint64_t h = 0;
+        if (hash_json_value(val, cache, h))
+        {
+            return h;
+        }
+
+        std::vector<frame> stack;
+        stack.emplace_back(val);
+        for (;;)
+        {
+            frame& top = stack.back();
+            const Json* item = nullptr;
+            if (top.val->type() == json_type::array_value)
+            {
+                if (top.array_it != top.array_end)
+                {
+                    item = std::addressof(*top.array_it);
+                    ++top.array_it;
+                }
+            }
+            else if (top.object_it != top.object_end)
+            {
+                top.key_hash = hash_bytes(top.object_it->key().data(), top.object_it->key().size()*sizeof(typename Json::char_type),
+                                          static_cast<uint64_t>(hash_seed::string_value));
+                item = std::addressof(top.object_it->value());
+                ++top.object_it;
+            }
+
+            if (item != nullptr)
+            {
+                if (!hash_json_value(*item, cache, h))
+                {
+                    stack.emplace_back(*item);
+                    continue;
+                }
+            }
+            else
+            {
+                // All elements visited
+                if (top.val->type() == json_type::array_value)
+                {
+                    h = hash_combine(top.h, top.val->size());
+                }
+                else
+                {
+                    h = hash_combine(static_cast<uint64_t>(hash_seed::object_value), top.h ^ top.val->size());
+                }
+                cache.insert(top.val, h);
+                stack.pop_back();
+                if (stack.empty())
+                {
+                    return h;
+                }
+            }
+
+            frame& parent = stack.back();
+            if (parent.val->type() == json_type::array_value)
+            {
+                parent.h = hash_combine(parent.h, h);
+            }
+            else
+            {
+                parent.h += hash_mix(hash_combine(parent.key_hash, h));
+            }
+        }
+    }
+
+    inline std::size_t fold_hash(uint64_t h) noexcept
+    {
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+
+} // namespace detail
+
+    // Structural hash consistent with basic_json::operator==
+    template <class Json>
+    struct json_hash
+    {
+        std::size_t operator()(const Json& val) const noexcept
+        {
+            detail::no_json_hash_cache cache;
+            return detail::fold_hash(detail::hash_json(val, cache));
+        }
+    };
+
+    // Remembers the hashes of the arrays and objects it has hashed, by address, so that
+    // hashing a value again, or a document that contains it, does not revisit its
+    // elements. The values must not be modified, moved or destroyed while their hashes
+    // are cached, call clear() first.
+    template <class Json>
+    class json_hash_cache
+    {
+        std::unordered_map<const void*,uint64_t> hashes_;
+
+        struct cache_ref
+        {
+            std::unordered_map<const void*,uint64_t>& hashes;
+
+            bool find(const void* p, uint64_t& h) const
+            {
+                auto it = hashes.find(p);
+                if (it == hashes.end())
+                {
+                    return false;
+                }
+                h = it->second;
+                return true;
+            }
+            void insert(const void* p, uint64_t h)
+            {
+                hashes.emplace(p, h);
+            }
+        };
+    public:
+        std::size_t operator()(const Json& val)
+        {
+            cache_ref cache{hashes_};
+            return detail::fold_hash(detail::hash_json(val, cache));
+        }
+
+        std::size_t size() const noexcept
+        {
+            return hashes_.size();
+        }
+
+        void clear() noexcept
+        {
+            hashes_.clear();
+        }
+    };
+
+} // namespace jsoncons
+
+namespace std {
+
+    template <class CharT,class ImplementationPolicy,class Allocator>
+    struct hash<jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>>
+    {
+        std::size_t operator()(const jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>& val) const noexcept
+        {
+            return jsoncons::json_hash<jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>>()(val);
+        }
+    };
+
+} // namespace std
+
+#endif // JSONCONS_JSON_HASH_HPP
@@ -0,0 +1,406 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_LINES_READER_HPP
+#define JSONCONS_JSON_LINES_READER_HPP
+
+#include <memory> // std::allocator, std::unique_ptr, std::shared_ptr
+#include <string>
+#include <vector>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <exception>
+#include <system_error>
+#include <utility> // std::move
+#include <jsoncons/json.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/detail/thread_pool.hpp>
+
+namespace jsoncons {
+
+// Reads newline delimited JSON (JSON Lines, NDJSON). The input is split at line
+// boundaries into chunks, the chunks are parsed on a pool of threads, each thread
+// with its own parser and decoder, and the documents are returned in input order.
+// Lines that contain only whitespace are skipped.
+
+template<class Json,class Src=jsoncons::stream_source<typename Json::char_type>,class TempAllocator=std::allocator<char>>
+class basic_json_lines_reader
+{
+public:
+    using value_type = Json;
+    using char_type = typename Json::char_type;
+    using source_type = Src;
+    using temp_allocator_type = TempAllocator;
+private:
+    using parser_type = basic_json_parser<char_type,TempAllocator>;
+
+    static constexpr std::size_t default_chunk_length = 1024*1024;
+    static constexpr std::size_t default_max_chunks_in_flight_per_thread = 2;
+
+    struct line_result
+    {
+        Json value;
+        std::error_code ec;
+        std::size_t line;
+        std::size_t column;
+    };
+
+    struct chunk
+    {
+        std::vector<char_type> text;
+        std::vector<line_result> results;
+        std::size_t line_count;
+        std::promise<void> done;
+
+        chunk()
+            : line_count(0)
+        {
+        }
+    };
+
+    struct worker
+    {
+        parser_type parser;
+        json_decoder<Json,TempAllocator> decoder;
+
+        worker(const basic_json_decode_options<char_type>& options,
+               std::function<bool(json_errc,const ser_context&)> err_handler,
+               const TempAllocator& alloc)
+            : parser(options, err_handler, alloc), decoder(alloc)
+        {
+        }
+    };
+
+    source_type source_;
+    std::size_t chunk_length_;
+    std::vector<std::unique_ptr<worker>> workers_;
+    std::vector<char_type> pending_;
+    std::deque<std::pair<std::shared_ptr<chunk>,std::future<void>>> in_flight_;
+    std::shared_ptr<chunk> current_;
+    std::size_t next_result_;
+    std::size_t base_line_;
+    std::size_t line_;
+    std::size_t column_;
+    bool begin_;
+    bool eof_;
+    std::mutex err_handler_mutex_;
+    // Declared last so that it is destroyed first, discarding queued chunks and 
+    // joining the threads while the workers and running chunks are still alive
+    jsoncons::detail::thread_pool pool_;
+
+    // Noncopyable and nonmoveable
+    basic_json_lines_reader(const basic_json_lines_reader&) = delete;
+    basic_json_lines_reader& operator=(const basic_json_lines_reader&) = delete;
+
+public:
+    template <class Source>
+    explicit basic_json_lines_reader(Source&& source,
+                                     std::size_t num_threads = 0,
+                                     const TempAllocator& alloc = TempAllocator())
+        : basic_json_lines_reader(std::forward<Source>(source),
+                                  basic_json_decode_options<char_type>(),
+                                  default_json_parsing(),
+                                  num_threads,
+                                  alloc)
+    {
+    }
+
+    template <class Source>
+    basic_json_lines_reader(Source&& source,
+                            const basic_json_decode_options<char_type>& options,
+                            std::size_t num_threads = 0,
+                            const TempAllocator& alloc = TempAllocator())
+        : basic_json_lines_reader(std::forward<Source>(source),
+                                  options,
+                                  default_json_parsing(),
+                                  num_threads,
+                                  alloc)
+    {
+    }
+
+    template <class Source>
+    basic_json_lines_reader(Source&& source,
+                            const basic_json_decode_options<char_type>& options,
+                            std::function<bool(json_errc,const ser_context&)> err_handler,
+                            std::size_t num_threads = 0,
+                            const TempAllocator& alloc = TempAllocator())
+        : source_(std::forward<Source>(source)),
+          chunk_length_(default_chunk_length),
+          next_result_(0),
+          base_line_(1),
+          line_(0),
+          column_(0),
+          begin_(true),
+          eof_(false),
+          pool_(num_threads)
+    {
+        // The workers share err_handler, calls to it are serialized
+        std::mutex* mutex = &err_handler_mutex_;
+        std::function<bool(json_errc,const ser_context&)> serialized_err_handler = 
+            [mutex, err_handler](json_errc code, const ser_context& context) -> bool
+            {
+                std::lock_guard<std::mutex> lock(*mutex);
+                return err_handler(code, context);
+            };
+        workers_.reserve(pool_.size());
+        for (std::size_t i = 0; i < pool_.size(); ++i)
+        {
+            workers_.emplace_back(new worker(options, serialized_err_handler, alloc));
+        }
+    }
+
+    std::size_t num_threads() const
+    {
+        return pool_.size();
+    }
+
+    std::size_t chunk_length() const
+    {
+        return chunk_length_;
+    }
+
+    // Chunks are extended to the end of the line, so this is a lower bound
+    void chunk_length(std::size_t length)
+    {
+        chunk_length_ = length == 0 ? 1 : length;
+    }
+
+    // Line and column of the last document read, or of the error in it
+    std::size_t line() const
+    {
+        return line_;
+    }
+
+    std::size_t column() const
+    {
+        return column_;
+    }
+
+    bool read_next(Json& value)
+    {
+        std::error_code ec;
+        bool more = read_next(value, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,line_,column_));
+        }
+        return more;
+    }
+
+    // Returns false when there are no more documents. For a line that fails to parse,
+    // returns true and sets ec, reading may continue with the next line.
+    // A source error sets ec and returns false.
+    bool read_next(Json& value, std::error_code& ec)
+    {
+        for (;;)
+        {
+            if (current_ && next_result_ < current_->results.size())
+            {
+                line_result& result = current_->results[next_result_++];
+                line_ = base_line_ + result.line;
+                column_ = result.column;
+                if (result.ec)
+                {
+                    ec = result.ec;
+                }
+                else
+                {
+                    value = std::move(result.value);
+                }
+                return true;
+            }
+            if (current_)
+            {
+                base_line_ += current_->line_count;
+                current_.reset();
+            }
+            fill_pipeline(ec);
+            if (ec) return false;
+            if (in_flight_.empty())
+            {
+                return false;
+            }
+            current_ = std::move(in_flight_.front().first);
+            std::future<void> ready = std::move(in_flight_.front().second);
+            in_flight_.pop_front();
+            next_result_ = 0;
+            ready.get(); // rethrows an exception thrown while parsing the chunk
+        }
+    }
+
+private:
+
+    void fill_pipeline(std::error_code& ec)
+    {
+        const std::size_t max_in_flight = pool_.size()*default_max_chunks_in_flight_per_thread;
+        while (!eof_ && in_flight_.size() < max_in_flight)
+        {
+            std::shared_ptr<chunk> c = std::make_shared<chunk>();
+            read_chunk(c->text, ec);
+            if (ec) return;
+            if (c->text.empty())
+            {
+                break;
+            }
+            std::future<void> ready = c->done.get_future();
+            in_flight_.emplace_back(c, std::move(ready));
+            pool_.submit([this, c](std::size_t index) {run(*c, *workers_[index]);});
+        }
+    }
+
+    // Reads at least chunk_length_ characters up to and including a newline,
+    // or the rest of the input, carrying a partial last line over to the next chunk
+    void read_chunk(std::vector<char_type>& text, std::error_code& ec)
+    {
+        text.swap(pending_);
+        pending_.clear();
+
+        std::size_t scanned = 0;
+        for (;;)
+        {
+            if (text.size() >= chunk_length_)
+            {
+                std::size_t n = text.size();
+                while (n > scanned && text[n-1] != '\n')
+                {
+                    --n;
+                }
+                if (n > scanned)
+                {
+                    pending_.assign(text.begin() + n, text.end());
+                    text.resize(n);
+                    return;
+                }
+                scanned = text.size();
+            }
+            if (source_.eof())
+            {
+                eof_ = true;
+                return;
+            }
+            std::size_t offset = text.size();
+            std::size_t length = chunk_length_ > offset ? chunk_length_ - offset : chunk_length_;
+            text.resize(offset + length);
+            std::size_t count = source_.read(text.data() + offset, length);
+            text.resize(offset + count);
+            if (source_.is_error())
+            {
+                ec = json_errc::source_error;
+                return;
+            }
+            if (count == 0)
+            {
+                eof_ = true;
+                return;
+            }
+            if (begin_)
+            {
+                auto result = unicons::skip_bom(text.begin(), text.end());
+                if (result.ec != unicons::encoding_errc())
+                {
+                    ec = result.ec;
+                    return;
+                }
+                text.erase(text.begin(), result.it);
+                begin_ = false;
+            }
+        }
+    }
+
+    static void run(chunk& c, worker& w)
+    {
+        JSONCONS_TRY
+        {
+            parse_chunk(c, w);
+            c.done.set_value();
+        }
+        JSONCONS_CATCH(...)
+        {
+            c.done.set_exception(std::current_exception());
+        }
+    }
+
+    static void parse_chunk(chunk& c, worker& w)
+    {
+        const char_type* p = c.text.data();
+        const char_type* last = p + c.text.size();
+        std::size_t line = 0;
+
+        while (p != last)
+        {
+            const char_type* eol = std::char_traits<char_type>::find(p, static_cast<std::size_t>(last - p), '\n');
+            const char_type* next = eol == nullptr ? last : eol + 1;
+            const char_type* end = eol == nullptr ? last : eol;
+            if (end != p && *(end - 1) == '\r')
+            {
+                --end;
+            }
+            if (!is_blank(p, end))
+            {
+                c.results.emplace_back();
+                line_result& result = c.results.back();
+                result.line = line;
+                parse_line(p, static_cast<std::size_t>(end - p), w, result);
+            }
+            ++line;
+            p = next;
+        }
+        c.line_count = line;
+    }
+
+    static bool is_blank(const char_type* p, const char_type* end)
+    {
+        for (; p != end; ++p)
+        {
+            if (*p != ' ' && *p != '\t' && *p != '\r')
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void parse_line(const char_type* data, std::size_t length, worker& w, line_result& result)
+    {
+        w.parser.reset();
+        w.decoder.reset();
+        w.parser.update(data, length);
+
+        std::error_code ec;
+        w.parser.parse_some(w.decoder, ec);
+        if (!ec)
+        {
+            w.parser.finish_parse(w.decoder, ec);
+        }
+        if (!ec)
+        {
+            w.parser.check_done(ec);
+        }
+        result.column = w.parser.column();
+        if (ec)
+        {
+            result.ec = ec;
+        }
+        else if (w.decoder.is_valid())
+        {
+            result.value = w.decoder.get_result();
+        }
+    }
+};
+
+using json_lines_reader = basic_json_lines_reader<json>;
+using wjson_lines_reader = basic_json_lines_reader<wjson>;
+using ojson_lines_reader = basic_json_lines_reader<ojson>;
+using wojson_lines_reader = basic_json_lines_reader<wojson>;
+
+}
+
+#endif
+
@@ -21,6 +21,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
 
 #define JSONCONS_ILLEGAL_CONTROL_CHARACTER \
         case 0x00:case 0x01:case 0x02:case 0x03:case 0x04:case 0x05:case 0x06:case 0x07:case 0x08:case 0x0b: \
@@ -137,6 +138,9 @@ private:
     static constexpr std::size_t initial_string_buffer_capacity_ = 1024;
     static constexpr std::size_t default_initial_stack_capacity_ = 100;
 
+    // Where skip_some is in the skipped content
+    enum class skip_state : uint8_t {value, string, escape, slash, line_comment, block_comment, block_comment_star};
+
     basic_json_decode_options<CharT> options_;
 
     std::function<bool(json_errc,const ser_context&)> err_handler_;
@@ -154,9 +158,13 @@ private:
     json_parse_state state_;
     bool more_;
     bool done_;
+    std::size_t skip_depth_;
+    skip_state skip_state_;
+    bool skip_cr_;
 
     std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
     jsoncons::detail::to_double_t to_double_;
+    jsoncons::detail::decimal_accumulator number_;
 
     std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
     std::vector<std::pair<string_view_type,double>> string_double_map_;
@@ -202,6 +210,9 @@ public:
          state_(json_parse_state::start),
          more_(true),
          done_(false),
+         skip_depth_(0),
+         skip_state_(skip_state::value),
+         skip_cr_(false),
          string_buffer_(alloc),
          state_stack_(alloc)
     {
@@ -263,9 +274,12 @@ public:
             {
                 case ' ':
                 case '\t':
-                    ++input_ptr_;
-                    ++position_;
+                {
+                    const CharT* p = jsoncons::detail::skip_blanks(input_ptr_ + 1, local_input_end);
+                    position_ += (p - input_ptr_);
+                    input_ptr_ = p;
                     break;
+                }
                 case '\r': 
                     push_state(state_);
                     ++input_ptr_;
@@ -326,7 +340,8 @@ public:
         }
     }
 
-    void begin_object(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void begin_object(Visitor& visitor, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
         {
@@ -343,7 +358,8 @@ public:
         more_ = visitor.begin_object(semantic_tag::none, *this, ec);
     }
 
-    void end_object(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_object(Visitor& visitor, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(nesting_depth_ < 1))
         {
@@ -383,7 +399,8 @@ public:
         }
     }
 
-    void begin_array(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void begin_array(Visitor& visitor, std::error_code& ec)
     {
         if (++nesting_depth_ > options_.max_nesting_depth())
         {
@@ -400,7 +417,8 @@ public:
         more_ = visitor.begin_array(semantic_tag::none, *this, ec);
     }
 
-    void end_array(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_array(Visitor& visitor, std::error_code& ec)
     {
         if (nesting_depth_ < 1)
         {
@@ -447,6 +465,7 @@ public:
         state_ = json_parse_state::start;
         more_ = true;
         done_ = false;
+        skip_depth_ = 0;
         line_ = 1;
         position_ = 0;
         mark_position_ = 0;
@@ -524,6 +543,65 @@ public:
         parse_some_(visitor, ec);
     }
 
+    // As parse_some, but the visitor, of a final class that befriends static_json_visitor
+    // such as the encoders, is called through static_json_visitor, so the calls are bound at 
+    // compile time and can be inlined. Each visitor type instantiates its own copy of the parser.
+    template <class Visitor>
+    void parse_some_static(Visitor& visitor, std::error_code& ec)
+    {
+        static_json_visitor<Visitor> adaptor(visitor);
+        parse_some_(adaptor, ec);
+    }
+
+    // Skips the members or elements of the object or array that has just begun, reports its
+    // end to the visitor, and stops. Only brackets, strings, comments and line breaks are looked
+    // at, 64 characters at a time where possible, so the skipped content is not validated and no 
+    // events are produced for it. As with parse_some, call it with more input until stopped().
+    void skip_some(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (skip_depth_ == 0)
+        {
+            skip_depth_ = 1;
+            skip_state_ = skip_state::value;
+            skip_cr_ = false;
+        }
+        if (input_ptr_ == input_end_)
+        {
+            err_handler_(json_errc::unexpected_eof, *this);
+            ec = json_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+
+        const CharT* p = input_ptr_;
+        const CharT* close = nullptr;
+        while (p != input_end_ && close == nullptr)
+        {
+            if (input_end_ - p >= 64 && skip_state_ <= skip_state::escape && skip_block(p, close))
+            {
+                continue;
+            }
+            p = skip_characters(p, input_end_ - p >= 64 ? p + 64 : input_end_, close);
+        }
+        input_ptr_ = p;
+        if (close != nullptr)
+        {
+            skip_depth_ = 0;
+            if (*close == ']')
+            {
+                end_array(visitor, ec);
+            }
+            else
+            {
+                end_object(visitor, ec);
+            }
+            if (ec) return;
+            ++input_ptr_;
+            ++position_;
+            more_ = false;
+        }
+    }
+
     void finish_parse(basic_json_visitor<CharT>& visitor)
     {
         std::error_code ec;
@@ -542,7 +620,18 @@ public:
         }
     }
 
-    void parse_some_(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void finish_parse_static(Visitor& visitor, std::error_code& ec)
+    {
+        static_json_visitor<Visitor> adaptor(visitor);
+        while (!finished())
+        {
+            parse_some_(adaptor, ec);
+        }
+    }
+
+    template <class Visitor>
+    void parse_some_(Visitor& visitor, std::error_code& ec)
     {
         if (state_ == json_parse_state::before_done)
         {
@@ -672,6 +761,8 @@ public:
                             case '-':
                                 string_buffer_.clear();
                                 string_buffer_.push_back('-');
+                                number_.reset();
+                                number_.negative();
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::minus;
@@ -681,6 +772,8 @@ public:
                             case '0': 
                                 string_buffer_.clear();
                                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                number_.reset();
+                                number_.integer_digit(*input_ptr_);
                                 state_ = json_parse_state::zero;
                                 ++input_ptr_;
                                 ++position_;
@@ -690,6 +783,8 @@ public:
                             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                                 string_buffer_.clear();
                                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                number_.reset();
+                                number_.integer_digit(*input_ptr_);
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::integer;
@@ -1069,6 +1164,8 @@ public:
                             case '-':
                                 string_buffer_.clear();
                                 string_buffer_.push_back('-');
+                                number_.reset();
+                                number_.negative();
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::minus;
@@ -1078,6 +1175,8 @@ public:
                             case '0': 
                                 string_buffer_.clear();
                                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                number_.reset();
+                                number_.integer_digit(*input_ptr_);
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::zero;
@@ -1087,6 +1186,8 @@ public:
                             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                                 string_buffer_.clear();
                                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                number_.reset();
+                                number_.integer_digit(*input_ptr_);
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::integer;
@@ -1216,6 +1317,8 @@ public:
                             case '-':
                                 string_buffer_.clear();
                                 string_buffer_.push_back('-');
+                                number_.reset();
+                                number_.negative();
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::minus;
@@ -1225,6 +1328,8 @@ public:
                             case '0': 
                                 string_buffer_.clear();
                                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                number_.reset();
+                                number_.integer_digit(*input_ptr_);
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::zero;
@@ -1234,6 +1339,8 @@ public:
                             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                                 string_buffer_.clear();
                                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                                number_.reset();
+                                number_.integer_digit(*input_ptr_);
                                 ++input_ptr_;
                                 ++position_;
                                 state_ = json_parse_state::integer;
@@ -1576,7 +1683,8 @@ public:
         }
     }
 
-    void parse_true(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_true(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 4))
@@ -1611,7 +1719,8 @@ public:
         }
     }
 
-    void parse_null(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_null(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 4))
@@ -1646,7 +1755,8 @@ public:
         }
     }
 
-    void parse_false(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_false(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 5))
@@ -1681,7 +1791,8 @@ public:
         }
     }
 
-    void parse_number(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_number(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_ - 1;
         const CharT* local_input_end = input_end_;
@@ -1717,11 +1828,13 @@ minus_sign:
         {
             case '0': 
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.integer_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto zero;
             case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.integer_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto integer;
@@ -1858,6 +1971,7 @@ integer:
                 return;
             case '0': case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.integer_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto integer;
@@ -1896,6 +2010,7 @@ fraction1:
         {
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.fraction_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto fraction2;
@@ -1963,6 +2078,7 @@ fraction2:
                 return;
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.fraction_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto fraction2;
@@ -1992,11 +2108,13 @@ exp1:
                 goto exp2;
             case '-':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.exponent_negative();
                 ++input_ptr_;
                 ++position_;
                 goto exp2;
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.exponent_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto exp3;
@@ -2017,6 +2135,7 @@ exp2:
         {
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.exponent_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto exp3;
@@ -2085,6 +2204,7 @@ exp3:
                 return;
             case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8': case '9':
                 string_buffer_.push_back(static_cast<char>(*input_ptr_));
+                number_.exponent_digit(*input_ptr_);
                 ++input_ptr_;
                 ++position_;
                 goto exp3;
@@ -2099,7 +2219,8 @@ exp3:
         JSONCONS_UNREACHABLE();               
     }
 
-    void parse_string(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_string(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_ - 1;
         const CharT* local_input_end = input_end_;
@@ -2138,6 +2259,11 @@ exp3:
 string_u1:
         while (input_ptr_ < local_input_end)
         {
+            input_ptr_ = jsoncons::detail::find_string_delimiter(input_ptr_, local_input_end);
+            if (input_ptr_ == local_input_end)
+            {
+                break;
+            }
             switch (*input_ptr_)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2215,6 +2341,7 @@ string_u1:
                 }
                 case '\"':
                 {
+                    // No escapes, and all in the current input: pass a view into the input
                     if (string_buffer_.length() == 0)
                     {
                         end_string_value(sb,input_ptr_-sb, visitor, ec);
@@ -2611,7 +2738,183 @@ escape_u8:
     }
 private:
 
-    void end_integer_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    // Skips the 64 characters at p, or up to the bracket that closes the skipped container,
+    // which is returned in close. Returns false, and skips nothing, if they contain a comment.
+    bool skip_block(const CharT*& p, const CharT*& close)
+    {
+        jsoncons::detail::skip_block block;
+        jsoncons::detail::classify_skip_block(p, block);
+
+        uint64_t prev_escaped = skip_state_ == skip_state::escape ? 1 : 0;
+        uint64_t escaped = jsoncons::detail::escaped_characters(block.backslash, prev_escaped);
+        uint64_t in_string = jsoncons::detail::prefix_xor(block.quote & ~escaped);
+        if (skip_state_ != skip_state::value)
+        {
+            in_string = ~in_string;
+        }
+        if ((block.slash & ~in_string) != 0)
+        {
+            return false;
+        }
+        uint64_t open = block.open & ~in_string;
+        uint64_t closing = block.close & ~in_string;
+
+        std::size_t length = 64;
+        if (jsoncons::detail::popcount64(closing) < skip_depth_)
+        {
+            skip_depth_ = skip_depth_ + jsoncons::detail::popcount64(open) - jsoncons::detail::popcount64(closing);
+        }
+        else
+        {
+            for (uint64_t bits = open | closing; bits != 0; bits &= bits - 1)
+            {
+                unsigned i = jsoncons::detail::count_trailing_zeros64(bits);
+                if ((closing >> i) & 1)
+                {
+                    if (--skip_depth_ == 0)
+                    {
+                        length = i;
+                        break;
+                    }
+                }
+                else
+                {
+                    ++skip_depth_;
+                }
+            }
+        }
+
+        // A line break is a '\r', or a '\n' that does not follow a '\r'
+        uint64_t breaks = block.cr | (block.lf & ~((block.cr << 1) | (skip_cr_ ? 1 : 0)));
+        if (length < 64)
+        {
+            breaks &= (uint64_t(1) << length) - 1;
+        }
+        if (breaks != 0)
+        {
+            line_ += jsoncons::detail::popcount64(breaks);
+            mark_position_ = position_ + (64 - jsoncons::detail::count_leading_zeros64(breaks));
+        }
+        position_ += length;
+        p += length;
+        if (length < 64)
+        {
+            close = p;
+        }
+        else
+        {
+            skip_cr_ = (block.cr >> 63) != 0;
+            skip_state_ = (in_string >> 63) == 0 ? skip_state::value 
+                        : (prev_escaped != 0 ? skip_state::escape : skip_state::string);
+        }
+        return true;
+    }
+
+    // Skips the characters in [p,last), or up to the bracket that closes the skipped container,
+    // which is returned in close
+    const CharT* skip_characters(const CharT* p, const CharT* last, const CharT*& close)
+    {
+        const CharT* first = p;
+        for (; p != last; ++p)
+        {
+            CharT c = *p;
+            if (c == '\n' || c == '\r')
+            {
+                if (c == '\r' || !skip_cr_)
+                {
+                    ++line_;
+                    mark_position_ = position_ + (p - first) + 1;
+                }
+                skip_cr_ = c == '\r';
+            }
+            else
+            {
+                skip_cr_ = false;
+            }
+            switch (skip_state_)
+            {
+                case skip_state::slash:
+                    if (c == '*')
+                    {
+                        skip_state_ = skip_state::block_comment;
+                        break;
+                    }
+                    if (c == '/')
+                    {
+                        skip_state_ = skip_state::line_comment;
+                        break;
+                    }
+                    skip_state_ = skip_state::value;
+                    JSONCONS_FALLTHROUGH;
+                case skip_state::value:
+                    switch (c)
+                    {
+                        case '\"':
+                            skip_state_ = skip_state::string;
+                            break;
+                        case '[':
+                        case '{':
+                            ++skip_depth_;
+                            break;
+                        case ']':
+                        case '}':
+                            if (--skip_depth_ == 0)
+                            {
+                                close = p;
+                                position_ += (p - first);
+                                return p;
+                            }
+                            break;
+                        case '/':
+                            skip_state_ = skip_state::slash;
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+                case skip_state::string:
+                    if (c == '\"')
+                    {
+                        skip_state_ = skip_state::value;
+                    }
+                    else if (c == '\\')
+                    {
+                        skip_state_ = skip_state::escape;
+                    }
+                    break;
+                case skip_state::escape:
+                    skip_state_ = skip_state::string;
+                    break;
+                case skip_state::line_comment:
+                    if (c == '\n' || c == '\r')
+                    {
+                        skip_state_ = skip_state::value;
+                    }
+                    break;
+                case skip_state::block_comment:
+                    if (c == '*')
+                    {
+                        skip_state_ = skip_state::block_comment_star;
+                    }
+                    break;
+                case skip_state::block_comment_star:
+                    if (c == '/')
+                    {
+                        skip_state_ = skip_state::value;
+                    }
+                    else if (c != '*')
+                    {
+                        skip_state_ = skip_state::block_comment;
+                    }
+                    break;
+            }
+        }
+        position_ += (p - first);
+        return p;
+    }
+
+    template <class Visitor>
+    void end_integer_value(Visitor& visitor, std::error_code& ec)
     {
         if (string_buffer_[0] == '-')
         {
@@ -2623,7 +2926,8 @@ private:
         }
     }
 
-    void end_negative_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_negative_value(Visitor& visitor, std::error_code& ec)
     {
         auto result = jsoncons::detail::to_integer_unchecked<int64_t>(string_buffer_.data(), string_buffer_.length());
         if (result)
@@ -2637,7 +2941,8 @@ private:
         after_value(ec);
     }
 
-    void end_positive_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_positive_value(Visitor& visitor, std::error_code& ec)
     {
         auto result = jsoncons::detail::to_integer_unchecked<uint64_t>(string_buffer_.data(), string_buffer_.length());
         if (result)
@@ -2651,7 +2956,8 @@ private:
         after_value(ec);
     }
 
-    void end_fraction_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_fraction_value(Visitor& visitor, std::error_code& ec)
     {
         JSONCONS_TRY
         {
@@ -2661,7 +2967,11 @@ private:
             }
             else
             {
-                double d = to_double_(string_buffer_.c_str(), string_buffer_.length());
+                double d;
+                if (!number_.to_double(d))
+                {
+                    d = to_double_(string_buffer_.c_str(), string_buffer_.length());
+                }
                 more_ = visitor.double_value(d, semantic_tag::none, *this, ec);
             }
         }
@@ -2679,10 +2989,12 @@ private:
         after_value(ec);
     }
 
-    void end_string_value(const CharT* s, std::size_t length, basic_json_visitor<CharT>& visitor, std::error_code& ec) 
+    template <class Visitor>
+    void end_string_value(const CharT* s, std::size_t length, Visitor& visitor, std::error_code& ec) 
     {
         string_view_type sv(s, length);
-        auto result = unicons::validate(s,s+length);
+        // ASCII is always well formed, only validate from the first non-ASCII character
+        auto result = unicons::validate(jsoncons::detail::skip_ascii(s, s+length), s+length);
         if (result.ec != unicons::conv_errc())
         {
             translate_conv_errc(result.ec,ec);
@@ -147,7 +147,7 @@ private:
     }
 };
 
-template<class CharT,class Src=jsoncons::stream_source<CharT>,class Allocator=std::allocator<char>>
+template<class CharT,class Src=jsoncons::stream_source<CharT>,class Allocator=std::allocator<char>,class Parser=basic_json_parser<CharT,Allocator>>
 class basic_json_reader 
 {
 public:
@@ -155,6 +155,7 @@ public:
     using source_type = Src;
     using string_view_type = jsoncons::basic_string_view<CharT>;
     using temp_allocator_type = Allocator;
+    using parser_type = Parser;
 private:
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT> char_allocator_type;
 
@@ -164,7 +165,7 @@ private:
 
     basic_json_visitor<CharT>& visitor_;
 
-    basic_json_parser<CharT,Allocator> parser_;
+    parser_type parser_;
 
     source_type source_;
     bool eof_;
@@ -482,29 +483,31 @@ private:
 
     void read_buffer(std::error_code& ec)
     {
-        buffer_.clear();
-        buffer_.resize(buffer_length_);
-        std::size_t count = source_.read(buffer_.data(), buffer_length_);
-        buffer_.resize(static_cast<std::size_t>(count));
-        if (buffer_.size() == 0)
+        auto s = source_reader<Src>::read_buffer(source_, buffer_, buffer_length_);
+        if (s.size() == 0)
         {
+            if (source_.is_error())
+            {
+                ec = json_errc::source_error;
+                return;
+            }
             eof_ = true;
         }
         else if (begin_)
         {
-            auto result = unicons::skip_bom(buffer_.begin(), buffer_.end());
+            auto result = unicons::skip_bom(s.begin(), s.end());
             if (result.ec != unicons::encoding_errc())
             {
                 ec = result.ec;
                 return;
             }
-            std::size_t offset = result.it - buffer_.begin();
-            parser_.update(buffer_.data()+offset,buffer_.size()-offset);
+            std::size_t offset = result.it - s.begin();
+            parser_.update(s.data()+offset,s.size()-offset);
             begin_ = false;
         }
         else
         {
-            parser_.update(buffer_.data(),buffer_.size());
+            parser_.update(s.data(),s.size());
         }
     }
 };
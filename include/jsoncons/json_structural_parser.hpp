@@ -0,0 +1,1524 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_STRUCTURAL_PARSER_HPP
+#define JSONCONS_JSON_STRUCTURAL_PARSER_HPP
+
+#include <memory> // std::allocator
+#include <string>
+#include <vector>
+#include <algorithm> // std::find_if
+#include <system_error>
+#include <limits> // std::numeric_limits
+#include <functional> // std::function
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_reader.hpp>
+#include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+
+namespace jsoncons {
+
+// basic_json_structural_parser is a two stage parser. Stage one finds the structural characters
+// in the input, 64 characters at a time, and records their offsets in an index. Stage two walks the
+// index and emits basic_json_visitor events. The input is indexed a window at a time, so the index
+// stays small and the input is still in cache when stage two reaches it.
+//
+// It has the same interface as basic_json_parser, and can take its place in basic_json_reader.
+// Stage one also records where each string ends and any escape, control or non-ASCII character in it,
+// so stage two does not scan strings that have none of them again. Strings that need no unescaping
+// are passed to the visitor as views into the input. A value that is
+// cut off at the end of the input is parsed again once more input arrives. Parsing stops at the first
+// error, comments are reported to the error handler as with basic_json_parser.
+//
+// Only default_json_parsing and strict_json_parsing are handled by the two stages, they recover from
+// nothing but comments. With any other error handler, which may recover from other errors, the parser
+// hands every call to a basic_json_parser, so that it gives the same results as basic_json_reader.
+
+template <class CharT, class TempAllocator = std::allocator<char>>
+class basic_json_structural_parser : public ser_context
+{
+public:
+    using char_type = CharT;
+    using string_view_type = typename basic_json_visitor<CharT>::string_view_type;
+private:
+    struct string_maps_to_double
+    {
+        string_view_type s;
+
+        bool operator()(const std::pair<string_view_type,double>& val) const
+        {
+            return val.first == s;
+        }
+    };
+
+    using temp_allocator_type = TempAllocator;
+    using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
+    using offset_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<std::size_t>;
+    using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<json_parse_state>;
+
+    static constexpr std::size_t block_size = 64;
+    static constexpr std::size_t window_blocks = 256;
+    static constexpr std::size_t index_capacity = (window_blocks + 1)*block_size;
+    static constexpr std::size_t initial_string_buffer_capacity_ = 1024;
+
+    basic_json_decode_options<CharT> options_;
+    std::function<bool(json_errc,const ser_context&)> err_handler_;
+
+    const CharT* data_;
+    std::size_t length_;
+    std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> buffer_;
+    std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
+
+    jsoncons::detail::structural_indexer indexer_;
+    offset_allocator_type offset_alloc_;
+    std::size_t* index_;
+    std::size_t index_size_;
+    std::size_t next_;
+    std::size_t indexed_;
+    bool tail_indexed_;
+
+    std::size_t pos_;
+    json_parse_state state_;
+    std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
+    int nesting_depth_;
+    bool more_;
+    bool done_;
+    bool owned_;
+    bool waiting_;
+    bool have_new_;
+    bool end_of_input_;
+    bool need_input_;
+
+    std::size_t position_;
+    std::size_t base_position_;
+    std::size_t doc_position_;
+    mutable std::size_t line_;
+    mutable std::size_t line_offset_;
+    mutable std::size_t mark_position_;
+    mutable bool pending_cr_;
+
+    jsoncons::detail::to_double_t to_double_;
+    std::vector<std::pair<string_view_type,double>> string_double_map_;
+
+    std::unique_ptr<basic_json_parser<CharT,TempAllocator>> fallback_;
+
+    // Noncopyable and nonmoveable
+    basic_json_structural_parser(const basic_json_structural_parser&) = delete;
+    basic_json_structural_parser& operator=(const basic_json_structural_parser&) = delete;
+
+public:
+    basic_json_structural_parser(const TempAllocator& alloc = TempAllocator())
+        : basic_json_structural_parser(basic_json_decode_options<CharT>(), default_json_parsing(), alloc)
+    {
+    }
+
+    basic_json_structural_parser(std::function<bool(json_errc,const ser_context&)> err_handler,
+                                 const TempAllocator& alloc = TempAllocator())
+        : basic_json_structural_parser(basic_json_decode_options<CharT>(), err_handler, alloc)
+    {
+    }
+
+    basic_json_structural_parser(const basic_json_decode_options<CharT>& options,
+                                 const TempAllocator& alloc = TempAllocator())
+        : basic_json_structural_parser(options, default_json_parsing(), alloc)
+    {
+    }
+
+    basic_json_structural_parser(const basic_json_decode_options<CharT>& options,
+                                 std::function<bool(json_errc,const ser_context&)> err_handler,
+                                 const TempAllocator& alloc = TempAllocator())
+       : options_(options),
+         err_handler_(err_handler),
+         data_(nullptr),
+         length_(0),
+         buffer_(alloc),
+         string_buffer_(alloc),
+         offset_alloc_(alloc),
+         index_(nullptr),
+         index_size_(0),
+         next_(0),
+         indexed_(0),
+         tail_indexed_(false),
+         pos_(0),
+         state_(json_parse_state::start),
+         state_stack_(alloc),
+         nesting_depth_(0),
+         more_(true),
+         done_(false),
+         owned_(false),
+         waiting_(false),
+         have_new_(false),
+         end_of_input_(false),
+         need_input_(false),
+         position_(0),
+         base_position_(0),
+         doc_position_(0),
+         line_(1),
+         line_offset_(0),
+         mark_position_(0),
+         pending_cr_(false)
+    {
+        if (!stops_at_errors(err_handler_))
+        {
+            fallback_.reset(new basic_json_parser<CharT,TempAllocator>(options, err_handler, alloc));
+            return;
+        }
+        string_buffer_.reserve(initial_string_buffer_capacity_);
+        state_stack_.push_back(json_parse_state::root);
+
+        if (options_.enable_str_to_nan())
+        {
+            string_double_map_.emplace_back(options_.nan_to_str(),std::nan(""));
+        }
+        if (options_.enable_str_to_inf())
+        {
+            string_double_map_.emplace_back(options_.inf_to_str(),std::numeric_limits<double>::infinity());
+        }
+        if (options_.enable_str_to_neginf())
+        {
+            string_double_map_.emplace_back(options_.neginf_to_str(),-std::numeric_limits<double>::infinity());
+        }
+    }
+
+    ~basic_json_structural_parser() noexcept
+    {
+        if (index_ != nullptr)
+        {
+            std::allocator_traits<offset_allocator_type>::deallocate(offset_alloc_, index_, index_capacity);
+        }
+    }
+
+    bool source_exhausted() const
+    {
+        if (fallback_)
+        {
+            return fallback_->source_exhausted();
+        }
+        return waiting_ || pos_ >= length_;
+    }
+
+    bool done() const
+    {
+        if (fallback_)
+        {
+            return fallback_->done();
+        }
+        return done_;
+    }
+
+    bool stopped() const
+    {
+        if (fallback_)
+        {
+            return fallback_->stopped();
+        }
+        return !more_;
+    }
+
+    bool finished() const
+    {
+        if (fallback_)
+        {
+            return fallback_->finished();
+        }
+        return !more_ && state_ != json_parse_state::before_done;
+    }
+
+    void skip_whitespace()
+    {
+        if (fallback_)
+        {
+            fallback_->skip_whitespace();
+            return;
+        }
+        while (pos_ < length_ && is_whitespace(data_[pos_]))
+        {
+            ++pos_;
+        }
+    }
+
+    void reset()
+    {
+        if (fallback_)
+        {
+            fallback_->reset();
+            return;
+        }
+        state_stack_.clear();
+        state_stack_.push_back(json_parse_state::root);
+        state_ = json_parse_state::start;
+        nesting_depth_ = 0;
+        more_ = true;
+        done_ = false;
+        position_ = pos_;
+        doc_position_ = base_position_ + pos_;
+        line_ = 1;
+        line_offset_ = pos_;
+        mark_position_ = doc_position_;
+        pending_cr_ = false;
+    }
+
+    void restart()
+    {
+        if (fallback_)
+        {
+            fallback_->restart();
+            return;
+        }
+        more_ = true;
+    }
+
+    void check_done()
+    {
+        std::error_code ec;
+        check_done(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void check_done(std::error_code& ec)
+    {
+        if (fallback_)
+        {
+            fallback_->check_done(ec);
+            return;
+        }
+        for (; pos_ < length_; ++pos_)
+        {
+            if (!is_whitespace(data_[pos_]))
+            {
+                position_ = pos_;
+                more_ = err_handler_(json_errc::extra_character, *this);
+                if (!more_)
+                {
+                    ec = json_errc::extra_character;
+                    return;
+                }
+            }
+        }
+    }
+
+    void update(const string_view_type sv)
+    {
+        update(sv.data(),sv.length());
+    }
+
+    void update(const CharT* data, std::size_t length)
+    {
+        if (fallback_)
+        {
+            fallback_->update(data, length);
+            return;
+        }
+        if (waiting_)
+        {
+            // The unparsed input has been moved to buffer_, add to it
+            buffer_.append(data, length);
+            data_ = buffer_.data();
+            length_ = buffer_.size();
+        }
+        else
+        {
+            rebase(length_);
+            buffer_.clear();
+            owned_ = false;
+            data_ = data;
+            length_ = length;
+            pos_ = 0;
+            position_ = 0;
+            reset_index(0);
+        }
+        have_new_ = true;
+    }
+
+    void parse_some(basic_json_visitor<CharT>& visitor)
+    {
+        std::error_code ec;
+        parse_some(visitor, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void parse_some(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (fallback_)
+        {
+            fallback_->parse_some(visitor, ec);
+            return;
+        }
+        if (state_ == json_parse_state::before_done)
+        {
+            visitor.flush();
+            done_ = true;
+            state_ = json_parse_state::done;
+            more_ = false;
+            return;
+        }
+        // Called again without new input after waiting for it, there is no more
+        end_of_input_ = waiting_ && !have_new_;
+        have_new_ = false;
+        waiting_ = false;
+        parse_tokens(visitor, ec);
+    }
+
+    void finish_parse(basic_json_visitor<CharT>& visitor)
+    {
+        std::error_code ec;
+        finish_parse(visitor, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    void finish_parse(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (fallback_)
+        {
+            fallback_->finish_parse(visitor, ec);
+            return;
+        }
+        while (!finished())
+        {
+            parse_some(visitor, ec);
+        }
+    }
+
+    std::size_t line() const override
+    {
+        if (fallback_)
+        {
+            return fallback_->line();
+        }
+        count_lines();
+        return line_;
+    }
+
+    std::size_t column() const override
+    {
+        if (fallback_)
+        {
+            return fallback_->column();
+        }
+        count_lines();
+        return (base_position_ + position_ - mark_position_) + 1;
+    }
+
+    std::size_t position() const override
+    {
+        if (fallback_)
+        {
+            return fallback_->position();
+        }
+        return base_position_ + position_ - doc_position_;
+    }
+
+private:
+
+    static bool stops_at_errors(const std::function<bool(json_errc,const ser_context&)>& err_handler)
+    {
+        return err_handler.template target<default_json_parsing>() != nullptr ||
+               err_handler.template target<strict_json_parsing>() != nullptr;
+    }
+
+    static bool is_whitespace(CharT c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static bool is_delimiter(CharT c)
+    {
+        return is_whitespace(c) || c == ',' || c == '}' || c == ']' || c == '/';
+    }
+
+    static bool is_control_character(CharT c)
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        return static_cast<uchar_type>(c) < 0x20;
+    }
+
+    static bool is_digit(CharT c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    // Positions are counted from the start of the document, line breaks are counted
+    // when line() or column() is called
+    void count_lines() const
+    {
+        std::size_t end = position_ < length_ ? position_ : length_;
+        if (pending_cr_ && line_offset_ < end)
+        {
+            pending_cr_ = false;
+            if (data_[line_offset_] == '\n')
+            {
+                mark_position_ = base_position_ + line_offset_;
+                ++line_offset_;
+            }
+        }
+        for (; line_offset_ < end; ++line_offset_)
+        {
+            switch (data_[line_offset_])
+            {
+                case '\r':
+                    ++line_;
+                    mark_position_ = base_position_ + line_offset_ + 1;
+                    if (line_offset_ + 1 == length_)
+                    {
+                        pending_cr_ = true;
+                    }
+                    else if (data_[line_offset_ + 1] == '\n')
+                    {
+                        ++line_offset_;
+                    }
+                    break;
+                case '\n':
+                    ++line_;
+                    mark_position_ = base_position_ + line_offset_ + 1;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Moves the origin of offsets to data_[offset], before data_ is replaced
+    void rebase(std::size_t offset)
+    {
+        position_ = offset;
+        count_lines();
+        base_position_ += offset;
+        line_offset_ = 0;
+    }
+
+    // Keeps the unparsed input in buffer_ until more arrives
+    void wait_for_input()
+    {
+        rebase(pos_);
+        if (owned_)
+        {
+            buffer_.erase(0, pos_);
+        }
+        else
+        {
+            buffer_.assign(data_ + pos_, length_ - pos_);
+            owned_ = true;
+        }
+        data_ = buffer_.data();
+        length_ = buffer_.size();
+        pos_ = 0;
+        position_ = 0;
+        reset_index(0);
+        waiting_ = true;
+    }
+
+    // Stage one
+
+    // Starts indexing again at offset, which must be outside of a string
+    void reset_index(std::size_t offset)
+    {
+        indexer_.reset();
+        indexed_ = offset;
+        tail_indexed_ = false;
+        index_size_ = 0;
+        next_ = 0;
+    }
+
+    // Indexes the next window of input, returns false if the input has all been indexed
+    bool fill_index()
+    {
+        if (index_ == nullptr)
+        {
+            index_ = std::allocator_traits<offset_allocator_type>::allocate(offset_alloc_, index_capacity);
+        }
+        index_size_ = 0;
+        next_ = 0;
+        while (next_ == index_size_)
+        {
+            index_size_ = 0;
+            next_ = 0;
+            if (length_ - indexed_ >= block_size)
+            {
+                for (std::size_t i = 0; i < window_blocks && length_ - indexed_ >= block_size; ++i)
+                {
+                    index_size_ += indexer_.index_block_with_strings(data_ + indexed_, indexed_, index_ + index_size_);
+                    indexed_ += block_size;
+                }
+            }
+            else if (indexed_ < length_ && !tail_indexed_)
+            {
+                // The last partial block is indexed as if padded with spaces. If more input arrives,
+                // it is indexed again from the start of the unparsed input.
+                CharT block[block_size];
+                std::size_t n = length_ - indexed_;
+                std::char_traits<CharT>::copy(block, data_ + indexed_, n);
+                std::char_traits<CharT>::assign(block + n, block_size - n, ' ');
+                index_size_ += indexer_.index_block_with_strings(block, indexed_, index_ + index_size_);
+                indexed_ = length_;
+                tail_indexed_ = true;
+            }
+            else
+            {
+                return false;
+            }
+            // Closing quotes and other characters of a string that parse_string has scanned
+            // past the end of the last window
+            while (next_ < index_size_ && index_[next_] < pos_)
+            {
+                ++next_;
+            }
+        }
+        return true;
+    }
+
+    // Stage two
+
+    void parse_tokens(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        while (more_ && state_ != json_parse_state::before_done)
+        {
+            if (next_ == index_size_ && !fill_index())
+            {
+                if (end_of_input_)
+                {
+                    position_ = length_;
+                    pos_ = length_;
+                    report_error(json_errc::unexpected_eof, ec);
+                }
+                else
+                {
+                    wait_for_input();
+                }
+                return;
+            }
+            const std::size_t offset = index_[next_];
+            const CharT c = data_[offset];
+            position_ = offset;
+
+            if (c == '/')
+            {
+                skip_comment(offset, ec);
+            }
+            else
+            {
+                switch (state_)
+                {
+                    case json_parse_state::start:
+                        switch (c)
+                        {
+                            case '{':
+                                begin_object(visitor, ec);
+                                break;
+                            case '[':
+                                begin_array(visitor, ec);
+                                break;
+                            case '}':
+                                report_error(json_errc::unexpected_right_brace, ec);
+                                break;
+                            case ']':
+                                report_error(json_errc::unexpected_right_bracket, ec);
+                                break;
+                            case '\"':case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':case 't':case 'f':case 'n':
+                                parse_scalar(c, offset, false, visitor, ec);
+                                break;
+                            default:
+                                report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::syntax_error, ec);
+                                break;
+                        }
+                        break;
+                    case json_parse_state::expect_value:
+                    case json_parse_state::expect_value_or_end:
+                        switch (c)
+                        {
+                            case '{':
+                                begin_object(visitor, ec);
+                                break;
+                            case '[':
+                                begin_array(visitor, ec);
+                                break;
+                            case ']':
+                                if (state_ == json_parse_state::expect_value_or_end)
+                                {
+                                    end_array(visitor, ec);
+                                }
+                                else
+                                {
+                                    report_error(parent() == json_parse_state::array ? json_errc::extra_comma : json_errc::expected_value, ec);
+                                }
+                                break;
+                            case '\"':case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':case 't':case 'f':case 'n':
+                                parse_scalar(c, offset, false, visitor, ec);
+                                break;
+                            case '\'':
+                                report_error(json_errc::single_quote, ec);
+                                break;
+                            default:
+                                report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::expected_value, ec);
+                                break;
+                        }
+                        break;
+                    case json_parse_state::expect_member_name_or_end:
+                    case json_parse_state::expect_member_name:
+                        switch (c)
+                        {
+                            case '\"':
+                                parse_scalar(c, offset, true, visitor, ec);
+                                break;
+                            case '}':
+                                if (state_ == json_parse_state::expect_member_name_or_end)
+                                {
+                                    end_object(visitor, ec);
+                                }
+                                else
+                                {
+                                    report_error(json_errc::extra_comma, ec);
+                                }
+                                break;
+                            case '\'':
+                                report_error(json_errc::single_quote, ec);
+                                break;
+                            default:
+                                report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::expected_key, ec);
+                                break;
+                        }
+                        break;
+                    case json_parse_state::expect_colon:
+                        if (c == ':')
+                        {
+                            pos_ = offset + 1;
+                            ++next_;
+                            state_ = json_parse_state::expect_value;
+                        }
+                        else
+                        {
+                            report_error(is_control_character(c) ? json_errc::illegal_control_character : json_errc::expected_colon, ec);
+                        }
+                        break;
+                    case json_parse_state::expect_comma_or_end:
+                        switch (c)
+                        {
+                            case '}':
+                                end_object(visitor, ec);
+                                break;
+                            case ']':
+                                end_array(visitor, ec);
+                                break;
+                            case ',':
+                                pos_ = offset + 1;
+                                ++next_;
+                                state_ = parent() == json_parse_state::object ? json_parse_state::expect_member_name : json_parse_state::expect_value;
+                                break;
+                            default:
+                                expected_comma_or_end(c, ec);
+                                break;
+                        }
+                        break;
+                    default:
+                        JSONCONS_UNREACHABLE();
+                }
+            }
+            if (ec)
+            {
+                return;
+            }
+            if (need_input_)
+            {
+                need_input_ = false;
+                wait_for_input();
+                return;
+            }
+        }
+    }
+
+    json_parse_state parent() const
+    {
+        return state_stack_.back();
+    }
+
+    void report_error(json_errc code, std::error_code& ec)
+    {
+        err_handler_(code, *this);
+        ec = code;
+        more_ = false;
+    }
+
+    // A value or comment runs to the end of the input. Unless there is no more,
+    // it is parsed again when more arrives.
+    void need_more_input(std::error_code& ec)
+    {
+        if (end_of_input_)
+        {
+            position_ = length_;
+            report_error(json_errc::unexpected_eof, ec);
+        }
+        else
+        {
+            need_input_ = true;
+        }
+    }
+
+    void expected_comma_or_end(CharT c, std::error_code& ec)
+    {
+        if (is_control_character(c))
+        {
+            report_error(json_errc::illegal_control_character, ec);
+        }
+        else if (parent() == json_parse_state::array)
+        {
+            report_error(json_errc::expected_comma_or_right_bracket, ec);
+        }
+        else
+        {
+            report_error(json_errc::expected_comma_or_right_brace, ec);
+        }
+    }
+
+    // Finds the end of the comment that starts at offset, returns false if it runs past the input
+    bool find_comment_end(std::size_t offset, std::size_t& end) const
+    {
+        end = offset + 1;
+        if (end >= length_)
+        {
+            return false;
+        }
+        switch (data_[end])
+        {
+            case '*':
+                end = offset + 2;
+                while (end + 1 < length_ && !(data_[end] == '*' && data_[end + 1] == '/'))
+                {
+                    ++end;
+                }
+                if (end + 1 >= length_)
+                {
+                    return false;
+                }
+                end += 2;
+                return true;
+            case '/':
+                end = offset + 2;
+                while (end < length_ && data_[end] != '\n' && data_[end] != '\r')
+                {
+                    ++end;
+                }
+                return end < length_ || end_of_input_;
+            default:
+                return true;
+        }
+    }
+
+    void skip_comment(std::size_t offset, std::error_code& ec)
+    {
+        std::size_t end;
+        if (!find_comment_end(offset, end))
+        {
+            need_more_input(ec);
+            return;
+        }
+        json_errc code = data_[offset + 1] == '*' || data_[offset + 1] == '/' ? json_errc::illegal_comment : json_errc::syntax_error;
+        position_ = offset + 1;
+        more_ = err_handler_(code, *this);
+        if (!more_)
+        {
+            ec = code;
+            return;
+        }
+        // Quotes in a comment throw the index out, start again after it
+        pos_ = end;
+        reset_index(end);
+    }
+
+    void begin_object(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
+        {
+            report_error(json_errc::max_nesting_depth_exceeded, ec);
+            return;
+        }
+        pos_ = position_ + 1;
+        ++next_;
+        state_stack_.push_back(json_parse_state::object);
+        state_ = json_parse_state::expect_member_name_or_end;
+        more_ = visitor.begin_object(semantic_tag::none, *this, ec);
+    }
+
+    void begin_array(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
+        {
+            report_error(json_errc::max_nesting_depth_exceeded, ec);
+            return;
+        }
+        pos_ = position_ + 1;
+        ++next_;
+        state_stack_.push_back(json_parse_state::array);
+        state_ = json_parse_state::expect_value_or_end;
+        more_ = visitor.begin_array(semantic_tag::none, *this, ec);
+    }
+
+    void end_object(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (parent() == json_parse_state::array)
+        {
+            report_error(json_errc::expected_comma_or_right_bracket, ec);
+            return;
+        }
+        pos_ = position_ + 1;
+        ++next_;
+        --nesting_depth_;
+        state_stack_.pop_back();
+        after_value();
+        more_ = visitor.end_object(*this, ec);
+    }
+
+    void end_array(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (parent() == json_parse_state::object)
+        {
+            report_error(json_errc::expected_comma_or_right_brace, ec);
+            return;
+        }
+        pos_ = position_ + 1;
+        ++next_;
+        --nesting_depth_;
+        state_stack_.pop_back();
+        after_value();
+        more_ = visitor.end_array(*this, ec);
+    }
+
+    // Takes a ',' that follows the value here, rather than in another pass through parse_tokens
+    void after_value()
+    {
+        switch (parent())
+        {
+            case json_parse_state::root:
+                state_ = json_parse_state::before_done;
+                break;
+            case json_parse_state::object:
+                if (next_ < index_size_ && data_[index_[next_]] == ',')
+                {
+                    pos_ = index_[next_++] + 1;
+                    state_ = json_parse_state::expect_member_name;
+                }
+                else
+                {
+                    state_ = json_parse_state::expect_comma_or_end;
+                }
+                break;
+            default:
+                if (next_ < index_size_ && data_[index_[next_]] == ',')
+                {
+                    pos_ = index_[next_++] + 1;
+                    state_ = json_parse_state::expect_value;
+                }
+                else
+                {
+                    state_ = json_parse_state::expect_comma_or_end;
+                }
+                break;
+        }
+    }
+
+    // Parses the string, number or literal that starts at offset
+    void parse_scalar(CharT c, std::size_t offset, bool is_key, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        ++next_;
+        switch (c)
+        {
+            case '\"':
+                parse_string(offset, is_key, visitor, ec);
+                break;
+            case 't':
+                parse_literal(offset, "true", visitor, ec);
+                break;
+            case 'f':
+                parse_literal(offset, "false", visitor, ec);
+                break;
+            case 'n':
+                parse_literal(offset, "null", visitor, ec);
+                break;
+            default:
+                parse_number(offset, visitor, ec);
+                if (!ec && !need_input_ && state_ == json_parse_state::before_done && pos_ < length_)
+                {
+                    after_root_number(ec);
+                }
+                break;
+        }
+    }
+
+    // basic_json_parser takes a delimiter that ends a number at the root as part of the number
+    void after_root_number(std::error_code& ec)
+    {
+        switch (data_[pos_])
+        {
+            case ',':
+                if (next_ < index_size_ && index_[next_] == pos_)
+                {
+                    ++next_;
+                }
+                ++pos_;
+                break;
+            case '/':
+                if (more_)
+                {
+                    skip_comment(pos_, ec);
+                }
+                break;
+            case '}':
+            case ']':
+                state_ = json_parse_state::expect_comma_or_end;
+                if (more_)
+                {
+                    position_ = pos_;
+                    report_error(data_[pos_] == '}' ? json_errc::unexpected_right_brace : json_errc::unexpected_right_bracket, ec);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    void parse_literal(std::size_t offset, const char* literal, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        std::size_t i = 1;
+        for (; literal[i] != 0; ++i)
+        {
+            if (offset + i >= length_)
+            {
+                need_more_input(ec);
+                return;
+            }
+            if (data_[offset + i] != literal[i])
+            {
+                // basic_json_parser matches a literal as a whole when it is all in the input, otherwise character by character
+                position_ = offset + std::char_traits<char>::length(literal) <= length_ ? offset : offset + i;
+                report_error(json_errc::invalid_value, ec);
+                return;
+            }
+        }
+        if (offset + i == length_ && !end_of_input_)
+        {
+            need_input_ = true;
+            return;
+        }
+        pos_ = offset + i;
+
+        // In a container, a literal must be followed by a delimiter. As with basic_json_parser,
+        // the value is reported before the error. At the root, anything that follows is left to check_done.
+        bool delimited = pos_ == length_ || parent() == json_parse_state::root || is_delimiter(data_[pos_]);
+        if (delimited)
+        {
+            after_value();
+        }
+        else
+        {
+            state_ = json_parse_state::expect_comma_or_end;
+        }
+        switch (literal[0])
+        {
+            case 't':
+                more_ = visitor.bool_value(true, semantic_tag::none, *this, ec);
+                break;
+            case 'f':
+                more_ = visitor.bool_value(false, semantic_tag::none, *this, ec);
+                break;
+            default:
+                more_ = visitor.null_value(semantic_tag::none, *this, ec);
+                break;
+        }
+        if (!delimited && more_ && !ec)
+        {
+            position_ = pos_;
+            expected_comma_or_end(data_[pos_], ec);
+        }
+    }
+
+    void parse_number(std::size_t offset, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const CharT* first = data_ + offset;
+        const CharT* last = data_ + length_;
+        const CharT* p = first;
+        bool is_integer = true;
+        jsoncons::detail::decimal_accumulator number;
+
+        if (*p == '-')
+        {
+            number.negative();
+            ++p;
+            if (p == last)
+            {
+                need_more_input(ec);
+                return;
+            }
+            if (!is_digit(*p))
+            {
+                position_ = p - data_;
+                err_handler_(json_errc::invalid_number, *this);
+                ec = json_errc::expected_value;
+                more_ = false;
+                return;
+            }
+        }
+        if (*p == '0')
+        {
+            ++p;
+            if (p != last && is_digit(*p))
+            {
+                position_ = p - data_;
+                report_error(json_errc::leading_zero, ec);
+                return;
+            }
+        }
+        else
+        {
+            while (p != last && is_digit(*p))
+            {
+                number.integer_digit(*p);
+                ++p;
+            }
+        }
+        if (p != last && *p == '.')
+        {
+            is_integer = false;
+            ++p;
+            if (p == last)
+            {
+                need_more_input(ec);
+                return;
+            }
+            if (!is_digit(*p))
+            {
+                position_ = p - data_;
+                report_error(json_errc::invalid_number, ec);
+                return;
+            }
+            while (p != last && is_digit(*p))
+            {
+                number.fraction_digit(*p);
+                ++p;
+            }
+        }
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            is_integer = false;
+            ++p;
+            if (p != last && (*p == '+' || *p == '-'))
+            {
+                if (*p == '-')
+                {
+                    number.exponent_negative();
+                }
+                ++p;
+            }
+            if (p == last)
+            {
+                need_more_input(ec);
+                return;
+            }
+            if (!is_digit(*p))
+            {
+                position_ = p - data_;
+                err_handler_(json_errc::invalid_number, *this);
+                ec = json_errc::expected_value;
+                more_ = false;
+                return;
+            }
+            while (p != last && is_digit(*p))
+            {
+                number.exponent_digit(*p);
+                ++p;
+            }
+        }
+        if (p == last)
+        {
+            if (!end_of_input_)
+            {
+                need_input_ = true;
+                return;
+            }
+        }
+        else if (!is_delimiter(*p))
+        {
+            position_ = p - data_;
+            report_error(json_errc::invalid_number, ec);
+            return;
+        }
+        else if (*p == '/' && parent() == json_parse_state::root)
+        {
+            // The comment is skipped with the number, so it must be complete
+            std::size_t end;
+            if (!find_comment_end(p - data_, end) && !end_of_input_)
+            {
+                need_input_ = true;
+                return;
+            }
+        }
+        pos_ = p - data_;
+        after_value();
+
+        std::size_t length = p - first;
+        if (is_integer)
+        {
+            if (*first == '-')
+            {
+                auto result = jsoncons::detail::to_integer_unchecked<int64_t>(first, length);
+                if (result)
+                {
+                    more_ = visitor.int64_value(result.value(), semantic_tag::none, *this, ec);
+                }
+                else // Must be overflow
+                {
+                    more_ = visitor.string_value(string_view_type(first, length), semantic_tag::bigint, *this, ec);
+                }
+            }
+            else
+            {
+                auto result = jsoncons::detail::to_integer_unchecked<uint64_t>(first, length);
+                if (result)
+                {
+                    more_ = visitor.uint64_value(result.value(), semantic_tag::none, *this, ec);
+                }
+                else // Must be overflow
+                {
+                    more_ = visitor.string_value(string_view_type(first, length), semantic_tag::bigint, *this, ec);
+                }
+            }
+            return;
+        }
+
+        double d;
+        if (!options_.lossless_number() && number.to_double(d))
+        {
+            more_ = visitor.double_value(d, semantic_tag::none, *this, ec);
+            return;
+        }
+
+        // Same text as basic_json_parser passes to to_double_t: locale decimal point, no '+' in the exponent
+        string_buffer_.clear();
+        for (const CharT* q = first; q != p; ++q)
+        {
+            switch (*q)
+            {
+                case '.':
+                    string_buffer_.push_back(to_double_.get_decimal_point());
+                    break;
+                case '+':
+                    break;
+                default:
+                    string_buffer_.push_back(*q);
+                    break;
+            }
+        }
+        JSONCONS_TRY
+        {
+            if (options_.lossless_number())
+            {
+                more_ = visitor.string_value(string_buffer_, semantic_tag::bigdec, *this, ec);
+            }
+            else
+            {
+                d = to_double_(string_buffer_.c_str(), string_buffer_.length());
+                more_ = visitor.double_value(d, semantic_tag::none, *this, ec);
+            }
+        }
+        JSONCONS_CATCH(...)
+        {
+            report_error(json_errc::invalid_number, ec);
+        }
+    }
+
+    void parse_string(std::size_t offset, bool is_key, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const CharT* last = data_ + length_;
+        const CharT* sb = data_ + offset + 1;
+        const CharT* p = sb;
+        bool unescaped = false;
+
+        // Stage one records the closing quote, and any backslash, control character or non-ASCII
+        // character before it
+        if (next_ < index_size_ && data_[index_[next_]] == '\"')
+        {
+            p = data_ + index_[next_++];
+            pos_ = (p - data_) + 1;
+            string_value(string_view_type(sb, p - sb), is_key, visitor, ec);
+            return;
+        }
+        else
+        {
+            for (;;)
+            {
+                p = jsoncons::detail::find_string_delimiter(p, last);
+                if (p == last)
+                {
+                    need_more_input(ec);
+                    if (ec)
+                    {
+                        position_ = length_ + 1;
+                    }
+                    return;
+                }
+                if (*p == '\"')
+                {
+                    break;
+                }
+                if (*p == '\\')
+                {
+                    if (!unescaped)
+                    {
+                        string_buffer_.clear();
+                        unescaped = true;
+                    }
+                    string_buffer_.append(sb, p - sb);
+                    p = unescape(p + 1, ec);
+                    if (ec || need_input_)
+                    {
+                        return;
+                    }
+                    sb = p;
+                    continue;
+                }
+                // Reported where basic_json_parser reports them, after the character: after a line feed 
+                // on the next line, after a carriage return on the same line
+                position_ = p - data_;
+                switch (*p)
+                {
+                    case '\r':
+                        count_lines();
+                        ++line_offset_;
+                        ++position_;
+                        report_error(json_errc::illegal_character_in_string, ec);
+                        break;
+                    case '\n':
+                    case '\t':
+                        ++position_;
+                        report_error(json_errc::illegal_character_in_string, ec);
+                        break;
+                    default:
+                        ++position_;
+                        report_error(json_errc::illegal_control_character, ec);
+                        break;
+                }
+                return;
+            }
+        }
+
+        string_view_type sv;
+        if (unescaped)
+        {
+            string_buffer_.append(sb, p - sb);
+            sv = string_view_type(string_buffer_.data(), string_buffer_.length());
+        }
+        else
+        {
+            sv = string_view_type(sb, p - sb);
+        }
+
+        // ASCII is always well formed, only validate from the first non-ASCII character
+        auto result = unicons::validate(jsoncons::detail::skip_ascii(sv.data(), sv.data() + sv.length()), sv.data() + sv.length());
+        if (result.ec != unicons::conv_errc())
+        {
+            // basic_json_parser counts from the start of the text that follows the last escape,
+            // which may be past the string, but on the line that the string ends
+            position_ = p - data_;
+            count_lines();
+            position_ = (sb - data_) + (result.it - sv.data());
+            if (line_offset_ < position_)
+            {
+                line_offset_ = position_;
+            }
+            translate_conv_errc(result.ec, ec);
+            return;
+        }
+        pos_ = (p - data_) + 1;
+        // A string that was scanned may have closing quotes and other characters in the index
+        while (next_ < index_size_ && index_[next_] < pos_)
+        {
+            ++next_;
+        }
+        string_value(sv, is_key, visitor, ec);
+    }
+
+    // Emits the string or member name that ends before pos_
+    void string_value(const string_view_type& sv, bool is_key, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (is_key)
+        {
+            if (next_ < index_size_ && data_[index_[next_]] == ':')
+            {
+                pos_ = index_[next_++] + 1;
+                state_ = json_parse_state::expect_value;
+            }
+            else
+            {
+                state_ = json_parse_state::expect_colon;
+            }
+            more_ = visitor.key(sv, *this, ec);
+        }
+        else
+        {
+            after_value();
+            auto it = std::find_if(string_double_map_.begin(), string_double_map_.end(), string_maps_to_double{ sv });
+            if (it != string_double_map_.end())
+            {
+                more_ = visitor.double_value(it->second, semantic_tag::none, *this, ec);
+            }
+            else
+            {
+                more_ = visitor.string_value(sv, semantic_tag::none, *this, ec);
+            }
+        }
+    }
+
+    // Appends the character for the escape sequence that starts at p to string_buffer_,
+    // returns a pointer past the sequence
+    const CharT* unescape(const CharT* p, std::error_code& ec)
+    {
+        const CharT* last = data_ + length_;
+        if (p == last)
+        {
+            need_more_input(ec);
+            return p;
+        }
+        switch (*p)
+        {
+            case '\"':
+                string_buffer_.push_back('\"');
+                return p + 1;
+            case '\\':
+                string_buffer_.push_back('\\');
+                return p + 1;
+            case '/':
+                string_buffer_.push_back('/');
+                return p + 1;
+            case 'b':
+                string_buffer_.push_back('\b');
+                return p + 1;
+            case 'f':
+                string_buffer_.push_back('\f');
+                return p + 1;
+            case 'n':
+                string_buffer_.push_back('\n');
+                return p + 1;
+            case 'r':
+                string_buffer_.push_back('\r');
+                return p + 1;
+            case 't':
+                string_buffer_.push_back('\t');
+                return p + 1;
+            case 'u':
+            {
+                uint32_t cp = 0;
+                p = read_codepoint(p + 1, cp, ec);
+                if (ec || need_input_)
+                {
+                    return p;
+                }
+                if (unicons::is_high_surrogate(cp))
+                {
+                    if (p == last || (*p == '\\' && p + 1 == last))
+                    {
+                        need_more_input(ec);
+                        return p;
+                    }
+                    if (*p != '\\' || *(p + 1) != 'u')
+                    {
+                        position_ = (p - data_) + (*p == '\\' ? 1 : 0);
+                        report_error(json_errc::expected_codepoint_surrogate_pair, ec);
+                        return p;
+                    }
+                    uint32_t cp2 = 0;
+                    p = read_codepoint(p + 2, cp2, ec);
+                    if (ec || need_input_)
+                    {
+                        return p;
+                    }
+                    cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                }
+                unicons::convert(&cp, &cp + 1, std::back_inserter(string_buffer_));
+                return p;
+            }
+            default:
+                position_ = p - data_;
+                report_error(json_errc::illegal_escaped_character, ec);
+                return p;
+        }
+    }
+
+    const CharT* read_codepoint(const CharT* p, uint32_t& cp, std::error_code& ec)
+    {
+        const CharT* last = data_ + length_;
+        for (int i = 0; i < 4; ++i, ++p)
+        {
+            if (p == last)
+            {
+                need_more_input(ec);
+                return p;
+            }
+            CharT c = *p;
+            cp *= 16;
+            if (c >= '0' && c <= '9')
+            {
+                cp += c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                cp += c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                cp += c - 'A' + 10;
+            }
+            else
+            {
+                position_ = p - data_;
+                report_error(json_errc::invalid_unicode_escape_sequence, ec);
+                return p;
+            }
+        }
+        return p;
+    }
+
+    void translate_conv_errc(unicons::conv_errc result, std::error_code& ec)
+    {
+        switch (result)
+        {
+            case unicons::conv_errc::over_long_utf8_sequence:
+                report_error(json_errc::over_long_utf8_sequence, ec);
+                break;
+            case unicons::conv_errc::unpaired_high_surrogate:
+                report_error(json_errc::unpaired_high_surrogate, ec);
+                break;
+            case unicons::conv_errc::expected_continuation_byte:
+                report_error(json_errc::expected_continuation_byte, ec);
+                break;
+            case unicons::conv_errc::illegal_surrogate_value:
+                report_error(json_errc::illegal_surrogate_value, ec);
+                break;
+            default:
+                report_error(json_errc::illegal_codepoint, ec);
+                break;
+        }
+    }
+};
+
+using json_structural_parser = basic_json_structural_parser<char>;
+using wjson_structural_parser = basic_json_structural_parser<wchar_t>;
+
+using json_structural_reader = basic_json_reader<char,stream_source<char>,std::allocator<char>,json_structural_parser>;
+using wjson_structural_reader = basic_json_reader<wchar_t,stream_source<wchar_t>,std::allocator<char>,wjson_structural_parser>;
+
+}
+
+#endif
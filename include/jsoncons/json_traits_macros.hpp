@@ -7,16 +7,22 @@
 #ifndef JSONCONS_JSON_TRAITS_MACROS_HPP
 #define JSONCONS_JSON_TRAITS_MACROS_HPP
 
-#include <algorithm> // std::swap
+#include <algorithm> // std::swap, std::stable_sort
+#include <array>
+#include <cstdint> // uint64_t
+#include <exception> // std::exception_ptr
 #include <iterator> // std::iterator_traits, std::input_iterator_tag
 #include <jsoncons/config/jsoncons_config.hpp> // JSONCONS_EXPAND, JSONCONS_QUOTE
 #include <jsoncons/detail/more_type_traits.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <limits> // std::numeric_limits
+#include <memory> // std::shared_ptr, std::unique_ptr
 #include <string>
 #include <type_traits> // std::enable_if
 #include <utility>
 #include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/encode_traits.hpp>
 
 namespace jsoncons
 {
@@ -91,6 +97,362 @@ namespace jsoncons
             j.try_emplace(key, val); 
         } 
     };
+
+namespace detail {
+
+    // Whether decode_traits<T,CharT> was generated by the macros below
+    template <class T,class CharT,class Enable=void>
+    struct is_json_traits_macro_decode : std::false_type {};
+
+    template <class T,class CharT>
+    struct is_json_traits_macro_decode<T,CharT,
+        typename std::enable_if<decode_traits<T,CharT>::json_traits_macro_decode::value
+    >::type> : std::true_type {};
+
+    template <class T,class CharT,class Enable=void>
+    struct is_json_traits_macro_decode_string : std::false_type {};
+
+    template <class T,class CharT>
+    struct is_json_traits_macro_decode_string<T,CharT,
+        typename std::enable_if<is_basic_string<T>::value &&
+                                std::is_same<typename T::value_type,CharT>::value
+    >::type> : std::true_type {};
+
+    // Containers that basic_json::as<T>() fills with push_back in array order
+    template <class T,class Enable=void>
+    struct is_json_traits_macro_decode_list : std::false_type {};
+
+    template <class T>
+    struct is_json_traits_macro_decode_list<T,
+        typename std::enable_if<!is_json_type_traits_declared<T>::value &&
+                                is_list_like<T>::value &&
+                                is_back_insertable<T>::value &&
+                                !is_byte<typename T::value_type>::value
+    >::type> : std::true_type {};
+
+} // namespace detail
+
+    // Used by the decode_traits specializations that the macros generate, which
+    // read the members of an object directly from the cursor events
+
+    template <class CharT>
+    struct decode_traits_helper
+    {
+        template <class T,class Json,class TempAllocator> 
+        static void decode_member(basic_staj_cursor<CharT>& cursor, 
+                                  json_decoder<Json,TempAllocator>& decoder, 
+                                  T& val, 
+                                  std::error_code& ec) 
+        { 
+            val = decode<T>(cursor, decoder, ec); 
+        } 
+        template <class T,class Json,class TempAllocator> 
+        static void decode_member(basic_staj_cursor<CharT>& cursor, 
+                                  json_decoder<Json,TempAllocator>&, 
+                                  const T&, 
+                                  std::error_code& ec) 
+        { 
+            cursor.skip(ec); 
+        } 
+
+        // Reads a value as basic_json::as<T>() would convert it, and throws what as<T>() would throw.
+        // Types generated by the macros are read from the cursor, as are containers of them, and numbers,
+        // bools and strings that as<T>() takes as they are. Anything else is read into a basic_json
+        // and converted with as<T>(). If it throws, the cursor is left at the end of the value.
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            return decode_traits<T,CharT>::decode(cursor, decoder, ec);
+        } 
+
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<!jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value && 
+                                       jsoncons::detail::is_integer<T>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            switch (cursor.current().event_type())
+            {
+                case staj_event_type::int64_value:
+                case staj_event_type::uint64_value:
+                case staj_event_type::half_value:
+                case staj_event_type::double_value:
+                case staj_event_type::bool_value:
+                    return cursor.current().template get<T>(ec);
+                default:
+                    return decode_json_value<T>(cursor, decoder, ec);
+            }
+        } 
+
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<!jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value && 
+                                       std::is_floating_point<T>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            switch (cursor.current().event_type())
+            {
+                case staj_event_type::int64_value:
+                case staj_event_type::uint64_value:
+                case staj_event_type::half_value:
+                case staj_event_type::double_value:
+                    return cursor.current().template get<T>(ec);
+                default:
+                    return decode_json_value<T>(cursor, decoder, ec);
+            }
+        } 
+
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<!jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value && 
+                                       jsoncons::detail::is_bool<T>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            switch (cursor.current().event_type())
+            {
+                case staj_event_type::bool_value:
+                case staj_event_type::int64_value:
+                case staj_event_type::uint64_value:
+                    return cursor.current().template get<T>(ec);
+                default:
+                    return decode_json_value<T>(cursor, decoder, ec);
+            }
+        } 
+
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<!jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value && 
+                                       jsoncons::detail::is_json_traits_macro_decode_string<T,CharT>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            if (cursor.current().event_type() != staj_event_type::string_value)
+            {
+                return decode_json_value<T>(cursor, decoder, ec);
+            }
+            auto sv = cursor.current().template get<jsoncons::basic_string_view<CharT>>(ec);
+            return T(sv.data(), sv.size());
+        } 
+
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<!jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value && 
+                                       jsoncons::detail::is_json_traits_macro_decode_list<T>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            using value_type = typename T::value_type;
+
+            if (cursor.current().event_type() != staj_event_type::begin_array)
+            {
+                return decode_json_value<T>(cursor, decoder, ec);
+            }
+            T result;
+            std::exception_ptr failure;
+            cursor.next(ec);
+            while (!ec && cursor.current().event_type() != staj_event_type::end_array)
+            {
+                if (failure)
+                {
+                    cursor.skip(ec);
+                }
+                else
+                {
+                    JSONCONS_TRY
+                    {
+                        result.push_back(decode<value_type>(cursor, decoder, ec));
+                    }
+                    JSONCONS_CATCH(...)
+                    {
+                        failure = std::current_exception();
+                    }
+                }
+                if (!ec)
+                {
+                    cursor.next(ec);
+                }
+            }
+            if (!ec && failure)
+            {
+                std::rethrow_exception(failure);
+            }
+            return result;
+        } 
+
+        template <class T,class Json,class TempAllocator> 
+        static typename std::enable_if<!jsoncons::detail::is_json_traits_macro_decode<T,CharT>::value && 
+                                       !jsoncons::detail::is_primitive<T>::value &&
+                                       !jsoncons::detail::is_json_traits_macro_decode_string<T,CharT>::value &&
+                                       !jsoncons::detail::is_json_traits_macro_decode_list<T>::value,T>::type
+        decode(basic_staj_cursor<CharT>& cursor, 
+               json_decoder<Json,TempAllocator>& decoder, 
+               std::error_code& ec) 
+        { 
+            return decode_json_value<T>(cursor, decoder, ec);
+        } 
+
+        // Reads a member that has a Match function. As in is(), a value that does not convert does not match
+        template <class T,class Match,class Json,class TempAllocator> 
+        static jsoncons::optional<T> decode_match(basic_staj_cursor<CharT>& cursor, 
+                                                  json_decoder<Json,TempAllocator>& decoder, 
+                                                  Match match,
+                                                  bool& valid,
+                                                  std::error_code& ec) 
+        { 
+            JSONCONS_TRY
+            {
+                T val = decode<T>(cursor, decoder, ec);
+                if (ec || match(val))
+                {
+                    return jsoncons::optional<T>(std::move(val));
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+            }
+            valid = false;
+            return jsoncons::optional<T>();
+        } 
+
+        // What decode_traits does for types without a specialization
+        template <class T,class Json,class TempAllocator> 
+        static T decode_json_value(basic_staj_cursor<CharT>& cursor, 
+                                   json_decoder<Json,TempAllocator>& decoder, 
+                                   std::error_code& ec) 
+        { 
+            decoder.reset();
+            cursor.read_to(decoder, ec);
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(ser_error(conv_errc::conversion_failed, cursor.context().line(), cursor.context().column()));
+            }
+            return decoder.get_result().template as<T>();
+        } 
+
+        template <class T,class U> 
+        static void set_member(T& val, U&& u) 
+        { 
+            val = std::forward<U>(u); 
+        } 
+        template <class T,class U> 
+        static void set_member(const T&, U&&) 
+        { 
+        } 
+
+        template <class T> 
+        static typename std::enable_if<std::is_default_constructible<T>::value,T>::type
+        value_or_default(jsoncons::optional<T>&& val) 
+        { 
+            return val ? std::move(*val) : T(); 
+        } 
+        // Only called when the value is present, a missing mandatory member is reported first
+        template <class T> 
+        static typename std::enable_if<!std::is_default_constructible<T>::value,T>::type
+        value_or_default(jsoncons::optional<T>&& val) 
+        { 
+            return std::move(*val); 
+        } 
+    };
+
+    // Used by the encode_traits specializations that the macros generate, which
+    // write the members of an object directly to the visitor
+
+    template <class CharT>
+    struct encode_traits_helper
+    {
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+
+        // The Counts of the members ordered by name, the first member in the list has Count N
+        template <std::size_t N>
+        static std::array<std::size_t,N> sorted_order(const std::array<string_view_type,N>& names)
+        {
+            std::array<std::size_t,N> order;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                order[i] = N - i;
+            }
+            std::stable_sort(order.begin(), order.end(), 
+                             [&names](std::size_t a, std::size_t b) -> bool {return names[N-a].compare(names[N-b]) < 0;});
+            return order;
+        }
+
+        template <class T> 
+        static std::size_t member_count(const T&) 
+        { 
+            return 1; 
+        } 
+        template <class U> 
+        static std::size_t member_count(const std::shared_ptr<U>& val) 
+        { 
+            return val ? 1 : 0; 
+        } 
+        template <class U> 
+        static std::size_t member_count(const std::unique_ptr<U>& val) 
+        { 
+            return val ? 1 : 0; 
+        } 
+        template <class U> 
+        static std::size_t member_count(const jsoncons::optional<U>& val) 
+        { 
+            return val ? 1 : 0; 
+        } 
+
+        template <class T,class Json> 
+        static void encode_member(const string_view_type& name, 
+                                  const T& val, 
+                                  basic_json_visitor<CharT>& encoder, 
+                                  const Json& proto, 
+                                  std::error_code& ec) 
+        { 
+            encoder.key(name, ser_context(), ec); 
+            if (ec) return; 
+            encode_traits<T,CharT>::encode(val, encoder, proto, ec); 
+        } 
+
+        // Like set_optional_json_member, leaves out null pointers and empty optionals
+        template <class T,class Json> 
+        static void encode_optional_member(const string_view_type& name, 
+                                           const T& val, 
+                                           basic_json_visitor<CharT>& encoder, 
+                                           const Json& proto, 
+                                           std::error_code& ec) 
+        { 
+            encode_member(name, val, encoder, proto, ec); 
+        } 
+        template <class U,class Json> 
+        static void encode_optional_member(const string_view_type& name, 
+                                           const std::shared_ptr<U>& val, 
+                                           basic_json_visitor<CharT>& encoder, 
+                                           const Json& proto, 
+                                           std::error_code& ec) 
+        { 
+            if (val) encode_member(name, val, encoder, proto, ec); 
+        } 
+        template <class U,class Json> 
+        static void encode_optional_member(const string_view_type& name, 
+                                           const std::unique_ptr<U>& val, 
+                                           basic_json_visitor<CharT>& encoder, 
+                                           const Json& proto, 
+                                           std::error_code& ec) 
+        { 
+            if (val) encode_member(name, val, encoder, proto, ec); 
+        } 
+        template <class U,class Json> 
+        static void encode_optional_member(const string_view_type& name, 
+                                           const jsoncons::optional<U>& val, 
+                                           basic_json_visitor<CharT>& encoder, 
+                                           const Json& proto, 
+                                           std::error_code& ec) 
+        { 
+            if (val) encode_member(name, *val, encoder, proto, ec); 
+        } 
+    };
 }
 
 #if defined(_MSC_VER)
@@ -165,7 +527,11 @@ namespace jsoncons
 
 #define JSONCONS_TYPE_TRAITS_FRIEND \
     template <class JSON,class T,class Enable> \
-    friend struct jsoncons::json_type_traits;
+    friend struct jsoncons::json_type_traits; \
+    template <class T,class CharT,class Enable> \
+    friend struct jsoncons::decode_traits; \
+    template <class T,class CharT,class Enable> \
+    friend struct jsoncons::encode_traits;
 
 #define JSONCONS_EXPAND_CALL2(Call, Expr, Id) JSONCONS_EXPAND(Call(Expr, Id))
 
@@ -259,6 +625,206 @@ namespace jsoncons
 #define JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
     ajson.try_emplace(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}), aval.Member);
 
+#define JSONCONS_DECODE_MEMBER_BIT(Count) (uint64_t(1) << (num_params-(Count)))
+
+// Reads the members of an object from the cursor. KeyIndex maps a key to the Count of its member,
+// DecodeMember decodes the value of the member with that Count, and unknown and repeated members are
+// skipped, as json keeps the first of repeated members. A member that fails to convert does not stop
+// the object from being read, since as<T>() reports a missing or unmatched member first; its exception
+// is rethrown afterwards, the one of the first member in declaration order if more than one fails.
+// After a missing or unmatched member the rest of the object is skipped, so that the cursor is left
+// at the end of the value as it would be had the value been read into a basic_json
+#define JSONCONS_DECODE_OBJECT_MEMBERS(KeyIndex, DecodeMember, P2, P3, ...) \
+            uint64_t found = 0; \
+            bool valid = true; \
+            std::exception_ptr failure; \
+            std::size_t failure_index = 0; \
+            if (cursor.current().event_type() != staj_event_type::begin_object) \
+            { \
+                valid = false; \
+                cursor.skip(ec); \
+            } \
+            else \
+            { \
+                cursor.next(ec); \
+                while (valid && !ec && cursor.current().event_type() != staj_event_type::end_object) \
+                { \
+                    if (cursor.current().event_type() != staj_event_type::key) \
+                    { \
+                        ec = json_errc::expected_key; \
+                        break; \
+                    } \
+                    std::size_t index = 0; \
+                    { \
+                        auto key = cursor.current().template get<jsoncons::basic_string_view<char_type>>(ec); \
+                        if (ec) break; \
+                        if (false) {} \
+                        JSONCONS_VARIADIC_REP_N(KeyIndex, ,P2,P3, __VA_ARGS__) \
+                    } \
+                    if (index != 0) \
+                    { \
+                        if (found & JSONCONS_DECODE_MEMBER_BIT(index)) \
+                        { \
+                            index = 0; \
+                        } \
+                        else \
+                        { \
+                            found |= JSONCONS_DECODE_MEMBER_BIT(index); \
+                        } \
+                    } \
+                    cursor.next(ec); \
+                    if (ec) break; \
+                    JSONCONS_TRY \
+                    { \
+                        switch (index) \
+                        { \
+                            JSONCONS_VARIADIC_REP_N(DecodeMember, ,P2,P3, __VA_ARGS__) \
+                            default: \
+                                cursor.skip(ec); \
+                                break; \
+                        } \
+                    } \
+                    JSONCONS_CATCH(...) \
+                    { \
+                        if (index > failure_index) \
+                        { \
+                            failure = std::current_exception(); \
+                            failure_index = index; \
+                        } \
+                    } \
+                    if (!ec) \
+                    { \
+                        cursor.next(ec); \
+                    } \
+                } \
+                while (!valid && !ec && cursor.current().event_type() != staj_event_type::end_object) \
+                { \
+                    cursor.next(ec); \
+                    if (!ec) \
+                    { \
+                        cursor.skip(ec); \
+                    } \
+                    if (!ec) \
+                    { \
+                        cursor.next(ec); \
+                    } \
+                } \
+            } \
+            /**/
+
+#define JSONCONS_MEMBER_KEY_INDEX(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_KEY_INDEX_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_KEY_INDEX_LAST(Prefix, P2, P3, Member, Count) \
+    else if (key == json_traits_macro_names<char_type,value_type>::Member##_str(char_type{})) {index = Count;}
+
+#define JSONCONS_MEMBER_MISSING(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_MISSING_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_MISSING_LAST(Prefix, P2, P3, Member, Count) \
+    if ((num_params-Count) < num_mandatory_params1 && !(found & JSONCONS_DECODE_MEMBER_BIT(Count))) {valid = false;}
+
+#define JSONCONS_MEMBER_DECODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count) \
+    case Count: decode_traits_helper<char_type>::decode_member(cursor, decoder, aval.Member, ec); break;
+
+// Writes the members of an object to the visitor. MemberName gives the name of the member with a Count,
+// CountMember counts the members that are written, and EncodeMember writes the member with that Count.
+// The members are written in the order that the Json object type would keep them, other key orders
+// go through json_type_traits::to_json
+#define JSONCONS_ENCODE_OBJECT_MEMBERS(MemberName, CountMember, EncodeMember, P2, P3, ...) \
+        template <class Json> \
+        static void encode(const value_type& aval, \
+                           basic_json_visitor<char_type>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            encode(typename Json::implementation_policy::key_order(), aval, encoder, proto, ec); \
+        } \
+    private: \
+        static const std::array<jsoncons::basic_string_view<char_type>,num_params>& member_names() \
+        { \
+            static const std::array<jsoncons::basic_string_view<char_type>,num_params> names = {{JSONCONS_VARIADIC_REP_N(MemberName, ,P2,P3, __VA_ARGS__)}}; \
+            return names; \
+        } \
+        static std::size_t member_count(const value_type& aval) \
+        { \
+            (void)aval; \
+            std::size_t count = 0; \
+            JSONCONS_VARIADIC_REP_N(CountMember, ,P2,P3, __VA_ARGS__) \
+            return count; \
+        } \
+        template <class Json> \
+        static void encode_member(std::size_t index, \
+                                  const value_type& aval, \
+                                  const std::array<jsoncons::basic_string_view<char_type>,num_params>& names, \
+                                  basic_json_visitor<char_type>& encoder, \
+                                  const Json& proto, \
+                                  std::error_code& ec) \
+        { \
+            switch (index) \
+            { \
+                JSONCONS_VARIADIC_REP_N(EncodeMember, ,P2,P3, __VA_ARGS__) \
+                default: \
+                    break; \
+            } \
+        } \
+        template <class Json> \
+        static void encode(preserve_key_order, \
+                           const value_type& aval, \
+                           basic_json_visitor<char_type>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            const auto& names = member_names(); \
+            encoder.begin_object(member_count(aval), semantic_tag::none, ser_context(), ec); \
+            for (std::size_t index = num_params; index > 0 && !ec; --index) \
+            { \
+                encode_member(index, aval, names, encoder, proto, ec); \
+            } \
+            if (ec) return; \
+            encoder.end_object(ser_context(), ec); \
+        } \
+        template <class Json> \
+        static void encode(sort_key_order, \
+                           const value_type& aval, \
+                           basic_json_visitor<char_type>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            static const std::array<std::size_t,num_params> order = encode_traits_helper<char_type>::sorted_order(member_names()); \
+            const auto& names = member_names(); \
+            encoder.begin_object(member_count(aval), semantic_tag::none, ser_context(), ec); \
+            for (std::size_t i = 0; i < num_params && !ec; ++i) \
+            { \
+                encode_member(order[i], aval, names, encoder, proto, ec); \
+            } \
+            if (ec) return; \
+            encoder.end_object(ser_context(), ec); \
+        } \
+        template <class Json,class KeyOrder> \
+        static void encode(KeyOrder, \
+                           const value_type& aval, \
+                           basic_json_visitor<char_type>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            auto j = json_type_traits<Json,value_type>::to_json(aval, proto.get_allocator()); \
+            j.dump(encoder, ec); \
+        } \
+        /**/
+
+#define JSONCONS_MEMBER_KEY(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_KEY_LAST(Prefix, P2, P3, Member, Count),
+#define JSONCONS_MEMBER_KEY_LAST(Prefix, P2, P3, Member, Count) jsoncons::basic_string_view<char_type>(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}))
+
+#define JSONCONS_MEMBER_COUNT(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count) \
+    if ((num_params-Count) < num_mandatory_params2) {++count;} \
+    else {count += encode_traits_helper<char_type>::member_count(aval.Member);}
+
+#define JSONCONS_MEMBER_ENCODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count) \
+    case Count: \
+        if ((num_params-Count) < num_mandatory_params2) {encode_traits_helper<char_type>::encode_member(names[num_params-Count], aval.Member, encoder, proto, ec);} \
+        else {encode_traits_helper<char_type>::encode_optional_member(names[num_params-Count], aval.Member, encoder, proto, ec);} \
+        break;
+
 #define JSONCONS_MEMBER_TRAITS_BASE(AsT,ToJ,NumTemplateParams,ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -297,6 +863,45 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using json_traits_macro_decode = std::true_type; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            JSONCONS_DECODE_OBJECT_MEMBERS(JSONCONS_MEMBER_KEY_INDEX, JSONCONS_MEMBER_DECODE, , , __VA_ARGS__) \
+            if (!ec && valid) \
+            { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_MISSING, ,,, __VA_ARGS__) \
+            } \
+            if (!ec && !valid) \
+            { \
+                JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            if (!ec && failure) \
+            { \
+                std::rethrow_exception(failure); \
+            } \
+            return aval; \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_ENCODE_OBJECT_MEMBERS(JSONCONS_MEMBER_KEY, JSONCONS_MEMBER_COUNT, JSONCONS_MEMBER_ENCODE, , , __VA_ARGS__) \
+    }; \
 } \
   /**/
 
@@ -327,7 +932,7 @@ namespace jsoncons \
 #define JSONCONS_MEMBER_NAME_IS_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, , )
 #define JSONCONS_MEMBER_NAME_IS_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, )
 #define JSONCONS_MEMBER_NAME_IS_6(Member, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into(((value_type*)nullptr)->Member))>::type>())) return false;} \
+    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into(std::declval<value_type*>()->Member))>::type>())) return false;} \
     JSONCONS_CATCH(...) {return false;}
 
 #define JSONCONS_N_MEMBER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
@@ -338,9 +943,9 @@ namespace jsoncons \
 #define JSONCONS_N_MEMBER_NAME_AS_4(Member, Name, Mode, Match) \
     Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::set_udt_member(ajson,Name,aval.Member);})
 #define JSONCONS_N_MEMBER_NAME_AS_5(Member, Name, Mode, Match, Into) \
-    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(((value_type*)nullptr)->Member))>::type>(ajson,Name,aval.Member);})
+    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(std::declval<value_type*>()->Member))>::type>(ajson,Name,aval.Member);})
 #define JSONCONS_N_MEMBER_NAME_AS_6(Member, Name, Mode, Match, Into, From) \
-    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(((value_type*)nullptr)->Member))>::type>(ajson,Name,From,aval.Member);})
+    Mode(if (ajson.contains(Name)) {json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(std::declval<value_type*>()->Member))>::type>(ajson,Name,From,aval.Member);})
 
 #define JSONCONS_ALL_MEMBER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_ALL_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_ALL_MEMBER_NAME_AS_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_ALL_MEMBER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
@@ -350,9 +955,9 @@ namespace jsoncons \
 #define JSONCONS_ALL_MEMBER_NAME_AS_4(Member, Name, Mode, Match) \
     Mode(json_traits_helper<Json>::set_udt_member(ajson,Name,aval.Member);)
 #define JSONCONS_ALL_MEMBER_NAME_AS_5(Member, Name, Mode, Match, Into) \
-    Mode(json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(((value_type*)nullptr)->Member))>::type>(ajson,Name,aval.Member);)
+    Mode(json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(std::declval<value_type*>()->Member))>::type>(ajson,Name,aval.Member);)
 #define JSONCONS_ALL_MEMBER_NAME_AS_6(Member, Name, Mode, Match, Into, From) \
-    Mode(json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(((value_type*)nullptr)->Member))>::type>(ajson,Name,From,aval.Member);)
+    Mode(json_traits_helper<Json>::template set_udt_member<typename std::decay<decltype(Into(std::declval<value_type*>()->Member))>::type>(ajson,Name,From,aval.Member);)
 
 #define JSONCONS_N_MEMBER_NAME_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_N_MEMBER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_N_MEMBER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
@@ -376,6 +981,58 @@ else \
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_5(Member, Name, Mode, Match, Into) JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, )
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, From) ajson.try_emplace(Name, Into(aval.Member));
 
+#define JSONCONS_MEMBER_NAME_KEY_INDEX(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_KEY_INDEX_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_KEY_INDEX_LAST(P1, P2, P3, Seq, Count) else if (key == JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_KEY_,JSONCONS_NARGS Seq) Seq)) {index = Count;}
+#define JSONCONS_MEMBER_NAME_KEY_2(Member, Name) Name
+#define JSONCONS_MEMBER_NAME_KEY_3(Member, Name, Mode) Name
+#define JSONCONS_MEMBER_NAME_KEY_4(Member, Name, Mode, Match) Name
+#define JSONCONS_MEMBER_NAME_KEY_5(Member, Name, Mode, Match, Into) Name
+#define JSONCONS_MEMBER_NAME_KEY_6(Member, Name, Mode, Match, Into, From) Name
+
+#define JSONCONS_MEMBER_NAME_MISSING(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_MISSING_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_MISSING_LAST(P1, P2, P3, Seq, Count) \
+    if (((num_params-Count) < num_mandatory_params1 || JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_HAS_MATCH_,JSONCONS_NARGS Seq) Seq)) && !(found & JSONCONS_DECODE_MEMBER_BIT(Count))) {valid = false;}
+#define JSONCONS_MEMBER_NAME_HAS_MATCH_2(Member, Name) false
+#define JSONCONS_MEMBER_NAME_HAS_MATCH_3(Member, Name, Mode) false
+#define JSONCONS_MEMBER_NAME_HAS_MATCH_4(Member, Name, Mode, Match) true
+#define JSONCONS_MEMBER_NAME_HAS_MATCH_5(Member, Name, Mode, Match, Into) true
+#define JSONCONS_MEMBER_NAME_HAS_MATCH_6(Member, Name, Mode, Match, Into, From) true
+
+#define JSONCONS_MEMBER_NAME_DECODE(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count) case Count: JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_DECODE_,JSONCONS_NARGS Seq) Seq) break;
+#define JSONCONS_MEMBER_NAME_DECODE_2(Member, Name) \
+    decode_traits_helper<char_type>::decode_member(cursor, decoder, aval.Member, ec);
+#define JSONCONS_MEMBER_NAME_DECODE_3(Member, Name, Mode) \
+    if (false Mode(|| true)) {Mode(JSONCONS_MEMBER_NAME_DECODE_2(Member, Name))} else {cursor.skip(ec);}
+#define JSONCONS_MEMBER_NAME_DECODE_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_DECODE_6(Member, Name, Mode, Match, , )
+#define JSONCONS_MEMBER_NAME_DECODE_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_DECODE_6(Member, Name, Mode, Match, Into, )
+#define JSONCONS_MEMBER_NAME_DECODE_6(Member, Name, Mode, Match, Into, From) \
+    { \
+        auto val = decode_traits_helper<char_type>::template decode_match<typename std::decay<decltype(Into(std::declval<value_type*>()->Member))>::type>(cursor, decoder, Match, valid, ec); \
+        Mode(if (!ec && valid) {decode_traits_helper<char_type>::set_member(aval.Member, From(std::move(*val)));}) \
+    }
+
+#define JSONCONS_MEMBER_NAME_ENCODE_KEY(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_ENCODE_KEY_LAST(P1, P2, P3, Seq, Count),
+#define JSONCONS_MEMBER_NAME_ENCODE_KEY_LAST(P1, P2, P3, Seq, Count) jsoncons::basic_string_view<char_type>(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_KEY_,JSONCONS_NARGS Seq) Seq))
+
+#define JSONCONS_MEMBER_NAME_VALUE_2(Member, Name) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_3(Member, Name, Mode) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_4(Member, Name, Mode, Match) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_5(Member, Name, Mode, Match, Into) Into(aval.Member)
+#define JSONCONS_MEMBER_NAME_VALUE_6(Member, Name, Mode, Match, Into, From) Into(aval.Member)
+
+#define JSONCONS_MEMBER_NAME_COUNT(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) \
+    if ((num_params-Count) < num_mandatory_params2) {++count;} \
+    else {count += encode_traits_helper<char_type>::member_count(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq));}
+
+#define JSONCONS_MEMBER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) \
+    case Count: \
+        if ((num_params-Count) < num_mandatory_params2) {encode_traits_helper<char_type>::encode_member(names[num_params-Count], JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq), encoder, proto, ec);} \
+        else {encode_traits_helper<char_type>::encode_optional_member(names[num_params-Count], JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq), encoder, proto, ec);} \
+        break;
+
 #define JSONCONS_MEMBER_NAME_TRAITS_BASE(AsT,ToJ, NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -409,6 +1066,45 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using json_traits_macro_decode = std::true_type; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            JSONCONS_DECODE_OBJECT_MEMBERS(JSONCONS_MEMBER_NAME_KEY_INDEX, JSONCONS_MEMBER_NAME_DECODE, , , __VA_ARGS__) \
+            if (!ec && valid) \
+            { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_MISSING, ,,, __VA_ARGS__) \
+            } \
+            if (!ec && !valid) \
+            { \
+                JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            if (!ec && failure) \
+            { \
+                std::rethrow_exception(failure); \
+            } \
+            return aval; \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_ENCODE_OBJECT_MEMBERS(JSONCONS_MEMBER_NAME_ENCODE_KEY, JSONCONS_MEMBER_NAME_COUNT, JSONCONS_MEMBER_NAME_ENCODE, , , __VA_ARGS__) \
+    }; \
 } \
   /**/
 
@@ -437,7 +1133,7 @@ namespace jsoncons \
 #define JSONCONS_CTOR_GETTER_IS_LAST(Prefix, P2, P3, Getter, Count) if ((num_params-Count) < num_mandatory_params1 && !ajson.contains(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))) return false;
 
 #define JSONCONS_CTOR_GETTER_AS(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count),
-#define JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count) ((num_params-Count) < num_mandatory_params2) ? (ajson.at(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))).template as<typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type>() : (ajson.contains(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{})) ? (ajson.at(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))).template as<typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type>() : typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type())
+#define JSONCONS_CTOR_GETTER_AS_LAST(Prefix, P2, P3, Getter, Count) ((num_params-Count) < num_mandatory_params2) ? (ajson.at(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))).template as<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type>() : (ajson.contains(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{})) ? (ajson.at(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}))).template as<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type>() : typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type())
 
 #define JSONCONS_CTOR_GETTER_TO_JSON(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_TO_JSON_LAST(Prefix, P2, P3, Getter, Count)
 
@@ -449,6 +1145,29 @@ else { \
   json_traits_helper<Json>::set_optional_json_member(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}), aval.Getter(), ajson); \
 }
 
+#define JSONCONS_CTOR_GETTER_DECL(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_DECL_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_DECL_LAST(Prefix, P2, P3, Getter, Count) \
+    jsoncons::optional<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type> Getter##_;
+
+#define JSONCONS_CTOR_GETTER_DECODE(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_DECODE_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_DECODE_LAST(Prefix, P2, P3, Getter, Count) \
+    case Count: Getter##_ = decode_traits_helper<char_type>::template decode<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type>(cursor, decoder, ec); break;
+
+#define JSONCONS_CTOR_GETTER_ARG(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_ARG_LAST(Prefix, P2, P3, Getter, Count),
+#define JSONCONS_CTOR_GETTER_ARG_LAST(Prefix, P2, P3, Getter, Count) decode_traits_helper<char_type>::value_or_default(std::move(Getter##_))
+
+#define JSONCONS_CTOR_GETTER_COUNT(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_COUNT_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_COUNT_LAST(Prefix, P2, P3, Getter, Count) \
+    if ((num_params-Count) < num_mandatory_params2) {++count;} \
+    else {count += encode_traits_helper<char_type>::member_count(aval.Getter());}
+
+#define JSONCONS_CTOR_GETTER_ENCODE(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_ENCODE_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_ENCODE_LAST(Prefix, P2, P3, Getter, Count) \
+    case Count: \
+        if ((num_params-Count) < num_mandatory_params2) {encode_traits_helper<char_type>::encode_member(names[num_params-Count], aval.Getter(), encoder, proto, ec);} \
+        else {encode_traits_helper<char_type>::encode_optional_member(names[num_params-Count], aval.Getter(), encoder, proto, ec);} \
+        break;
+
 #define JSONCONS_CTOR_GETTER_TRAITS_BASE(NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -485,6 +1204,49 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using json_traits_macro_decode = std::true_type; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_DECL, ,,, __VA_ARGS__) \
+            JSONCONS_DECODE_OBJECT_MEMBERS(JSONCONS_MEMBER_KEY_INDEX, JSONCONS_CTOR_GETTER_DECODE, , , __VA_ARGS__) \
+            if (!ec && valid) \
+            { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_MISSING, ,,, __VA_ARGS__) \
+            } \
+            if (!ec && !valid) \
+            { \
+                JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            if (!ec && failure) \
+            { \
+                std::rethrow_exception(failure); \
+            } \
+            if (ec) \
+            { \
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column())); \
+            } \
+            return value_type ( JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_ARG, ,,, __VA_ARGS__) ); \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_ENCODE_OBJECT_MEMBERS(JSONCONS_MEMBER_KEY, JSONCONS_CTOR_GETTER_COUNT, JSONCONS_CTOR_GETTER_ENCODE, , , __VA_ARGS__) \
+    }; \
 } \
   /**/
  
@@ -515,7 +1277,7 @@ namespace jsoncons \
 #define JSONCONS_CTOR_GETTER_NAME_IS_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, , )
 #define JSONCONS_CTOR_GETTER_NAME_IS_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, Into, )
 #define JSONCONS_CTOR_GETTER_NAME_IS_6(Getter, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into(((value_type*)nullptr)->Getter()))>::type>())) return false;} \
+    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into(std::declval<value_type*>()->Getter()))>::type>())) return false;} \
     JSONCONS_CATCH(...) {return false;}
 
 #define JSONCONS_CTOR_GETTER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_AS_,JSONCONS_NARGS Seq) Seq)
@@ -527,11 +1289,11 @@ namespace jsoncons \
 #define JSONCONS_COMMA ,
 
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_AS_LAST_,JSONCONS_NARGS Seq) Seq)
-#define JSONCONS_CTOR_GETTER_NAME_AS_LAST_2(Getter, Name) (ajson.contains(Name)) ? (ajson.at(Name)).template as<typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type>() : typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type()
+#define JSONCONS_CTOR_GETTER_NAME_AS_LAST_2(Getter, Name) (ajson.contains(Name)) ? (ajson.at(Name)).template as<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type>() : typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type()
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST_3(Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_AS_LAST_2(Getter, Name))
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_AS_LAST_6(Getter, Name, Mode, Match,,)
 #define JSONCONS_CTOR_GETTER_NAME_AS_LAST_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_AS_LAST_6(Getter, Name, Mode, Match, Into, )
-#define JSONCONS_CTOR_GETTER_NAME_AS_LAST_6(Getter, Name, Mode, Match, Into, From) Mode(ajson.contains(Name) ? From(ajson.at(Name).template as<typename std::decay<decltype(Into(((value_type*)nullptr)->Getter()))>::type>()) : From(typename std::decay<decltype(Into(((value_type*)nullptr)->Getter()))>::type()))
+#define JSONCONS_CTOR_GETTER_NAME_AS_LAST_6(Getter, Name, Mode, Match, Into, From) Mode(ajson.contains(Name) ? From(ajson.at(Name).template as<typename std::decay<decltype(Into(std::declval<value_type*>()->Getter()))>::type>()) : From(typename std::decay<decltype(Into(std::declval<value_type*>()->Getter()))>::type()))
 
 #define JSONCONS_CTOR_GETTER_NAME_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count)
 #define JSONCONS_CTOR_GETTER_NAME_TO_JSON_LAST(P1, P2, P3, Seq, Count) if ((num_params-Count) < num_mandatory_params2) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_TO_JSON_,JSONCONS_NARGS Seq) Seq)
@@ -553,6 +1315,62 @@ else { \
   json_traits_helper<Json>::set_optional_json_member(Name, Into(aval.Getter()), ajson); \
 }
 
+#define JSONCONS_CTOR_GETTER_NAME_DECL(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_DECL_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_DECL_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_DECL_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_DECL_2(Getter, Name) \
+    jsoncons::optional<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type> Getter##_;
+#define JSONCONS_CTOR_GETTER_NAME_DECL_3(Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_DECL_2(Getter, Name))
+#define JSONCONS_CTOR_GETTER_NAME_DECL_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_DECL_6(Getter, Name, Mode, Match, , )
+#define JSONCONS_CTOR_GETTER_NAME_DECL_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_DECL_6(Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_DECL_6(Getter, Name, Mode, Match, Into, From) \
+    Mode(jsoncons::optional<typename std::decay<decltype(Into(std::declval<value_type*>()->Getter()))>::type> Getter##_;)
+
+#define JSONCONS_CTOR_GETTER_NAME_DECODE(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count) case Count: JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_DECODE_,JSONCONS_NARGS Seq) Seq) break;
+#define JSONCONS_CTOR_GETTER_NAME_DECODE_2(Getter, Name) \
+    Getter##_ = decode_traits_helper<char_type>::template decode<typename std::decay<decltype(std::declval<value_type*>()->Getter())>::type>(cursor, decoder, ec);
+#define JSONCONS_CTOR_GETTER_NAME_DECODE_3(Getter, Name, Mode) \
+    if (false Mode(|| true)) {Mode(JSONCONS_CTOR_GETTER_NAME_DECODE_2(Getter, Name))} else {cursor.skip(ec);}
+#define JSONCONS_CTOR_GETTER_NAME_DECODE_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_DECODE_6(Getter, Name, Mode, Match, , )
+#define JSONCONS_CTOR_GETTER_NAME_DECODE_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_DECODE_6(Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_DECODE_6(Getter, Name, Mode, Match, Into, From) \
+    { \
+        auto val = decode_traits_helper<char_type>::template decode_match<typename std::decay<decltype(Into(std::declval<value_type*>()->Getter()))>::type>(cursor, decoder, Match, valid, ec); \
+        Mode(if (!ec && valid) {Getter##_ = std::move(*val);}) \
+    }
+
+#define JSONCONS_CTOR_GETTER_NAME_ARG(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_ARG_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_2(Getter, Name) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Getter, Name) JSONCONS_COMMA
+#define JSONCONS_CTOR_GETTER_NAME_ARG_3(Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Getter, Name)) Mode(JSONCONS_COMMA)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_ARG_6(Getter, Name, Mode, Match,,)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_ARG_6(Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_ARG_6(Getter, Name, Mode, Match, Into, From) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Getter, Name, Mode, Match, Into, From) Mode(JSONCONS_COMMA)
+
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_ARG_LAST_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Getter, Name) decode_traits_helper<char_type>::value_or_default(std::move(Getter##_))
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_3(Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Getter, Name))
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_4(Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Getter, Name, Mode, Match,,)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_5(Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Getter, Name, Mode, Match, Into, From) Mode(From(decode_traits_helper<char_type>::value_or_default(std::move(Getter##_))))
+
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_2(Getter, Name) aval.Getter()
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_3(Getter, Name, Mode) aval.Getter()
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_4(Getter, Name, Mode, Match) aval.Getter()
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_5(Getter, Name, Mode, Match, Into) Into(aval.Getter())
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_6(Getter, Name, Mode, Match, Into, From) Into(aval.Getter())
+
+#define JSONCONS_CTOR_GETTER_NAME_COUNT(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) \
+    if ((num_params-Count) < num_mandatory_params2) {++count;} \
+    else {count += encode_traits_helper<char_type>::member_count(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq));}
+
+#define JSONCONS_CTOR_GETTER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) \
+    case Count: \
+        if ((num_params-Count) < num_mandatory_params2) {encode_traits_helper<char_type>::encode_member(names[num_params-Count], JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq), encoder, proto, ec);} \
+        else {encode_traits_helper<char_type>::encode_optional_member(names[num_params-Count], JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq), encoder, proto, ec);} \
+        break;
+
 #define JSONCONS_CTOR_GETTER_NAME_TRAITS_BASE(NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -584,6 +1402,49 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using json_traits_macro_decode = std::true_type; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_NAME_DECL, ,,, __VA_ARGS__) \
+            JSONCONS_DECODE_OBJECT_MEMBERS(JSONCONS_MEMBER_NAME_KEY_INDEX, JSONCONS_CTOR_GETTER_NAME_DECODE, , , __VA_ARGS__) \
+            if (!ec && valid) \
+            { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_MISSING, ,,, __VA_ARGS__) \
+            } \
+            if (!ec && !valid) \
+            { \
+                JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            if (!ec && failure) \
+            { \
+                std::rethrow_exception(failure); \
+            } \
+            if (ec) \
+            { \
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column())); \
+            } \
+            return value_type ( JSONCONS_VARIADIC_REP_N(JSONCONS_CTOR_GETTER_NAME_ARG, ,,, __VA_ARGS__) ); \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_ENCODE_OBJECT_MEMBERS(JSONCONS_MEMBER_NAME_ENCODE_KEY, JSONCONS_CTOR_GETTER_NAME_COUNT, JSONCONS_CTOR_GETTER_NAME_ENCODE, , , __VA_ARGS__) \
+    }; \
 } \
   /**/
                                                                        
@@ -829,6 +1690,25 @@ else \
 #define JSONCONS_ALL_GETTER_SETTER_TO_JSON_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_ALL_GETTER_SETTER_TO_JSON_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
 #define JSONCONS_ALL_GETTER_SETTER_TO_JSON_(Prefix, Getter, Setter, Property, Count) ajson.try_emplace(json_traits_macro_names<char_type,value_type>::Property##_str(char_type{}), aval.Getter() );
 
+#define JSONCONS_GETTER_SETTER_DECODE(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_GETTER_SETTER_DECODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count)
+#define JSONCONS_GETTER_SETTER_DECODE_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_GETTER_SETTER_DECODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count)
+#define JSONCONS_GETTER_SETTER_DECODE_(Prefix, Getter, Setter, Property, Count) \
+    case Count: aval.Setter(decode_traits_helper<char_type>::template decode<typename std::decay<decltype(aval.Getter())>::type>(cursor, decoder, ec)); break;
+
+#define JSONCONS_GETTER_SETTER_COUNT(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_GETTER_SETTER_COUNT_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
+#define JSONCONS_GETTER_SETTER_COUNT_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_GETTER_SETTER_COUNT_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
+#define JSONCONS_GETTER_SETTER_COUNT_(Prefix, Getter, Setter, Property, Count) \
+    if ((num_params-Count) < num_mandatory_params2) {++count;} \
+    else {count += encode_traits_helper<char_type>::member_count(aval.Getter());}
+
+#define JSONCONS_GETTER_SETTER_ENCODE(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_GETTER_SETTER_ENCODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
+#define JSONCONS_GETTER_SETTER_ENCODE_LAST(Prefix, GetPrefix, SetPrefix, Property, Count) JSONCONS_GETTER_SETTER_ENCODE_(Prefix, GetPrefix ## Property, SetPrefix ## Property, Property, Count) 
+#define JSONCONS_GETTER_SETTER_ENCODE_(Prefix, Getter, Setter, Property, Count) \
+    case Count: \
+        if ((num_params-Count) < num_mandatory_params2) {encode_traits_helper<char_type>::encode_member(names[num_params-Count], aval.Getter(), encoder, proto, ec);} \
+        else {encode_traits_helper<char_type>::encode_optional_member(names[num_params-Count], aval.Getter(), encoder, proto, ec);} \
+        break;
+
 #define JSONCONS_GETTER_SETTER_TRAITS_BASE(AsT,ToJ,NumTemplateParams, ValueType,GetPrefix,SetPrefix,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -867,6 +1747,45 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using json_traits_macro_decode = std::true_type; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            JSONCONS_DECODE_OBJECT_MEMBERS(JSONCONS_MEMBER_KEY_INDEX, JSONCONS_GETTER_SETTER_DECODE, GetPrefix, SetPrefix, __VA_ARGS__) \
+            if (!ec && valid) \
+            { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_MISSING, ,GetPrefix,SetPrefix, __VA_ARGS__) \
+            } \
+            if (!ec && !valid) \
+            { \
+                JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            if (!ec && failure) \
+            { \
+                std::rethrow_exception(failure); \
+            } \
+            return aval; \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_ENCODE_OBJECT_MEMBERS(JSONCONS_MEMBER_KEY, JSONCONS_GETTER_SETTER_COUNT, JSONCONS_GETTER_SETTER_ENCODE, GetPrefix, SetPrefix, __VA_ARGS__) \
+    }; \
 } \
   /**/
 
@@ -896,7 +1815,7 @@ namespace jsoncons \
 #define JSONCONS_GETTER_SETTER_NAME_IS_5(Getter, Setter, Name, Mode, Match) JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match,, )
 #define JSONCONS_GETTER_SETTER_NAME_IS_6(Getter, Setter, Name, Mode, Match, Into) JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match, Into, )
 #define JSONCONS_GETTER_SETTER_NAME_IS_7(Getter, Setter, Name, Mode, Match, Into, From) !ajson.contains(Name)) return false; \
-    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into(((value_type*)nullptr)->Getter()))>::type>())) return false;} \
+    JSONCONS_TRY{if (!Match(ajson.at(Name).template as<typename std::decay<decltype(Into(std::declval<value_type*>()->Getter()))>::type>())) return false;} \
     JSONCONS_CATCH(...) {return false;}
 
 #define JSONCONS_N_GETTER_SETTER_NAME_AS(P1, P2, P3, Seq, Count) JSONCONS_N_GETTER_SETTER_NAME_AS_LAST(P1, P2, P3, Seq, Count)
@@ -935,6 +1854,56 @@ else \
 else \
   {json_traits_helper<Json>::set_optional_json_member(Name, Into(aval.Getter()), ajson);}
  
+#define JSONCONS_GETTER_SETTER_NAME_KEY_INDEX(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_KEY_INDEX_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_GETTER_SETTER_NAME_KEY_INDEX_LAST(P1, P2, P3, Seq, Count) else if (key == JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_GETTER_SETTER_NAME_KEY_,JSONCONS_NARGS Seq) Seq)) {index = Count;}
+#define JSONCONS_GETTER_SETTER_NAME_KEY_3(Getter, Setter, Name) Name
+#define JSONCONS_GETTER_SETTER_NAME_KEY_4(Getter, Setter, Name, Mode) Name
+#define JSONCONS_GETTER_SETTER_NAME_KEY_5(Getter, Setter, Name, Mode, Match) Name
+#define JSONCONS_GETTER_SETTER_NAME_KEY_6(Getter, Setter, Name, Mode, Match, Into) Name
+#define JSONCONS_GETTER_SETTER_NAME_KEY_7(Getter, Setter, Name, Mode, Match, Into, From) Name
+
+#define JSONCONS_GETTER_SETTER_NAME_MISSING(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_MISSING_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_GETTER_SETTER_NAME_MISSING_LAST(P1, P2, P3, Seq, Count) \
+    if (((num_params-Count) < num_mandatory_params1 || JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_GETTER_SETTER_NAME_HAS_MATCH_,JSONCONS_NARGS Seq) Seq)) && !(found & JSONCONS_DECODE_MEMBER_BIT(Count))) {valid = false;}
+#define JSONCONS_GETTER_SETTER_NAME_HAS_MATCH_3(Getter, Setter, Name) false
+#define JSONCONS_GETTER_SETTER_NAME_HAS_MATCH_4(Getter, Setter, Name, Mode) false
+#define JSONCONS_GETTER_SETTER_NAME_HAS_MATCH_5(Getter, Setter, Name, Mode, Match) true
+#define JSONCONS_GETTER_SETTER_NAME_HAS_MATCH_6(Getter, Setter, Name, Mode, Match, Into) true
+#define JSONCONS_GETTER_SETTER_NAME_HAS_MATCH_7(Getter, Setter, Name, Mode, Match, Into, From) true
+
+#define JSONCONS_GETTER_SETTER_NAME_DECODE(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_GETTER_SETTER_NAME_DECODE_LAST(P1, P2, P3, Seq, Count) case Count: JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_GETTER_SETTER_NAME_DECODE_,JSONCONS_NARGS Seq) Seq) break;
+#define JSONCONS_GETTER_SETTER_NAME_DECODE_3(Getter, Setter, Name) \
+    aval.Setter(decode_traits_helper<char_type>::template decode<typename std::decay<decltype(aval.Getter())>::type>(cursor, decoder, ec));
+#define JSONCONS_GETTER_SETTER_NAME_DECODE_4(Getter, Setter, Name, Mode) \
+    if (false Mode(|| true)) {Mode(JSONCONS_GETTER_SETTER_NAME_DECODE_3(Getter, Setter, Name))} else {cursor.skip(ec);}
+#define JSONCONS_GETTER_SETTER_NAME_DECODE_5(Getter, Setter, Name, Mode, Match) JSONCONS_GETTER_SETTER_NAME_DECODE_7(Getter, Setter, Name, Mode, Match, , )
+#define JSONCONS_GETTER_SETTER_NAME_DECODE_6(Getter, Setter, Name, Mode, Match, Into) JSONCONS_GETTER_SETTER_NAME_DECODE_7(Getter, Setter, Name, Mode, Match, Into, )
+#define JSONCONS_GETTER_SETTER_NAME_DECODE_7(Getter, Setter, Name, Mode, Match, Into, From) \
+    { \
+        auto val = decode_traits_helper<char_type>::template decode_match<typename std::decay<decltype(Into(aval.Getter()))>::type>(cursor, decoder, Match, valid, ec); \
+        Mode(if (!ec && valid) {aval.Setter(From(std::move(*val)));}) \
+    }
+
+#define JSONCONS_GETTER_SETTER_NAME_ENCODE_KEY(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_ENCODE_KEY_LAST(P1, P2, P3, Seq, Count),
+#define JSONCONS_GETTER_SETTER_NAME_ENCODE_KEY_LAST(P1, P2, P3, Seq, Count) jsoncons::basic_string_view<char_type>(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_GETTER_SETTER_NAME_KEY_,JSONCONS_NARGS Seq) Seq))
+
+#define JSONCONS_GETTER_SETTER_NAME_VALUE_3(Getter, Setter, Name) aval.Getter()
+#define JSONCONS_GETTER_SETTER_NAME_VALUE_4(Getter, Setter, Name, Mode) aval.Getter()
+#define JSONCONS_GETTER_SETTER_NAME_VALUE_5(Getter, Setter, Name, Mode, Match) aval.Getter()
+#define JSONCONS_GETTER_SETTER_NAME_VALUE_6(Getter, Setter, Name, Mode, Match, Into) Into(aval.Getter())
+#define JSONCONS_GETTER_SETTER_NAME_VALUE_7(Getter, Setter, Name, Mode, Match, Into, From) Into(aval.Getter())
+
+// As with to_json, all members are written
+#define JSONCONS_GETTER_SETTER_NAME_COUNT(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_GETTER_SETTER_NAME_COUNT_LAST(P1, P2, P3, Seq, Count) ++count;
+
+#define JSONCONS_GETTER_SETTER_NAME_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_GETTER_SETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_GETTER_SETTER_NAME_ENCODE_LAST(P1, P2, P3, Seq, Count) \
+    case Count: \
+        encode_traits_helper<char_type>::encode_member(names[num_params-Count], JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_GETTER_SETTER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq), encoder, proto, ec); \
+        break;
+
 #define JSONCONS_GETTER_SETTER_NAME_TRAITS_BASE(AsT,ToJ, NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -968,6 +1937,45 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        using json_traits_macro_decode = std::true_type; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params1 = NumMandatoryParams1; \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<char_type>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            JSONCONS_DECODE_OBJECT_MEMBERS(JSONCONS_GETTER_SETTER_NAME_KEY_INDEX, JSONCONS_GETTER_SETTER_NAME_DECODE, , , __VA_ARGS__) \
+            if (!ec && valid) \
+            { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_GETTER_SETTER_NAME_MISSING, ,,, __VA_ARGS__) \
+            } \
+            if (!ec && !valid) \
+            { \
+                JSONCONS_THROW(conv_error(conv_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            if (!ec && failure) \
+            { \
+                std::rethrow_exception(failure); \
+            } \
+            return aval; \
+        } \
+    }; \
+    template <class ChT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),ChT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        using char_type = ChT; \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params2 = NumMandatoryParams2; \
+        JSONCONS_ENCODE_OBJECT_MEMBERS(JSONCONS_GETTER_SETTER_NAME_ENCODE_KEY, JSONCONS_GETTER_SETTER_NAME_COUNT, JSONCONS_GETTER_SETTER_NAME_ENCODE, , , __VA_ARGS__) \
+    }; \
 } \
   /**/
  
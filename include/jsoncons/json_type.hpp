@@ -110,7 +110,8 @@ namespace jsoncons {
         array_value = 0x09,
         empty_object_value = 0x0a,
         object_value = 0x0b,
-        json_const_pointer = 0x0c
+        json_const_pointer = 0x0c,
+        empty_array_value = 0x0d
     };
 
     template <class CharT>
@@ -126,6 +127,7 @@ namespace jsoncons {
         JSONCONS_CSTRING(CharT,long_string_value,'l','o','n','g',' ','s','t','r','i','n','g')
         JSONCONS_CSTRING(CharT,byte_string_value,'b','y','t','e',' ','s','t','r','i','n','g')
         JSONCONS_CSTRING(CharT,array_value,'a','r','r','a','y')
+        JSONCONS_CSTRING(CharT,empty_array_value,'e','m','p','t','y',' ','a','r','r','a','y')
         JSONCONS_CSTRING(CharT,empty_object_value,'e','m','p','t','y',' ','o','b','j','e','c','t')
         JSONCONS_CSTRING(CharT,object_value,'o','b','j','e','c','t')
         JSONCONS_CSTRING(CharT,json_const_pointer,'j','s','o','n',' ','c','o','n','s','t',' ','p','o','i','n','t','e','r')
@@ -182,6 +184,11 @@ namespace jsoncons {
                 os << array_value;
                 break;
             }
+            case storage_kind::empty_array_value:
+            {
+                os << empty_array_value;
+                break;
+            }
             case storage_kind::empty_object_value:
             {
                 os << empty_object_value;
@@ -8,6 +8,7 @@
 #define JSONCONS_JSON_VISITOR_HPP
 
 #include <string>
+#include <memory> // std::addressof
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/bigint.hpp>
 #include <jsoncons/ser_context.hpp>
@@ -1446,6 +1447,92 @@ namespace jsoncons {
         }
     };
 
+    // static_json_visitor
+
+    // Has the interface of basic_json_visitor that a parser uses, and calls the visit functions 
+    // of a visitor of a final class by qualified name, so that they are bound at compile time 
+    // rather than through the vtable. The visitor class must befriend static_json_visitor, as the
+    // encoders do.
+    template <class Visitor>
+    class static_json_visitor
+    {
+    public:
+        using char_type = typename Visitor::char_type;
+        using string_view_type = typename Visitor::string_view_type;
+    private:
+        Visitor* visitor_;
+    public:
+        explicit static_json_visitor(Visitor& visitor)
+            : visitor_(std::addressof(visitor))
+        {
+        }
+
+        void flush()
+        {
+            visitor_->Visitor::visit_flush();
+        }
+
+        bool begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_begin_object(tag, context, ec);
+        }
+
+        bool end_object(const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_end_object(context, ec);
+        }
+
+        bool begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_begin_array(tag, context, ec);
+        }
+
+        bool end_array(const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_end_array(context, ec);
+        }
+
+        bool key(const string_view_type& name, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_key(name, context, ec);
+        }
+
+        bool null_value(semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_null(tag, context, ec);
+        }
+
+        bool bool_value(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_bool(value, tag, context, ec);
+        }
+
+        bool string_value(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_string(value, tag, context, ec);
+        }
+
+        bool byte_string_value(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_byte_string(value, tag, context, ec);
+        }
+
+        bool uint64_value(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_uint64(value, tag, context, ec);
+        }
+
+        bool int64_value(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_int64(value, tag, context, ec);
+        }
+
+        bool double_value(double value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return visitor_->Visitor::visit_double(value, tag, context, ec);
+        }
+    };
+
     using json_visitor = basic_json_visitor<char>;
     using wjson_visitor = basic_json_visitor<wchar_t>;
 
@@ -0,0 +1,450 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_KEY_POOL_HPP
+#define JSONCONS_KEY_POOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcmp
+#include <iterator> // std::distance
+#include <memory> // std::allocator
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // A reference counted, immutable, null terminated string, the characters follow the header
+    template <class CharT>
+    struct interned_key_entry
+    {
+        std::atomic<std::size_t> ref_count;
+        std::size_t length;
+
+        interned_key_entry(std::size_t count, std::size_t len) noexcept
+            : ref_count(count), length(len)
+        {
+        }
+
+        CharT* data() noexcept
+        {
+            return reinterpret_cast<CharT*>(this + 1);
+        }
+
+        static interned_key_entry* create(const CharT* s, std::size_t length, std::size_t ref_count)
+        {
+            void* p = ::operator new(sizeof(interned_key_entry) + (length+1)*sizeof(CharT));
+            interned_key_entry* entry = ::new(p) interned_key_entry(ref_count, length);
+            if (length > 0)
+            {
+                std::memcpy(entry->data(), s, length*sizeof(CharT));
+            }
+            entry->data()[length] = 0;
+            return entry;
+        }
+
+        static void add_ref(interned_key_entry* entry) noexcept
+        {
+            entry->ref_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void release(interned_key_entry* entry) noexcept
+        {
+            if (entry->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                entry->~interned_key_entry();
+                ::operator delete(entry);
+            }
+        }
+    };
+
+    static_assert(sizeof(interned_key_entry<char>) % alignof(char32_t) == 0, "Characters must follow the header aligned");
+
+} // namespace detail
+
+    template <class CharT,class Traits>
+    class basic_key_pool;
+
+    // A key that refers to an immutable, reference counted string. Copies share the string,
+    // and keys obtained from the same basic_key_pool for the same text share one copy.
+    // Comparing keys that share a string takes the pointer-equality fast path.
+    // The Allocator parameter is accepted for compatibility with std::basic_string,
+    // the strings are allocated with operator new, as they may outlive a document.
+
+    template <class CharT,class Traits = std::char_traits<CharT>,class Allocator = std::allocator<CharT>>
+    class basic_interned_key
+    {
+        template <class C,class T> friend class basic_key_pool;
+        using entry_type = detail::interned_key_entry<CharT>;
+
+        entry_type* ptr_;
+
+        explicit basic_interned_key(entry_type* ptr) noexcept
+            : ptr_(ptr)
+        {
+        }
+    public:
+        using value_type = CharT;
+        using traits_type = Traits;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using const_iterator = const CharT*;
+        using iterator = const CharT*;
+        using string_view_type = jsoncons::basic_string_view<CharT,Traits>;
+
+        basic_interned_key() noexcept
+            : ptr_(nullptr)
+        {
+        }
+
+        explicit basic_interned_key(const Allocator&) noexcept
+            : ptr_(nullptr)
+        {
+        }
+
+        basic_interned_key(const CharT* s, std::size_t length, const Allocator& = Allocator())
+            : ptr_(length == 0 ? nullptr : entry_type::create(s, length, 1))
+        {
+        }
+
+        basic_interned_key(const CharT* s, const Allocator& alloc = Allocator())
+            : basic_interned_key(s, Traits::length(s), alloc)
+        {
+        }
+
+        basic_interned_key(const string_view_type& sv, const Allocator& alloc = Allocator())
+            : basic_interned_key(sv.data(), sv.length(), alloc)
+        {
+        }
+
+        template <class Alloc>
+        basic_interned_key(const std::basic_string<CharT,Traits,Alloc>& s, const Allocator& alloc = Allocator())
+            : basic_interned_key(s.data(), s.length(), alloc)
+        {
+        }
+
+        template <class InputIt,class=typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+        basic_interned_key(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+            : ptr_(nullptr)
+        {
+            std::basic_string<CharT,Traits> s(first, last);
+            basic_interned_key(s.data(), s.length(), alloc).swap(*this);
+        }
+
+        basic_interned_key(const basic_interned_key& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            if (ptr_ != nullptr)
+            {
+                entry_type::add_ref(ptr_);
+            }
+        }
+
+        basic_interned_key(const basic_interned_key& other, const Allocator&) noexcept
+            : basic_interned_key(other)
+        {
+        }
+
+        basic_interned_key(basic_interned_key&& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            other.ptr_ = nullptr;
+        }
+
+        ~basic_interned_key() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                entry_type::release(ptr_);
+            }
+        }
+
+        basic_interned_key& operator=(const basic_interned_key& other) noexcept
+        {
+            basic_interned_key(other).swap(*this);
+            return *this;
+        }
+
+        basic_interned_key& operator=(basic_interned_key&& other) noexcept
+        {
+            basic_interned_key(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        void swap(basic_interned_key& other) noexcept
+        {
+            std::swap(ptr_, other.ptr_);
+        }
+
+        allocator_type get_allocator() const
+        {
+            return allocator_type();
+        }
+
+        const CharT* data() const noexcept
+        {
+            return ptr_ == nullptr ? empty_string() : ptr_->data();
+        }
+
+        const CharT* c_str() const noexcept
+        {
+            return data();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return ptr_ == nullptr ? 0 : ptr_->length;
+        }
+
+        std::size_t length() const noexcept
+        {
+            return size();
+        }
+
+        bool empty() const noexcept
+        {
+            return ptr_ == nullptr;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + size();
+        }
+
+        const CharT& operator[](std::size_t i) const noexcept
+        {
+            return data()[i];
+        }
+
+        void shrink_to_fit() noexcept
+        {
+        }
+
+        operator string_view_type() const noexcept
+        {
+            return string_view_type(data(), size());
+        }
+
+        int compare(const string_view_type& s) const noexcept
+        {
+            if (data() == s.data() && size() == s.length())
+            {
+                return 0;
+            }
+            return string_view_type(data(), size()).compare(s);
+        }
+
+        int compare(const basic_interned_key& other) const noexcept
+        {
+            return ptr_ == other.ptr_ ? 0 : compare(string_view_type(other));
+        }
+
+        template <class Alloc>
+        int compare(const std::basic_string<CharT,Traits,Alloc>& s) const noexcept
+        {
+            return compare(string_view_type(s.data(), s.length()));
+        }
+
+        int compare(const CharT* s) const noexcept
+        {
+            return compare(string_view_type(s));
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.ptr_ == rhs.ptr_ || (lhs.size() == rhs.size() && lhs.compare(rhs) == 0);
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.size() == rhs.length() && lhs.compare(rhs) == 0;
+        }
+
+        friend bool operator==(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs == lhs;
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const CharT* rhs) noexcept
+        {
+            return lhs == string_view_type(rhs);
+        }
+
+        friend bool operator==(const CharT* lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs == string_view_type(lhs);
+        }
+
+        template <class Alloc>
+        friend bool operator==(const basic_interned_key& lhs, const std::basic_string<CharT,Traits,Alloc>& rhs) noexcept
+        {
+            return lhs == string_view_type(rhs.data(), rhs.length());
+        }
+
+        template <class Alloc>
+        friend bool operator==(const std::basic_string<CharT,Traits,Alloc>& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs == string_view_type(lhs.data(), lhs.length());
+        }
+
+        template <class T>
+        friend bool operator!=(const basic_interned_key& lhs, const T& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        template <class T,class=typename std::enable_if<!std::is_same<T,basic_interned_key>::value>::type>
+        friend bool operator!=(const T& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(rhs == lhs);
+        }
+
+        friend bool operator<(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+
+        friend bool operator<=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) <= 0;
+        }
+
+        friend bool operator>(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) > 0;
+        }
+
+        friend bool operator>=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) >= 0;
+        }
+
+        friend std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, const basic_interned_key& key)
+        {
+            os.write(key.data(), key.size());
+            return os;
+        }
+    private:
+        static const CharT* empty_string() noexcept
+        {
+            static const CharT s[1] = {0};
+            return s;
+        }
+    };
+
+    using interned_key = basic_interned_key<char>;
+    using winterned_key = basic_interned_key<wchar_t>;
+
+    template <class T>
+    struct is_interned_key : std::false_type
+    {};
+
+    template <class CharT,class Traits,class Allocator>
+    struct is_interned_key<basic_interned_key<CharT,Traits,Allocator>> : std::true_type
+    {};
+
+    // A thread safe dictionary of keys. The pool holds a reference to each of its strings,
+    // keys that outlive the pool keep their strings alive.
+
+    template <class CharT,class Traits = std::char_traits<CharT>>
+    class basic_key_pool
+    {
+        using entry_type = detail::interned_key_entry<CharT>;
+        using string_view_type = jsoncons::basic_string_view<CharT,Traits>;
+
+        struct string_view_hash
+        {
+            std::size_t operator()(const string_view_type& s) const noexcept
+            {
+                return hash_key(s);
+            }
+        };
+
+        mutable std::mutex mutex_;
+        // The keys are views of the entries' own characters
+        std::unordered_map<string_view_type,entry_type*,string_view_hash> entries_;
+
+        // Noncopyable and nonmoveable
+        basic_key_pool(const basic_key_pool&) = delete;
+        basic_key_pool& operator=(const basic_key_pool&) = delete;
+    public:
+        basic_key_pool() = default;
+
+        // FNV-1a
+        static std::size_t hash_key(const string_view_type& s) noexcept
+        {
+            uint64_t h = 14695981039346656037ULL;
+            for (auto c : s)
+            {
+                h ^= static_cast<uint64_t>(static_cast<typename std::make_unsigned<CharT>::type>(c));
+                h *= 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+        ~basic_key_pool() noexcept
+        {
+            for (auto& item : entries_)
+            {
+                entry_type::release(item.second);
+            }
+        }
+
+        template <class Allocator = std::allocator<CharT>>
+        basic_interned_key<CharT,Traits,Allocator> intern(const string_view_type& s)
+        {
+            using key_type = basic_interned_key<CharT,Traits,Allocator>;
+            if (s.length() == 0)
+            {
+                return key_type();
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = entries_.find(s);
+            if (it != entries_.end())
+            {
+                entry_type::add_ref(it->second);
+                return key_type(it->second);
+            }
+            entry_type* entry = entry_type::create(s.data(), s.length(), 2);
+            JSONCONS_TRY
+            {
+                entries_.emplace(string_view_type(entry->data(), entry->length), entry);
+            }
+            JSONCONS_CATCH(...)
+            {
+                entry->~entry_type();
+                ::operator delete(entry);
+                JSONCONS_RETHROW;
+            }
+            return key_type(entry);
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return entries_.size();
+        }
+    };
+
+    using key_pool = basic_key_pool<char>;
+    using wkey_pool = basic_key_pool<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,120 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MINIFY_JSON_HPP
+#define JSONCONS_MINIFY_JSON_HPP
+
+#include <string>
+#include <ostream> // std::basic_ostream
+#include <system_error>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/sink.hpp>
+#include <jsoncons/detail/more_type_traits.hpp>
+#include <jsoncons/detail/json_scanner.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    template <class CharT, class Sink>
+    void minify_json(const CharT* data, std::size_t length, Sink& sink,
+                     const basic_json_decode_options<CharT>& options)
+    {
+        std::error_code ec;
+        json_scanner<CharT> scanner(data, length, options, default_json_parsing());
+        scanner.scan(sink, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, scanner.line(), scanner.column()));
+        }
+    }
+
+    template <class CharT, class Sink>
+    void minify_json(const CharT* data, std::size_t length, Sink& sink, std::error_code& ec,
+                     std::size_t& line, std::size_t& column)
+    {
+        json_scanner<CharT> scanner(data, length, basic_json_decode_options<CharT>(), default_json_parsing());
+        scanner.scan(sink, ec);
+        line = scanner.line();
+        column = scanner.column();
+    }
+
+    template <class CharT, class Sink>
+    void minify_json(const CharT* data, std::size_t length, Sink& sink, std::error_code& ec)
+    {
+        std::size_t line, column;
+        minify_json(data, length, sink, ec, line, column);
+    }
+
+} // namespace detail
+
+    // to string
+
+    template <class Source, class Container>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value &&
+                            jsoncons::detail::is_back_insertable_char_container<Container>::value &&
+                            std::is_same<typename Source::value_type,typename Container::value_type>::value>::type
+    minify_json(const Source& s,
+                Container& out,
+                const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
+    {
+        jsoncons::string_sink<Container> sink(out);
+        jsoncons::detail::minify_json(s.data(), s.size(), sink, options);
+    }
+
+    template <class Source, class Container>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value &&
+                            jsoncons::detail::is_back_insertable_char_container<Container>::value &&
+                            std::is_same<typename Source::value_type,typename Container::value_type>::value>::type
+    minify_json(const Source& s, Container& out, std::error_code& ec)
+    {
+        jsoncons::string_sink<Container> sink(out);
+        jsoncons::detail::minify_json(s.data(), s.size(), sink, ec);
+    }
+
+    template <class Source, class Container>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value &&
+                            jsoncons::detail::is_back_insertable_char_container<Container>::value &&
+                            std::is_same<typename Source::value_type,typename Container::value_type>::value>::type
+    minify_json(const Source& s, Container& out, std::error_code& ec, std::size_t& line, std::size_t& column)
+    {
+        jsoncons::string_sink<Container> sink(out);
+        jsoncons::detail::minify_json(s.data(), s.size(), sink, ec, line, column);
+    }
+
+    // to stream
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    minify_json(const Source& s,
+                std::basic_ostream<typename Source::value_type>& os,
+                const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
+    {
+        jsoncons::stream_sink<typename Source::value_type> sink(os);
+        jsoncons::detail::minify_json(s.data(), s.size(), sink, options);
+    }
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    minify_json(const Source& s, std::basic_ostream<typename Source::value_type>& os, std::error_code& ec)
+    {
+        jsoncons::stream_sink<typename Source::value_type> sink(os);
+        jsoncons::detail::minify_json(s.data(), s.size(), sink, ec);
+    }
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    minify_json(const Source& s, std::basic_ostream<typename Source::value_type>& os, std::error_code& ec,
+                std::size_t& line, std::size_t& column)
+    {
+        jsoncons::stream_sink<typename Source::value_type> sink(os);
+        jsoncons::detail::minify_json(s.data(), s.size(), sink, ec, line, column);
+    }
+
+} // jsoncons
+
+#endif
@@ -0,0 +1,286 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MMAP_SOURCE_HPP
+#define JSONCONS_MMAP_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <string>
+#include <utility> // std::swap
+#include <system_error>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/source.hpp>
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace jsoncons {
+
+namespace detail {
+
+    // A read-only mapping of a whole file. An empty file has an empty mapping.
+
+    class mapped_file
+    {
+    public:
+        // Files at least this large are mapped with a sequential access hint
+        static constexpr std::size_t sequential_hint_threshold = 16*1024*1024;
+    private:
+        const uint8_t* data_;
+        std::size_t size_;
+        std::error_code ec_;
+
+        // Noncopyable
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+    public:
+        mapped_file() noexcept
+            : data_(nullptr), size_(0)
+        {
+        }
+
+        explicit mapped_file(const std::string& path)
+            : data_(nullptr), size_(0)
+        {
+            map(path);
+        }
+
+        mapped_file(mapped_file&& other) noexcept
+            : data_(nullptr), size_(0)
+        {
+            swap(other);
+        }
+
+        mapped_file& operator=(mapped_file&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        ~mapped_file() noexcept
+        {
+            unmap();
+        }
+
+        const uint8_t* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        // Set if the file could not be opened or mapped
+        std::error_code error() const
+        {
+            return ec_;
+        }
+
+        void swap(mapped_file& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(ec_, other.ec_);
+        }
+
+    private:
+#if defined(_WIN32)
+        void map(const std::string& path)
+        {
+            HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                return;
+            }
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(file, &size))
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                ::CloseHandle(file);
+                return;
+            }
+            if (size.QuadPart == 0)
+            {
+                ::CloseHandle(file);
+                return;
+            }
+            HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            ::CloseHandle(file);
+            if (mapping == nullptr)
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                return;
+            }
+            void* p = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(mapping); // the view keeps the mapping alive
+            if (p == nullptr)
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                return;
+            }
+            data_ = static_cast<const uint8_t*>(p);
+            size_ = static_cast<std::size_t>(size.QuadPart);
+        }
+
+        void unmap() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::UnmapViewOfFile(data_);
+                data_ = nullptr;
+                size_ = 0;
+            }
+        }
+#else
+        void map(const std::string& path)
+        {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+            {
+                ec_ = std::error_code(errno, std::system_category());
+                return;
+            }
+            struct stat st;
+            if (::fstat(fd, &st) == -1)
+            {
+                ec_ = std::error_code(errno, std::system_category());
+                ::close(fd);
+                return;
+            }
+            std::size_t size = static_cast<std::size_t>(st.st_size);
+            if (size == 0)
+            {
+                ::close(fd);
+                return;
+            }
+            void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd); // the mapping keeps the file open
+            if (p == MAP_FAILED)
+            {
+                ec_ = std::error_code(errno, std::system_category());
+                return;
+            }
+            if (size >= sequential_hint_threshold)
+            {
+                ::madvise(p, size, MADV_SEQUENTIAL);
+            }
+            data_ = static_cast<const uint8_t*>(p);
+            size_ = size;
+        }
+
+        void unmap() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(const_cast<uint8_t*>(data_), size_);
+                data_ = nullptr;
+                size_ = 0;
+            }
+        }
+#endif
+    };
+
+    // Holds the mapping, so that it is constructed before the source base that refers to it
+    struct mapped_file_holder
+    {
+        mapped_file file_;
+
+        mapped_file_holder() = default;
+
+        explicit mapped_file_holder(const std::string& path)
+            : file_(path)
+        {
+        }
+    };
+
+} // namespace detail
+
+    // A text source over a read-only mapping of a file. Readers and cursors
+    // hand the whole mapping to the parser as one buffer, without copying.
+
+    template <class CharT>
+    class basic_mmap_source : private detail::mapped_file_holder, public string_source<CharT>
+    {
+    public:
+        using value_type = CharT;
+    public:
+        basic_mmap_source() = default;
+
+        explicit basic_mmap_source(const std::string& path)
+            : detail::mapped_file_holder(path),
+              string_source<CharT>(reinterpret_cast<const CharT*>(file_.data()), file_.size()/sizeof(CharT))
+        {
+        }
+
+        basic_mmap_source(basic_mmap_source&&) = default;
+        basic_mmap_source& operator=(basic_mmap_source&&) = default;
+
+        bool is_error() const
+        {
+            return static_cast<bool>(file_.error());
+        }
+
+        // Set if the file could not be opened or mapped
+        std::error_code error() const
+        {
+            return file_.error();
+        }
+    };
+
+    // A binary source over a read-only mapping of a file
+
+    class mmap_binary_source : private detail::mapped_file_holder, public bytes_source
+    {
+    public:
+        using value_type = uint8_t;
+    public:
+        mmap_binary_source() = default;
+
+        explicit mmap_binary_source(const std::string& path)
+            : detail::mapped_file_holder(path),
+              bytes_source(jsoncons::detail::span<const uint8_t>(file_.data(), file_.size()))
+        {
+        }
+
+        mmap_binary_source(mmap_binary_source&&) = default;
+        mmap_binary_source& operator=(mmap_binary_source&&) = default;
+
+        bool is_error() const
+        {
+            return static_cast<bool>(file_.error());
+        }
+
+        // Set if the file could not be opened or mapped
+        std::error_code error() const
+        {
+            return file_.error();
+        }
+    };
+
+    using mmap_source = basic_mmap_source<char>;
+    using wmmap_source = basic_mmap_source<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
@@ -18,6 +18,7 @@
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/byte_string.hpp> // jsoncons::byte_traits
 #include <jsoncons/detail/more_type_traits.hpp>
+#include <jsoncons/detail/span.hpp>
 
 namespace jsoncons { 
 
@@ -345,6 +346,14 @@ namespace jsoncons {
             current_  += len;
             return len;
         }
+
+        // Returns the unread characters without copying them
+        jsoncons::detail::span<const value_type> read_buffer()
+        {
+            const value_type* p = current_;
+            current_ = end_;
+            return jsoncons::detail::span<const value_type>(p, end_ - p);
+        }
     };
 
     // iterator source
@@ -659,6 +668,14 @@ namespace jsoncons {
             current_  += len;
             return len;
         }
+
+        // Returns the unread bytes without copying them
+        jsoncons::detail::span<const value_type> read_buffer()
+        {
+            const value_type* p = current_;
+            current_ = end_;
+            return jsoncons::detail::span<const value_type>(p, end_ - p);
+        }
     };
 
     // binary_iterator source
@@ -737,12 +754,49 @@ namespace jsoncons {
         }
     };
 
+    namespace detail {
+
+        template<class Source>
+        using
+        source_read_buffer_t = decltype(std::declval<Source>().read_buffer());
+
+        // Sources that hold their content in memory provide read_buffer()
+        template<class Source>
+        using
+        has_read_buffer = is_detected<source_read_buffer_t, Source>;
+
+    } // namespace detail
+
     template <class Source>
     struct source_reader
     {
         using value_type = typename Source::value_type;
         static constexpr std::size_t max_buffer_length = 16384;
 
+        // Returns the next block of input, either the source's own content, without copying,
+        // or up to length characters read into buffer
+        template <class Buffer,class S=Source>
+        static
+        typename std::enable_if<jsoncons::detail::has_read_buffer<S>::value, 
+                                jsoncons::detail::span<const value_type>>::type
+        read_buffer(Source& source, Buffer&, std::size_t)
+        {
+            return source.read_buffer();
+        }
+
+        template <class Buffer,class S=Source>
+        static
+        typename std::enable_if<!jsoncons::detail::has_read_buffer<S>::value, 
+                                jsoncons::detail::span<const value_type>>::type
+        read_buffer(Source& source, Buffer& buffer, std::size_t length)
+        {
+            buffer.clear();
+            buffer.resize(length);
+            std::size_t count = source.read(buffer.data(), length);
+            buffer.resize(count);
+            return jsoncons::detail::span<const value_type>(buffer.data(), buffer.size());
+        }
+
         template <class Container>
         static
         typename std::enable_if<std::is_convertible<value_type,typename Container::value_type>::value &&
@@ -9,6 +9,7 @@
 
 #include <memory> // std::allocator
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <system_error>
 #include <ios>
@@ -442,6 +443,253 @@ private:
     }
 };
 
+// staj_compact_event
+
+// An event in a basic_staj_event_batch. A key, string or byte string is stored in the batch, 
+// and the event refers to it by offset and length.
+class staj_compact_event
+{
+    staj_event_type event_type_;
+    semantic_tag tag_;
+    std::size_t length_;
+    uint64_t ext_tag_;
+    union
+    {
+        bool bool_value_;
+        int64_t int64_value_;
+        uint64_t uint64_value_;
+        uint16_t half_value_;
+        double double_value_;
+        std::size_t offset_;
+    } value_;
+public:
+    staj_compact_event(staj_event_type event_type, semantic_tag tag = semantic_tag::none)
+        : event_type_(event_type), tag_(tag), length_(0), ext_tag_(0), value_()
+    {
+    }
+
+    staj_compact_event(bool value, semantic_tag tag)
+        : event_type_(staj_event_type::bool_value), tag_(tag), length_(0), ext_tag_(0)
+    {
+        value_.bool_value_ = value;
+    }
+
+    staj_compact_event(int64_t value, semantic_tag tag)
+        : event_type_(staj_event_type::int64_value), tag_(tag), length_(0), ext_tag_(0)
+    {
+        value_.int64_value_ = value;
+    }
+
+    staj_compact_event(uint64_t value, semantic_tag tag)
+        : event_type_(staj_event_type::uint64_value), tag_(tag), length_(0), ext_tag_(0)
+    {
+        value_.uint64_value_ = value;
+    }
+
+    staj_compact_event(half_arg_t, uint16_t value, semantic_tag tag)
+        : event_type_(staj_event_type::half_value), tag_(tag), length_(0), ext_tag_(0)
+    {
+        value_.half_value_ = value;
+    }
+
+    staj_compact_event(double value, semantic_tag tag)
+        : event_type_(staj_event_type::double_value), tag_(tag), length_(0), ext_tag_(0)
+    {
+        value_.double_value_ = value;
+    }
+
+    staj_compact_event(staj_event_type event_type, std::size_t offset, std::size_t length, 
+                       semantic_tag tag, uint64_t ext_tag = 0)
+        : event_type_(event_type), tag_(tag), length_(length), ext_tag_(ext_tag)
+    {
+        value_.offset_ = offset;
+    }
+
+    staj_event_type event_type() const noexcept { return event_type_; }
+
+    semantic_tag tag() const noexcept { return tag_; }
+
+    uint64_t ext_tag() const noexcept { return ext_tag_; }
+
+    // The position of a key, string or byte string in the batch
+    std::size_t offset() const noexcept { return value_.offset_; }
+
+    std::size_t length() const noexcept { return length_; }
+
+    bool bool_value() const noexcept { return value_.bool_value_; }
+
+    int64_t int64_value() const noexcept { return value_.int64_value_; }
+
+    uint64_t uint64_value() const noexcept { return value_.uint64_value_; }
+
+    uint16_t half_value() const noexcept { return value_.half_value_; }
+
+    double double_value() const noexcept { return value_.double_value_; }
+};
+
+// basic_staj_event_batch
+
+template <class CharT>
+class basic_staj_event_batch
+{
+public:
+    using char_type = CharT;
+    using string_view_type = jsoncons::basic_string_view<CharT>;
+    using value_type = staj_compact_event;
+    using const_iterator = typename std::vector<staj_compact_event>::const_iterator;
+    using iterator = const_iterator;
+private:
+    static constexpr std::size_t default_capacity = 1024;
+
+    std::size_t capacity_;
+    std::vector<staj_compact_event> events_;
+    std::basic_string<CharT> chars_;
+    std::vector<uint8_t> bytes_;
+public:
+    explicit basic_staj_event_batch(std::size_t capacity = default_capacity)
+        : capacity_(capacity)
+    {
+        events_.reserve(capacity_);
+    }
+
+    // The maximum number of events a cursor puts in the batch
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return events_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return events_.empty();
+    }
+
+    bool full() const noexcept
+    {
+        return events_.size() >= capacity_;
+    }
+
+    const staj_compact_event* data() const noexcept
+    {
+        return events_.data();
+    }
+
+    const staj_compact_event& operator[](std::size_t i) const
+    {
+        return events_[i];
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return events_.begin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return events_.end();
+    }
+
+    // The key or string of a key or string_value event
+    string_view_type string_value(const staj_compact_event& event) const
+    {
+        return string_view_type(chars_.data() + event.offset(), event.length());
+    }
+
+    // The bytes of a byte_string_value event
+    byte_string_view byte_string_value(const staj_compact_event& event) const
+    {
+        return byte_string_view(bytes_.data() + event.offset(), event.length());
+    }
+
+    // The i-th event as a basic_staj_event that refers to the strings in the batch
+    basic_staj_event<CharT> event(std::size_t i) const
+    {
+        const staj_compact_event& ev = events_[i];
+        switch (ev.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+                return basic_staj_event<CharT>(string_value(ev), ev.event_type(), ev.tag());
+            case staj_event_type::byte_string_value:
+                return ev.tag() == semantic_tag::ext 
+                    ? basic_staj_event<CharT>(byte_string_value(ev), ev.event_type(), ev.ext_tag())
+                    : basic_staj_event<CharT>(byte_string_value(ev), ev.event_type(), ev.tag());
+            case staj_event_type::bool_value:
+                return basic_staj_event<CharT>(ev.bool_value(), ev.tag());
+            case staj_event_type::int64_value:
+                return basic_staj_event<CharT>(ev.int64_value(), ev.tag());
+            case staj_event_type::uint64_value:
+                return basic_staj_event<CharT>(ev.uint64_value(), ev.tag());
+            case staj_event_type::half_value:
+                return basic_staj_event<CharT>(half_arg, ev.half_value(), ev.tag());
+            case staj_event_type::double_value:
+                return basic_staj_event<CharT>(ev.double_value(), ev.tag());
+            default:
+                return basic_staj_event<CharT>(ev.event_type(), ev.tag());
+        }
+    }
+
+    void clear()
+    {
+        events_.clear();
+        chars_.clear();
+        bytes_.clear();
+    }
+
+    void push_back(const staj_compact_event& event)
+    {
+        events_.push_back(event);
+    }
+
+    void push_back(staj_event_type event_type, const string_view_type& s, semantic_tag tag)
+    {
+        events_.emplace_back(event_type, chars_.size(), s.size(), tag);
+        chars_.append(s.data(), s.size());
+    }
+
+    void push_back(const byte_string_view& b, semantic_tag tag, uint64_t ext_tag = 0)
+    {
+        events_.emplace_back(staj_event_type::byte_string_value, bytes_.size(), b.size(), tag, ext_tag);
+        bytes_.insert(bytes_.end(), b.begin(), b.end());
+    }
+
+    void push_back(const basic_staj_event<CharT>& event)
+    {
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+                push_back(event.event_type(), event.template get<string_view_type>(), event.tag());
+                break;
+            case staj_event_type::byte_string_value:
+                push_back(event.template get<byte_string_view>(), event.tag(), event.ext_tag());
+                break;
+            case staj_event_type::bool_value:
+                events_.emplace_back(event.template get<bool>(), event.tag());
+                break;
+            case staj_event_type::int64_value:
+                events_.emplace_back(event.template get<int64_t>(), event.tag());
+                break;
+            case staj_event_type::uint64_value:
+                events_.emplace_back(event.template get<uint64_t>(), event.tag());
+                break;
+            case staj_event_type::half_value:
+                events_.emplace_back(half_arg, event.template get<uint16_t>(), event.tag());
+                break;
+            case staj_event_type::double_value:
+                events_.emplace_back(event.template get<double>(), event.tag());
+                break;
+            default:
+                events_.emplace_back(event.event_type(), event.tag());
+                break;
+        }
+    }
+};
+
 // basic_staj_visitor
 
 enum class staj_cursor_state
@@ -677,6 +925,7 @@ public:
     using typename super_type::string_view_type;
 private:
     std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred_;
+    bool filtered_;
     basic_staj_event<CharT> event_;
 
     staj_cursor_state state_;
@@ -685,13 +934,13 @@ private:
     std::size_t index_;
 public:
     basic_staj_visitor()
-        : pred_(accept), event_(staj_event_type::null_value),
+        : pred_(accept), filtered_(false), event_(staj_event_type::null_value),
           state_(), data_(), shape_(), index_(0)
     {
     }
 
     basic_staj_visitor(std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
-        : pred_(pred), event_(staj_event_type::null_value),
+        : pred_(pred), filtered_(true), event_(staj_event_type::null_value),
           state_(), data_(), shape_(), index_(0)
     {
     }
@@ -701,6 +950,12 @@ public:
         return event_;
     }
 
+    // true if constructed with a predicate
+    bool filtered() const
+    {
+        return filtered_;
+    }
+
     bool in_available() const
     {
         return state_ != staj_cursor_state();
@@ -1239,6 +1494,249 @@ private:
     }
 };
 
+// basic_staj_batch_visitor
+
+// Appends the events it receives to a basic_staj_event_batch, and stops the parser when the 
+// batch is full. Typed arrays and multi-dimensional arrays are passed on to another visitor,
+// a basic_staj_visitor that reports their elements one by one, and also stop the parser.
+template <class CharT>
+class basic_staj_batch_visitor : public basic_json_visitor<CharT>
+{
+    using super_type = basic_json_visitor<CharT>;
+public:
+    using char_type = CharT;
+    using typename super_type::string_view_type;
+private:
+    basic_staj_event_batch<CharT>* batch_;
+    basic_json_visitor<CharT>* other_;
+public:
+    basic_staj_batch_visitor(basic_staj_event_batch<CharT>& batch, basic_json_visitor<CharT>& other)
+        : batch_(std::addressof(batch)), other_(std::addressof(other))
+    {
+    }
+
+private:
+    bool visit_begin_object(semantic_tag tag, const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(staj_event_type::begin_object, tag));
+        return !batch_->full();
+    }
+
+    bool visit_end_object(const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(staj_event_type::end_object));
+        return !batch_->full();
+    }
+
+    bool visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(staj_event_type::begin_array, tag));
+        return !batch_->full();
+    }
+
+    bool visit_end_array(const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(staj_event_type::end_array));
+        return !batch_->full();
+    }
+
+    bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_event_type::key, name, semantic_tag::none);
+        return !batch_->full();
+    }
+
+    bool visit_null(semantic_tag tag, const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(staj_event_type::null_value, tag));
+        return !batch_->full();
+    }
+
+    bool visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(value, tag));
+        return !batch_->full();
+    }
+
+    bool visit_string(const string_view_type& s, semantic_tag tag, const ser_context&, std::error_code&) override
+    {
+        batch_->push_back(staj_event_type::string_value, s, tag);
+        return !batch_->full();
+    }
+
+    bool visit_byte_string(const byte_string_view& s, 
+                           semantic_tag tag,
+                           const ser_context&,
+                           std::error_code&) override
+    {
+        batch_->push_back(s, tag);
+        return !batch_->full();
+    }
+
+    bool visit_byte_string(const byte_string_view& s, 
+                           uint64_t ext_tag,
+                           const ser_context&,
+                           std::error_code&) override
+    {
+        batch_->push_back(s, semantic_tag::ext, ext_tag);
+        return !batch_->full();
+    }
+
+    bool visit_uint64(uint64_t value, 
+                      semantic_tag tag, 
+                      const ser_context&,
+                      std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(value, tag));
+        return !batch_->full();
+    }
+
+    bool visit_int64(int64_t value, 
+                     semantic_tag tag,
+                     const ser_context&,
+                     std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(value, tag));
+        return !batch_->full();
+    }
+
+    bool visit_half(uint16_t value, 
+                    semantic_tag tag,
+                    const ser_context&,
+                    std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(half_arg, value, tag));
+        return !batch_->full();
+    }
+
+    bool visit_double(double value, 
+                      semantic_tag tag, 
+                      const ser_context&,
+                      std::error_code&) override
+    {
+        batch_->push_back(staj_compact_event(value, tag));
+        return !batch_->full();
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint8_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint16_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint32_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint64_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int8_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int16_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int32_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int64_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(half_arg_t, const jsoncons::span<const uint16_t>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(half_arg, data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const float>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const double>& data, 
+                        semantic_tag tag,
+                        const ser_context& context,
+                        std::error_code& ec) override
+    {
+        other_->typed_array(data, tag, context, ec);
+        return false;
+    }
+
+    bool visit_begin_multi_dim(const jsoncons::span<const size_t>& shape,
+                            semantic_tag tag,
+                            const ser_context& context, 
+                            std::error_code& ec) override
+    {
+        other_->begin_multi_dim(shape, tag, context, ec);
+        return false;
+    }
+
+    bool visit_end_multi_dim(const ser_context& context,
+                          std::error_code& ec) override
+    {
+        return this->visit_end_array(context, ec);
+    }
+
+    void visit_flush() override
+    {
+    }
+};
+
 template<class CharT>
 bool staj_to_saj_event(const basic_staj_event<CharT>& ev,
                        basic_json_visitor<CharT>& visitor,
@@ -1308,6 +1806,77 @@ public:
     virtual void next(std::error_code& ec) = 0;
 
     virtual const ser_context& context() const = 0;
+
+    // If the current event is begin_object or begin_array, advances to the matching end event 
+    // without reporting the events in between, otherwise does nothing. Cursors that can, jump
+    // over the container without decoding its contents.
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    virtual void skip(std::error_code& ec)
+    {
+        staj_event_type event_type = current().event_type();
+        if (event_type != staj_event_type::begin_object && event_type != staj_event_type::begin_array)
+        {
+            return;
+        }
+        std::size_t depth = 1;
+        while (depth > 0 && !done())
+        {
+            next(ec);
+            if (ec)
+            {
+                return;
+            }
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_object:
+                case staj_event_type::begin_array:
+                    ++depth;
+                    break;
+                case staj_event_type::end_object:
+                case staj_event_type::end_array:
+                    --depth;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Puts the current event and the events that follow it in the batch, up to the batch's 
+    // capacity, and advances to the event after the last one. Cursors that can, have their 
+    // parser put the events in the batch directly.
+    virtual void read_batch(basic_staj_event_batch<CharT>& batch)
+    {
+        std::error_code ec;
+        read_batch(batch, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    virtual void read_batch(basic_staj_event_batch<CharT>& batch, std::error_code& ec)
+    {
+        batch.clear();
+        while (!done() && !batch.full())
+        {
+            batch.push_back(current());
+            next(ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
 };
 
 template<class CharT>
@@ -1365,6 +1934,35 @@ public:
         }
     }
 
+    void skip() override
+    {
+        cursor_->skip();
+        while (!done() && !pred_(current(),context()))
+        {
+            cursor_->next();
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        cursor_->skip(ec);
+        while (!done() && !pred_(current(),context()) && !ec)
+        {
+            cursor_->next(ec);
+        }
+    }
+
+    void read_batch(basic_staj_event_batch<CharT>& batch) override
+    {
+        basic_staj_cursor<CharT>::read_batch(batch);
+    }
+
+    // Event by event, through the predicate
+    void read_batch(basic_staj_event_batch<CharT>& batch, std::error_code& ec) override
+    {
+        basic_staj_cursor<CharT>::read_batch(batch, ec);
+    }
+
     const ser_context& context() const override
     {
         return cursor_->context();
@@ -1381,6 +1979,9 @@ public:
 using staj_event = basic_staj_event<char>;
 using wstaj_event = basic_staj_event<wchar_t>;
 
+using staj_event_batch = basic_staj_event_batch<char>;
+using wstaj_event_batch = basic_staj_event_batch<wchar_t>;
+
 using staj_cursor = basic_staj_cursor<char>;
 using wstaj_cursor = basic_staj_cursor<wchar_t>;
 
@@ -0,0 +1,1335 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_TAPE_JSON_HPP
+#define JSONCONS_TAPE_JSON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <istream>
+#include <limits> // std::numeric_limits
+#include <iterator> // std::forward_iterator_tag
+#include <memory> // std::allocator
+#include <mutex> // std::once_flag
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    enum class tape_kind : uint8_t
+    {
+        null_value,
+        bool_value,
+        int64_value,
+        uint64_value,
+        half_value,
+        double_value,
+        string_value,
+        byte_string_value,
+        key_value,
+        array_value,
+        object_value
+    };
+
+    // A node of a tape document. The header packs the kind in the low byte, the semantic tag
+    // in the next, and a length in the upper 48 bits: the length of a string, byte string or key,
+    // or the number of elements or members of a container. The value holds a scalar's bits,
+    // the offset of a string in the string buffer, or for a container, the distance
+    // in slots from the container to the slot that follows it. An object's members are
+    // laid out as a key slot followed by the slots of the value.
+    struct tape_slot
+    {
+        uint64_t header;
+        uint64_t value;
+
+        tape_slot(tape_kind kind, semantic_tag tag, uint64_t length, uint64_t val) noexcept
+            : header(static_cast<uint64_t>(kind) | (static_cast<uint64_t>(tag) << 8) | (length << 16)), value(val)
+        {
+        }
+
+        tape_kind kind() const noexcept
+        {
+            return static_cast<tape_kind>(header & 0xff);
+        }
+
+        semantic_tag tag() const noexcept
+        {
+            return static_cast<semantic_tag>((header >> 8) & 0xff);
+        }
+
+        std::size_t length() const noexcept
+        {
+            return static_cast<std::size_t>(header >> 16);
+        }
+
+        void set_length(uint64_t length) noexcept
+        {
+            header = (header & 0xffff) | (length << 16);
+        }
+
+        // The slot after this one and all of its descendants
+        const tape_slot* next() const noexcept
+        {
+            return (kind() == tape_kind::array_value || kind() == tape_kind::object_value) ? this + value : this + 1;
+        }
+    };
+
+    static_assert(sizeof(tape_slot) == 16, "A tape slot is 16 bytes");
+
+    template <class CharT>
+    struct tape_json_cache;
+
+} // namespace detail
+
+    template <class CharT>
+    class basic_tape_json_view;
+
+    template <class CharT,class Allocator = std::allocator<char>>
+    class basic_tape_json;
+
+    template <class CharT,class Allocator = std::allocator<char>>
+    class basic_tape_json_builder;
+
+    template <class CharT>
+    class basic_tape_json_member
+    {
+        friend class basic_tape_json_view<CharT>;
+    public:
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+    private:
+        string_view_type key_;
+        basic_tape_json_view<CharT> value_;
+
+        basic_tape_json_member(const detail::tape_slot* slot, const CharT* strings, const uint8_t* bytes,
+                               detail::tape_json_cache<CharT>* cache) noexcept
+            : key_(strings + slot->value, slot->length()), value_(slot + 1, strings, bytes, cache)
+        {
+        }
+    public:
+        basic_tape_json_member() = default;
+
+        string_view_type key() const noexcept
+        {
+            return key_;
+        }
+
+        const basic_tape_json_view<CharT>& value() const noexcept
+        {
+            return value_;
+        }
+    };
+
+    // A const reference to a value in a tape document. A view stays valid as long as the
+    // document it refers to exists and is not assigned to.
+    template <class CharT>
+    class basic_tape_json_view
+    {
+        template <class C,class A> friend class basic_tape_json;
+        friend class basic_tape_json_member<CharT>;
+    public:
+        using char_type = CharT;
+        using char_traits_type = std::char_traits<char_type>;
+        using string_view_type = jsoncons::basic_string_view<char_type,char_traits_type>;
+        using key_value_type = basic_tape_json_member<char_type>;
+
+        class array_iterator
+        {
+            friend class basic_tape_json_view;
+
+            basic_tape_json_view current_;
+
+            array_iterator(const detail::tape_slot* slot, const CharT* strings, const uint8_t* bytes,
+                           detail::tape_json_cache<CharT>* cache) noexcept
+                : current_(slot, strings, bytes, cache)
+            {
+            }
+
+            const detail::tape_slot* position() const noexcept
+            {
+                return current_.slot_;
+            }
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = basic_tape_json_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const basic_tape_json_view*;
+            using reference = const basic_tape_json_view&;
+
+            array_iterator() = default;
+
+            reference operator*() const noexcept
+            {
+                return current_;
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &current_;
+            }
+
+            array_iterator& operator++() noexcept
+            {
+                current_.slot_ = current_.slot_->next();
+                return *this;
+            }
+
+            array_iterator operator++(int) noexcept
+            {
+                array_iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            friend bool operator==(const array_iterator& lhs, const array_iterator& rhs) noexcept
+            {
+                return lhs.position() == rhs.position();
+            }
+
+            friend bool operator!=(const array_iterator& lhs, const array_iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+        };
+
+        class object_iterator
+        {
+            friend class basic_tape_json_view;
+
+            const detail::tape_slot* slot_;
+            const detail::tape_slot* last_;
+            const CharT* strings_;
+            const uint8_t* bytes_;
+            detail::tape_json_cache<CharT>* cache_;
+            key_value_type current_;
+
+            object_iterator(const detail::tape_slot* slot, const detail::tape_slot* last,
+                            const CharT* strings, const uint8_t* bytes, detail::tape_json_cache<CharT>* cache) noexcept
+                : slot_(slot), last_(last), strings_(strings), bytes_(bytes), cache_(cache)
+            {
+                if (slot_ != last_)
+                {
+                    current_ = key_value_type(slot_, strings_, bytes_, cache_);
+                }
+            }
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = key_value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const key_value_type*;
+            using reference = const key_value_type&;
+
+            object_iterator() noexcept
+                : slot_(nullptr), last_(nullptr), strings_(nullptr), bytes_(nullptr), cache_(nullptr)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return current_;
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &current_;
+            }
+
+            object_iterator& operator++() noexcept
+            {
+                // The member's value follows its key
+                slot_ = (slot_ + 1)->next();
+                if (slot_ != last_)
+                {
+                    current_ = key_value_type(slot_, strings_, bytes_, cache_);
+                }
+                return *this;
+            }
+
+            object_iterator operator++(int) noexcept
+            {
+                object_iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            friend bool operator==(const object_iterator& lhs, const object_iterator& rhs) noexcept
+            {
+                return lhs.slot_ == rhs.slot_;
+            }
+
+            friend bool operator!=(const object_iterator& lhs, const object_iterator& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+        };
+
+        using const_array_iterator = array_iterator;
+        using const_object_iterator = object_iterator;
+    private:
+        const detail::tape_slot* slot_;
+        const CharT* strings_;
+        const uint8_t* bytes_;
+        detail::tape_json_cache<CharT>* cache_;
+
+        basic_tape_json_view(const detail::tape_slot* slot, const CharT* strings, const uint8_t* bytes,
+                             detail::tape_json_cache<CharT>* cache) noexcept
+            : slot_(slot), strings_(strings), bytes_(bytes), cache_(cache)
+        {
+        }
+
+        detail::tape_kind kind() const noexcept
+        {
+            return slot_->kind();
+        }
+    public:
+        basic_tape_json_view() noexcept
+            : slot_(nullptr), strings_(nullptr), bytes_(nullptr), cache_(nullptr)
+        {
+        }
+
+        json_type type() const noexcept
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::null_value:
+                    return json_type::null_value;
+                case detail::tape_kind::bool_value:
+                    return json_type::bool_value;
+                case detail::tape_kind::int64_value:
+                    return json_type::int64_value;
+                case detail::tape_kind::uint64_value:
+                    return json_type::uint64_value;
+                case detail::tape_kind::half_value:
+                    return json_type::half_value;
+                case detail::tape_kind::double_value:
+                    return json_type::double_value;
+                case detail::tape_kind::byte_string_value:
+                    return json_type::byte_string_value;
+                case detail::tape_kind::array_value:
+                    return json_type::array_value;
+                case detail::tape_kind::object_value:
+                    return json_type::object_value;
+                default:
+                    return json_type::string_value;
+            }
+        }
+
+        semantic_tag tag() const noexcept
+        {
+            return slot_->tag();
+        }
+
+        bool is_null() const noexcept
+        {
+            return kind() == detail::tape_kind::null_value;
+        }
+
+        bool is_bool() const noexcept
+        {
+            return kind() == detail::tape_kind::bool_value;
+        }
+
+        bool is_int64() const noexcept
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::int64_value:
+                    return true;
+                case detail::tape_kind::uint64_value:
+                    return slot_->value <= static_cast<uint64_t>((std::numeric_limits<int64_t>::max)());
+                default:
+                    return false;
+            }
+        }
+
+        bool is_uint64() const noexcept
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::uint64_value:
+                    return true;
+                case detail::tape_kind::int64_value:
+                    return static_cast<int64_t>(slot_->value) >= 0;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_half() const noexcept
+        {
+            return kind() == detail::tape_kind::half_value;
+        }
+
+        bool is_double() const noexcept
+        {
+            return kind() == detail::tape_kind::double_value;
+        }
+
+        bool is_number() const noexcept
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::int64_value:
+                case detail::tape_kind::uint64_value:
+                case detail::tape_kind::half_value:
+                case detail::tape_kind::double_value:
+                    return true;
+                case detail::tape_kind::string_value:
+                    return tag() == semantic_tag::bigint || tag() == semantic_tag::bigdec || tag() == semantic_tag::bigfloat;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_string() const noexcept
+        {
+            return kind() == detail::tape_kind::string_value;
+        }
+
+        bool is_byte_string() const noexcept
+        {
+            return kind() == detail::tape_kind::byte_string_value;
+        }
+
+        bool is_array() const noexcept
+        {
+            return kind() == detail::tape_kind::array_value;
+        }
+
+        bool is_object() const noexcept
+        {
+            return kind() == detail::tape_kind::object_value;
+        }
+
+        std::size_t size() const noexcept
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::array_value:
+                case detail::tape_kind::object_value:
+                    return slot_->length();
+                default:
+                    return 0;
+            }
+        }
+
+        bool empty() const noexcept
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::string_value:
+                case detail::tape_kind::byte_string_value:
+                case detail::tape_kind::array_value:
+                case detail::tape_kind::object_value:
+                    return slot_->length() == 0;
+                default:
+                    return false;
+            }
+        }
+
+        bool as_bool() const
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::bool_value:
+                    return slot_->value != 0;
+                case detail::tape_kind::int64_value:
+                case detail::tape_kind::uint64_value:
+                    return slot_->value != 0;
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+            }
+        }
+
+        template <class IntegerType>
+        IntegerType as_integer() const
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::string_value:
+                {
+                    auto result = jsoncons::detail::to_integer<IntegerType>(strings_ + slot_->value, slot_->length());
+                    if (!result)
+                    {
+                        JSONCONS_THROW(json_runtime_error<std::runtime_error>(result.error_code().message()));
+                    }
+                    return result.value();
+                }
+                case detail::tape_kind::half_value:
+                    return static_cast<IntegerType>(slot_->value);
+                case detail::tape_kind::double_value:
+                    return static_cast<IntegerType>(double_value());
+                case detail::tape_kind::int64_value:
+                    return static_cast<IntegerType>(static_cast<int64_t>(slot_->value));
+                case detail::tape_kind::uint64_value:
+                    return static_cast<IntegerType>(slot_->value);
+                case detail::tape_kind::bool_value:
+                    return static_cast<IntegerType>(slot_->value != 0 ? 1 : 0);
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an integer"));
+            }
+        }
+
+        double as_double() const
+        {
+            switch (kind())
+            {
+                case detail::tape_kind::string_value:
+                {
+                    jsoncons::detail::to_double_t to_double;
+                    // to_double() throws std::invalid_argument if conversion fails
+                    return to_double(as_cstring(), slot_->length());
+                }
+                case detail::tape_kind::half_value:
+                    return jsoncons::detail::decode_half(static_cast<uint16_t>(slot_->value));
+                case detail::tape_kind::double_value:
+                    return double_value();
+                case detail::tape_kind::int64_value:
+                    return static_cast<double>(static_cast<int64_t>(slot_->value));
+                case detail::tape_kind::uint64_value:
+                    return static_cast<double>(slot_->value);
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Not a double"));
+            }
+        }
+
+        string_view_type as_string_view() const
+        {
+            if (kind() != detail::tape_kind::string_value)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+            }
+            return string_view_type(strings_ + slot_->value, slot_->length());
+        }
+
+        const char_type* as_cstring() const
+        {
+            if (kind() != detail::tape_kind::string_value)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a cstring"));
+            }
+            return strings_ + slot_->value;
+        }
+
+        byte_string_view as_byte_string_view() const
+        {
+            if (kind() != detail::tape_kind::byte_string_value)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a byte string"));
+            }
+            return byte_string_view(bytes_ + slot_->value, slot_->length());
+        }
+
+        uint64_t ext_tag() const noexcept
+        {
+            if (kind() != detail::tape_kind::byte_string_value || tag() != semantic_tag::ext)
+            {
+                return 0;
+            }
+            uint64_t value;
+            std::memcpy(&value, bytes_ + slot_->value - sizeof(uint64_t), sizeof(uint64_t));
+            return value;
+        }
+
+        template <class SAllocator=std::allocator<char_type>>
+        std::basic_string<char_type,char_traits_type,SAllocator> as_string(const SAllocator& alloc = SAllocator()) const
+        {
+            using string_type = std::basic_string<char_type,char_traits_type,SAllocator>;
+
+            switch (kind())
+            {
+                case detail::tape_kind::string_value:
+                    return string_type(strings_ + slot_->value, slot_->length(), alloc);
+                case detail::tape_kind::byte_string_value:
+                {
+                    converter<string_type> convert;
+                    std::error_code ec;
+                    auto s = convert.from(as_byte_string_view(), tag(), alloc, ec);
+                    if (ec)
+                    {
+                        JSONCONS_THROW(ser_error(ec));
+                    }
+                    return s;
+                }
+                default:
+                {
+                    string_type s(alloc);
+                    basic_compact_json_encoder<char_type,jsoncons::string_sink<string_type>> encoder(s);
+                    dump(encoder);
+                    return s;
+                }
+            }
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,bool>::value,T>::type
+        as() const
+        {
+            return as_bool();
+        }
+
+        template <class T>
+        typename std::enable_if<jsoncons::detail::is_integer<T>::value && !std::is_same<T,bool>::value,T>::type
+        as() const
+        {
+            return as_integer<T>();
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_floating_point<T>::value,T>::type
+        as() const
+        {
+            return static_cast<T>(as_double());
+        }
+
+        template <class T>
+        typename std::enable_if<jsoncons::detail::is_basic_string<T>::value && std::is_same<typename T::value_type,char_type>::value,T>::type
+        as() const
+        {
+            return as_string<typename T::allocator_type>();
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,string_view_type>::value,T>::type
+        as() const
+        {
+            return as_string_view();
+        }
+
+        // Copies the value into a basic_json
+        template <class T>
+        typename std::enable_if<is_basic_json<T>::value && std::is_same<typename T::char_type,char_type>::value,T>::type
+        as() const
+        {
+            json_decoder<T> decoder;
+            dump(decoder);
+            return decoder.get_result();
+        }
+
+        // The value's node in an order preserving basic_json copy of its whole document. The copy
+        // is made by the first call for any value of the document and is kept with the document,
+        // so later calls only walk down to the node. Returns a null pointer for a default
+        // constructed view, and for a value inside an object with duplicate member names,
+        // of which the copy keeps only one.
+        const basic_json<char_type,preserve_order_policy>* cached_json() const
+        {
+            if (cache_ == nullptr)
+            {
+                return nullptr;
+            }
+            const basic_json<char_type,preserve_order_policy>* node = &cache_->get();
+            const detail::tape_slot* p = cache_->root.slot_;
+            while (p != slot_)
+            {
+                // slot_ is inside the container at p, find the element or member that holds it
+                if (p->kind() == detail::tape_kind::array_value)
+                {
+                    std::size_t index = 0;
+                    const detail::tape_slot* element = p + 1;
+                    while (element->next() <= slot_)
+                    {
+                        element = element->next();
+                        ++index;
+                    }
+                    node = &node->at(index);
+                    p = element;
+                }
+                else
+                {
+                    if (node->size() != p->length())
+                    {
+                        return nullptr;
+                    }
+                    const detail::tape_slot* key = p + 1;
+                    while ((key + 1)->next() <= slot_)
+                    {
+                        key = (key + 1)->next();
+                    }
+                    node = &node->at(string_view_type(strings_ + key->value, key->length()));
+                    p = key + 1;
+                }
+            }
+            return node;
+        }
+
+        range<array_iterator,array_iterator> array_range() const
+        {
+            if (kind() != detail::tape_kind::array_value)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            return range<array_iterator,array_iterator>(array_iterator(slot_ + 1, strings_, bytes_, cache_),
+                                                        array_iterator(slot_->next(), strings_, bytes_, cache_));
+        }
+
+        range<object_iterator,object_iterator> object_range() const
+        {
+            if (kind() != detail::tape_kind::object_value)
+            {
+                JSONCONS_THROW(not_an_object("",0));
+            }
+            const detail::tape_slot* last = slot_->next();
+            return range<object_iterator,object_iterator>(object_iterator(slot_ + 1, last, strings_, bytes_, cache_),
+                                                          object_iterator(last, last, strings_, bytes_, cache_));
+        }
+
+        // Linear in i, use array_range to visit all elements
+        basic_tape_json_view at(std::size_t i) const
+        {
+            if (kind() != detail::tape_kind::array_value)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+            }
+            if (i >= slot_->length())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            const detail::tape_slot* p = slot_ + 1;
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                p = p->next();
+            }
+            return basic_tape_json_view(p, strings_, bytes_, cache_);
+        }
+
+        basic_tape_json_view operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        // Linear in the number of members
+        object_iterator find(const string_view_type& name) const noexcept
+        {
+            if (kind() != detail::tape_kind::object_value)
+            {
+                return object_iterator();
+            }
+            const detail::tape_slot* last = slot_->next();
+            const detail::tape_slot* p = slot_ + 1;
+            while (p != last)
+            {
+                if (p->length() == name.length() &&
+                    char_traits_type::compare(strings_ + p->value, name.data(), name.length()) == 0)
+                {
+                    break;
+                }
+                p = (p + 1)->next();
+            }
+            return object_iterator(p, last, strings_, bytes_, cache_);
+        }
+
+        bool contains(const string_view_type& name) const noexcept
+        {
+            return is_object() && find(name) != object_range().end();
+        }
+
+        basic_tape_json_view at(const string_view_type& name) const
+        {
+            if (kind() != detail::tape_kind::object_value)
+            {
+                JSONCONS_THROW(not_an_object(name.data(),name.length()));
+            }
+            auto it = find(name);
+            if (it == object_range().end())
+            {
+                JSONCONS_THROW(key_not_found(name.data(),name.length()));
+            }
+            return it->value();
+        }
+
+        basic_tape_json_view operator[](const string_view_type& name) const
+        {
+            return at(name);
+        }
+
+        template <class Container>
+        typename std::enable_if<jsoncons::detail::is_back_insertable_char_container<Container>::value>::type
+        dump(Container& s,
+             const basic_json_encode_options<char_type>& options = basic_json_encode_options<char_type>()) const
+        {
+            basic_compact_json_encoder<char_type,jsoncons::string_sink<Container>> encoder(s, options);
+            dump(encoder);
+        }
+
+        template <class Container>
+        typename std::enable_if<jsoncons::detail::is_back_insertable_char_container<Container>::value>::type
+        dump_pretty(Container& s,
+                    const basic_json_encode_options<char_type>& options = basic_json_encode_options<char_type>()) const
+        {
+            basic_json_encoder<char_type,jsoncons::string_sink<Container>> encoder(s, options);
+            dump(encoder);
+        }
+
+        void dump(std::basic_ostream<char_type>& os,
+                  const basic_json_encode_options<char_type>& options = basic_json_encode_options<char_type>()) const
+        {
+            basic_compact_json_encoder<char_type> encoder(os, options);
+            dump(encoder);
+        }
+
+        void dump_pretty(std::basic_ostream<char_type>& os,
+                         const basic_json_encode_options<char_type>& options = basic_json_encode_options<char_type>()) const
+        {
+            basic_json_encoder<char_type> encoder(os, options);
+            dump(encoder);
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            dump(visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            if (dump_noflush(visitor, ec))
+            {
+                visitor.flush();
+            }
+        }
+
+        std::basic_string<char_type> to_string() const
+        {
+            std::basic_string<char_type> s;
+            dump(s);
+            return s;
+        }
+
+        friend std::basic_ostream<char_type>& operator<<(std::basic_ostream<char_type>& os, const basic_tape_json_view& v)
+        {
+            v.dump(os);
+            return os;
+        }
+    private:
+        double double_value() const noexcept
+        {
+            double d;
+            std::memcpy(&d, &slot_->value, sizeof(double));
+            return d;
+        }
+
+        // Emits the events of the value's slots in order, the tape is already in document order
+        bool dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            const ser_context context{};
+            const detail::tape_slot* last = slot_->next();
+            std::vector<const detail::tape_slot*> open_containers;
+            bool more = true;
+
+            const detail::tape_slot* p = slot_;
+            while (more && !ec)
+            {
+                while (!open_containers.empty() && p == open_containers.back()->next() && more && !ec)
+                {
+                    more = open_containers.back()->kind() == detail::tape_kind::object_value
+                        ? visitor.end_object(context, ec) : visitor.end_array(context, ec);
+                    open_containers.pop_back();
+                }
+                if (p == last || !more || ec)
+                {
+                    break;
+                }
+                switch (p->kind())
+                {
+                    case detail::tape_kind::null_value:
+                        more = visitor.null_value(p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::bool_value:
+                        more = visitor.bool_value(p->value != 0, p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::int64_value:
+                        more = visitor.int64_value(static_cast<int64_t>(p->value), p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::uint64_value:
+                        more = visitor.uint64_value(p->value, p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::half_value:
+                        more = visitor.half_value(static_cast<uint16_t>(p->value), p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::double_value:
+                        more = visitor.double_value(basic_tape_json_view(p, strings_, bytes_, cache_).double_value(), p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::string_value:
+                        more = visitor.string_value(string_view_type(strings_ + p->value, p->length()), p->tag(), context, ec);
+                        break;
+                    case detail::tape_kind::byte_string_value:
+                    {
+                        basic_tape_json_view v(p, strings_, bytes_, cache_);
+                        if (p->tag() == semantic_tag::ext)
+                        {
+                            more = visitor.byte_string_value(v.as_byte_string_view(), v.ext_tag(), context, ec);
+                        }
+                        else
+                        {
+                            more = visitor.byte_string_value(v.as_byte_string_view(), p->tag(), context, ec);
+                        }
+                        break;
+                    }
+                    case detail::tape_kind::key_value:
+                        more = visitor.key(string_view_type(strings_ + p->value, p->length()), context, ec);
+                        break;
+                    case detail::tape_kind::array_value:
+                        more = visitor.begin_array(p->length(), p->tag(), context, ec);
+                        open_containers.push_back(p);
+                        break;
+                    case detail::tape_kind::object_value:
+                        more = visitor.begin_object(p->length(), p->tag(), context, ec);
+                        open_containers.push_back(p);
+                        break;
+                }
+                ++p;
+            }
+            return more && !ec;
+        }
+    };
+
+namespace detail {
+
+    // The basic_json copy of a tape document that basic_tape_json_view::cached_json returns,
+    // made once, on first use
+    template <class CharT>
+    struct tape_json_cache
+    {
+        basic_tape_json_view<CharT> root;
+        std::once_flag once;
+        basic_json<CharT,preserve_order_policy> value;
+
+        const basic_json<CharT,preserve_order_policy>& get()
+        {
+            std::call_once(once, [this](){value = root.template as<basic_json<CharT,preserve_order_policy>>();});
+            return value;
+        }
+    };
+
+} // namespace detail
+
+    // A read-only document whose values are stored in one array of fixed size slots,
+    // and whose strings are stored in one buffer. See basic_tape_json_view for the API.
+    template <class CharT,class Allocator>
+    class basic_tape_json : public basic_tape_json_view<CharT>
+    {
+        template <class C,class A> friend class basic_tape_json_builder;
+    public:
+        using char_type = CharT;
+        using allocator_type = Allocator;
+        using view_type = basic_tape_json_view<CharT>;
+        using string_view_type = typename view_type::string_view_type;
+    private:
+        using slot_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<detail::tape_slot>;
+        using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type>;
+        using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;
+
+        std::vector<detail::tape_slot,slot_allocator_type> slot_buffer_;
+        std::vector<char_type,char_allocator_type> string_buffer_;
+        std::vector<uint8_t,byte_allocator_type> byte_buffer_;
+        std::unique_ptr<detail::tape_json_cache<char_type>> json_cache_;
+
+        basic_tape_json(std::vector<detail::tape_slot,slot_allocator_type>&& slots,
+                        std::vector<char_type,char_allocator_type>&& strings,
+                        std::vector<uint8_t,byte_allocator_type>&& bytes)
+            : slot_buffer_(std::move(slots)), string_buffer_(std::move(strings)), byte_buffer_(std::move(bytes)),
+              json_cache_(new detail::tape_json_cache<char_type>())
+        {
+            update_view();
+        }
+
+        void update_view() noexcept
+        {
+            this->slot_ = slot_buffer_.data();
+            this->strings_ = string_buffer_.data();
+            this->bytes_ = byte_buffer_.data();
+            this->cache_ = json_cache_.get();
+            if (json_cache_)
+            {
+                json_cache_->root = *this;
+            }
+        }
+    public:
+        // A null document
+        explicit basic_tape_json(const Allocator& alloc = Allocator())
+            : slot_buffer_(alloc), string_buffer_(alloc), byte_buffer_(alloc),
+              json_cache_(new detail::tape_json_cache<char_type>())
+        {
+            slot_buffer_.emplace_back(detail::tape_kind::null_value, semantic_tag::none, 0, 0);
+            update_view();
+        }
+
+        basic_tape_json(const basic_tape_json& other)
+            : view_type(), slot_buffer_(other.slot_buffer_), string_buffer_(other.string_buffer_), byte_buffer_(other.byte_buffer_),
+              json_cache_(new detail::tape_json_cache<char_type>())
+        {
+            update_view();
+        }
+
+        basic_tape_json(basic_tape_json&& other) noexcept
+            : view_type(), slot_buffer_(std::move(other.slot_buffer_)), string_buffer_(std::move(other.string_buffer_)), byte_buffer_(std::move(other.byte_buffer_)),
+              json_cache_(std::move(other.json_cache_))
+        {
+            update_view();
+        }
+
+        basic_tape_json& operator=(const basic_tape_json& other)
+        {
+            if (this != &other)
+            {
+                slot_buffer_ = other.slot_buffer_;
+                string_buffer_ = other.string_buffer_;
+                byte_buffer_ = other.byte_buffer_;
+                json_cache_.reset(new detail::tape_json_cache<char_type>());
+                update_view();
+            }
+            return *this;
+        }
+
+        basic_tape_json& operator=(basic_tape_json&& other) noexcept
+        {
+            if (this != &other)
+            {
+                slot_buffer_ = std::move(other.slot_buffer_);
+                string_buffer_ = std::move(other.string_buffer_);
+                byte_buffer_ = std::move(other.byte_buffer_);
+                json_cache_ = std::move(other.json_cache_);
+                update_view();
+            }
+            return *this;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return slot_buffer_.get_allocator();
+        }
+
+        view_type root() const noexcept
+        {
+            return *this;
+        }
+
+        // Number of slots, one per value and one per object member name
+        std::size_t slot_count() const noexcept
+        {
+            return slot_buffer_.size();
+        }
+
+        template <class Source>
+        static
+        typename std::enable_if<jsoncons::detail::is_sequence_of<Source,char_type>::value,basic_tape_json>::type
+        parse(const Source& s,
+              const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+              std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
+              const Allocator& alloc = Allocator())
+        {
+            basic_tape_json_builder<char_type,Allocator> builder(alloc);
+            basic_json_parser<char_type> parser(options,err_handler);
+
+            auto result = unicons::skip_bom(s.begin(), s.end());
+            if (result.ec != unicons::encoding_errc())
+            {
+                JSONCONS_THROW(ser_error(result.ec));
+            }
+            std::size_t offset = result.it - s.begin();
+            // Every value takes at least one character of input, and the text of its strings
+            // is never longer than the input
+            builder.reserve(s.size()/8 + 1, s.size() - offset);
+            parser.update(s.data()+offset,s.size()-offset);
+            parser.parse_some(builder);
+            parser.finish_parse(builder);
+            parser.check_done();
+            if (!builder.is_valid())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json string"));
+            }
+            return builder.get_result();
+        }
+
+        static basic_tape_json parse(const char_type* s,
+                                     const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                     std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
+                                     const Allocator& alloc = Allocator())
+        {
+            return parse(jsoncons::basic_string_view<char_type>(s), options, err_handler, alloc);
+        }
+
+        static basic_tape_json parse(std::basic_istream<char_type>& is,
+                                     const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                     std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
+                                     const Allocator& alloc = Allocator())
+        {
+            basic_tape_json_builder<char_type,Allocator> builder(alloc);
+            basic_json_reader<char_type,stream_source<char_type>> reader(is, builder, options, err_handler);
+            reader.read_next();
+            reader.check_done();
+            if (!builder.is_valid())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json stream"));
+            }
+            return builder.get_result();
+        }
+    };
+
+    // Builds a tape document from the events of a parser or another source, in one pass
+    template <class CharT,class Allocator>
+    class basic_tape_json_builder final : public basic_json_visitor<CharT>
+    {
+    public:
+        using char_type = CharT;
+        using allocator_type = Allocator;
+        using typename basic_json_visitor<CharT>::string_view_type;
+        using result_type = basic_tape_json<CharT,Allocator>;
+    private:
+        using slot_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<detail::tape_slot>;
+        using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type>;
+        using byte_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint8_t>;
+
+        struct container_info
+        {
+            std::size_t index;
+            std::size_t count;
+        };
+
+        allocator_type alloc_;
+        std::vector<detail::tape_slot,slot_allocator_type> slots_;
+        std::vector<char_type,char_allocator_type> strings_;
+        std::vector<uint8_t,byte_allocator_type> bytes_;
+        std::vector<container_info> stack_;
+        bool is_valid_;
+
+        // Noncopyable
+        basic_tape_json_builder(const basic_tape_json_builder&) = delete;
+        basic_tape_json_builder& operator=(const basic_tape_json_builder&) = delete;
+    public:
+        explicit basic_tape_json_builder(const Allocator& alloc = Allocator())
+            : alloc_(alloc), slots_(alloc), strings_(alloc), bytes_(alloc), is_valid_(false)
+        {
+            stack_.reserve(64);
+        }
+
+        void reserve(std::size_t slot_count, std::size_t char_count)
+        {
+            slots_.reserve(slot_count);
+            strings_.reserve(char_count);
+        }
+
+        void reset()
+        {
+            slots_.clear();
+            strings_.clear();
+            bytes_.clear();
+            stack_.clear();
+            is_valid_ = false;
+        }
+
+        bool is_valid() const noexcept
+        {
+            return is_valid_;
+        }
+
+        result_type get_result()
+        {
+            JSONCONS_ASSERT(is_valid_);
+            is_valid_ = false;
+            result_type result(std::move(slots_), std::move(strings_), std::move(bytes_));
+            slots_ = std::vector<detail::tape_slot,slot_allocator_type>(alloc_);
+            strings_ = std::vector<char_type,char_allocator_type>(alloc_);
+            bytes_ = std::vector<uint8_t,byte_allocator_type>(alloc_);
+            return result;
+        }
+    private:
+        void begin_value()
+        {
+            if (stack_.empty())
+            {
+                slots_.clear();
+                strings_.clear();
+                bytes_.clear();
+                is_valid_ = false;
+            }
+            else if (slots_[stack_.back().index].kind() == detail::tape_kind::array_value)
+            {
+                ++stack_.back().count;
+            }
+        }
+
+        // Returns false at the end of a root value, so that the parser stops there
+        bool end_value()
+        {
+            if (stack_.empty())
+            {
+                is_valid_ = true;
+                return false;
+            }
+            return true;
+        }
+
+        uint64_t append_string(const string_view_type& s)
+        {
+            std::size_t offset = strings_.size();
+            strings_.insert(strings_.end(), s.begin(), s.end());
+            strings_.push_back(0);
+            return offset;
+        }
+
+        void visit_flush() override
+        {
+        }
+
+        bool visit_begin_object(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            stack_.push_back(container_info{slots_.size(), 0});
+            slots_.emplace_back(detail::tape_kind::object_value, tag, 0, 0);
+            return true;
+        }
+
+        bool visit_end_object(const ser_context&, std::error_code&) override
+        {
+            JSONCONS_ASSERT(!stack_.empty());
+            detail::tape_slot& slot = slots_[stack_.back().index];
+            slot.set_length(stack_.back().count);
+            slot.value = slots_.size() - stack_.back().index;
+            stack_.pop_back();
+            return end_value();
+        }
+
+        bool visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            stack_.push_back(container_info{slots_.size(), 0});
+            slots_.emplace_back(detail::tape_kind::array_value, tag, 0, 0);
+            return true;
+        }
+
+        bool visit_end_array(const ser_context&, std::error_code&) override
+        {
+            JSONCONS_ASSERT(!stack_.empty());
+            detail::tape_slot& slot = slots_[stack_.back().index];
+            slot.set_length(stack_.back().count);
+            slot.value = slots_.size() - stack_.back().index;
+            stack_.pop_back();
+            return end_value();
+        }
+
+        bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+        {
+            ++stack_.back().count;
+            uint64_t offset = append_string(name);
+            slots_.emplace_back(detail::tape_kind::key_value, semantic_tag::none, name.length(), offset);
+            return true;
+        }
+
+        bool visit_string(const string_view_type& sv, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            uint64_t offset = append_string(sv);
+            slots_.emplace_back(detail::tape_kind::string_value, tag, sv.length(), offset);
+            return end_value();
+        }
+
+        bool visit_byte_string(const byte_string_view& b,
+                               semantic_tag tag,
+                               const ser_context&,
+                               std::error_code&) override
+        {
+            begin_value();
+            std::size_t offset = bytes_.size();
+            bytes_.insert(bytes_.end(), b.begin(), b.end());
+            slots_.emplace_back(detail::tape_kind::byte_string_value, tag, b.size(), offset);
+            return end_value();
+        }
+
+        bool visit_byte_string(const byte_string_view& b,
+                               uint64_t ext_tag,
+                               const ser_context&,
+                               std::error_code&) override
+        {
+            begin_value();
+            // The extension tag precedes the bytes
+            uint8_t buf[sizeof(uint64_t)];
+            std::memcpy(buf, &ext_tag, sizeof(uint64_t));
+            bytes_.insert(bytes_.end(), buf, buf + sizeof(uint64_t));
+            std::size_t offset = bytes_.size();
+            bytes_.insert(bytes_.end(), b.begin(), b.end());
+            slots_.emplace_back(detail::tape_kind::byte_string_value, semantic_tag::ext, b.size(), offset);
+            return end_value();
+        }
+
+        bool visit_int64(int64_t value,
+                         semantic_tag tag,
+                         const ser_context&,
+                         std::error_code&) override
+        {
+            begin_value();
+            slots_.emplace_back(detail::tape_kind::int64_value, tag, 0, static_cast<uint64_t>(value));
+            return end_value();
+        }
+
+        bool visit_uint64(uint64_t value,
+                          semantic_tag tag,
+                          const ser_context&,
+                          std::error_code&) override
+        {
+            begin_value();
+            slots_.emplace_back(detail::tape_kind::uint64_value, tag, 0, value);
+            return end_value();
+        }
+
+        bool visit_half(uint16_t value,
+                        semantic_tag tag,
+                        const ser_context&,
+                        std::error_code&) override
+        {
+            begin_value();
+            slots_.emplace_back(detail::tape_kind::half_value, tag, 0, value);
+            return end_value();
+        }
+
+        bool visit_double(double value,
+                          semantic_tag tag,
+                          const ser_context&,
+                          std::error_code&) override
+        {
+            begin_value();
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(double));
+            slots_.emplace_back(detail::tape_kind::double_value, tag, 0, bits);
+            return end_value();
+        }
+
+        bool visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            slots_.emplace_back(detail::tape_kind::bool_value, tag, 0, value ? 1 : 0);
+            return end_value();
+        }
+
+        bool visit_null(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            slots_.emplace_back(detail::tape_kind::null_value, tag, 0, 0);
+            return end_value();
+        }
+    };
+
+    using tape_json = basic_tape_json<char>;
+    using wtape_json = basic_tape_json<wchar_t>;
+    using tape_json_view = basic_tape_json_view<char>;
+    using wtape_json_view = basic_tape_json_view<wchar_t>;
+    using tape_json_builder = basic_tape_json_builder<char>;
+    using wtape_json_builder = basic_tape_json_builder<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_VALIDATE_JSON_HPP
+#define JSONCONS_VALIDATE_JSON_HPP
+
+#include <string>
+#include <system_error>
+#include <functional> // std::function
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/detail/more_type_traits.hpp>
+#include <jsoncons/detail/json_scanner.hpp>
+
+namespace jsoncons {
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    validate_json(const Source& s,
+                  const basic_json_decode_options<typename Source::value_type>& options,
+                  std::function<bool(json_errc,const ser_context&)> err_handler,
+                  std::error_code& ec)
+    {
+        using char_type = typename Source::value_type;
+
+        jsoncons::detail::null_char_sink<char_type> sink;
+        jsoncons::detail::json_scanner<char_type> scanner(s.data(), s.size(), options, err_handler);
+        scanner.scan(sink, ec);
+    }
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    validate_json(const Source& s, std::error_code& ec)
+    {
+        validate_json(s, basic_json_decode_options<typename Source::value_type>(), default_json_parsing(), ec);
+    }
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    validate_json(const Source& s, std::error_code& ec, std::size_t& line, std::size_t& column)
+    {
+        using char_type = typename Source::value_type;
+
+        jsoncons::detail::null_char_sink<char_type> sink;
+        jsoncons::detail::json_scanner<char_type> scanner(s.data(), s.size(), basic_json_decode_options<char_type>(), default_json_parsing());
+        scanner.scan(sink, ec);
+        line = scanner.line();
+        column = scanner.column();
+    }
+
+    template <class Source>
+    typename std::enable_if<jsoncons::detail::is_char_sequence<Source>::value>::type
+    validate_json(const Source& s,
+                  const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
+    {
+        using char_type = typename Source::value_type;
+
+        std::error_code ec;
+        jsoncons::detail::null_char_sink<char_type> sink;
+        jsoncons::detail::json_scanner<char_type> scanner(s.data(), s.size(), options, default_json_parsing());
+        scanner.scan(sink, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, scanner.line(), scanner.column()));
+        }
+    }
+
+} // jsoncons
+
+#endif
@@ -153,6 +153,40 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Jumps over the document or array using its length prefix, without decoding it
+    void skip(std::error_code& ec) override
+    {
+        if (done())
+        {
+            return;
+        }
+        staj_event_type event_type = current().event_type();
+        if (event_type != staj_event_type::begin_object && event_type != staj_event_type::begin_array)
+        {
+            return;
+        }
+        parser_.restart();
+        if (!parser_.skip_container(cursor_visitor_, ec))
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+            return;
+        }
+        while (!ec && !parser_.stopped())
+        {
+            parser_.parse(cursor_visitor_, ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return *this;
@@ -25,7 +25,8 @@ enum class bson_errc
     datetime_too_small,
     datetime_too_large,
     expected_bson_document,
-    unknown_type
+    unknown_type,
+    invalid_document_length
 };
 
 class bson_error_category_impl
@@ -62,6 +63,8 @@ public:
                 return "datetime too small";
             case bson_errc::expected_bson_document:
                 return "Expected BSON document";
+            case bson_errc::invalid_document_length:
+                return "Document length does not match its contents";
             default:
                 return "Unknown BSON parser error";
         }
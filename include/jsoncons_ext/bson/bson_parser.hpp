@@ -56,6 +56,7 @@ class basic_bson_parser : public ser_context
     bool more_;
     bool done_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> bytes_buffer_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
     int nesting_depth_;
 public:
@@ -68,6 +69,7 @@ public:
          more_(true), 
          done_(false),
          text_buffer_(alloc),
+         bytes_buffer_(alloc),
          state_stack_(alloc),
          nesting_depth_(0)
 
@@ -192,6 +194,44 @@ public:
         }
     }
 
+    // Skips the elements of the document or array that has just begun, using its length,
+    // then reports its end to the visitor. Returns false, and skips nothing, if the length
+    // is too small for a document.
+    bool skip_container(json_visitor& visitor, std::error_code& ec)
+    {
+        auto& state = state_stack_.back();
+        if ((state.mode != parse_mode::document && state.mode != parse_mode::array) || 
+            static_cast<int32_t>(state.length) < 5)
+        {
+            return false;
+        }
+        // The length includes the four length bytes and the terminating null
+        std::size_t length = state.length - 5;
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position != length)
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+            return true;
+        }
+        auto c = source_.peek_character();
+        if (!c)
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+            return true;
+        }
+        if (c.value() != 0x00)
+        {
+            ec = bson_errc::invalid_document_length;
+            more_ = false;
+            return true;
+        }
+        parse(visitor, ec);
+        return true;
+    }
+
 private:
 
     void begin_document(json_visitor& visitor, std::error_code& ec)
@@ -237,10 +277,10 @@ private:
             more_ = false;
             return;
         }
-        /* auto len = */ jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
+        auto length = jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
 
         more_ = visitor.begin_array(semantic_tag::none, *this, ec);
-        state_stack_.emplace_back(parse_mode::array,0);
+        state_stack_.emplace_back(parse_mode::array,length);
     }
 
     void end_array(json_visitor& visitor, std::error_code& ec)
@@ -306,9 +346,9 @@ private:
                     return;
                 }
 
-                std::vector<char> s;
+                text_buffer_.clear();
                 std::size_t size = static_cast<std::size_t>(len) - static_cast<std::size_t>(1);
-                if (source_reader<Src>::read(source_,s,size) != size)
+                if (source_reader<Src>::read(source_,text_buffer_,size) != size)
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
@@ -321,14 +361,14 @@ private:
                     more_ = false;
                     return;
                 }
-                auto result = unicons::validate(s.begin(),s.end());
+                auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
                 if (result.ec != unicons::conv_errc())
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                more_ = visitor.string_value(jsoncons::basic_string_view<char>(s.data(),s.size()), semantic_tag::none, *this, ec);
+                more_ = visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
                 break;
             }
             case jsoncons::bson::detail::bson_format::document_cd: 
@@ -438,15 +478,15 @@ private:
                     return;
                 }
 
-                std::vector<uint8_t> v;
-                if (source_reader<Src>::read(source_, v, len) != static_cast<std::size_t>(len))
+                bytes_buffer_.clear();
+                if (source_reader<Src>::read(source_, bytes_buffer_, len) != static_cast<std::size_t>(len))
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
 
-                more_ = visitor.byte_string_value(byte_string_view(v), 
+                more_ = visitor.byte_string_value(byte_string_view(bytes_buffer_.data(),bytes_buffer_.size()), 
                                                   subtype.value(), 
                                                   *this,
                                                   ec);
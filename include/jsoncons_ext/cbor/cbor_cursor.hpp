@@ -50,7 +50,7 @@ public:
                       const cbor_decode_options& options = cbor_decode_options(),
                       const Allocator& alloc = Allocator())
         : parser_(std::forward<Source>(source), options, alloc), 
-          cursor_visitor_(accept_all), 
+          cursor_visitor_(), 
           cursor_handler_adaptor_(cursor_visitor_, alloc),
           eof_(false)
     {
@@ -89,7 +89,7 @@ public:
                       const cbor_decode_options& options,
                       std::error_code& ec)
        : parser_(std::forward<Source>(source), options, alloc), 
-         cursor_visitor_(accept_all),
+         cursor_visitor_(),
          cursor_handler_adaptor_(cursor_visitor_, alloc),
          eof_(false)
     {
@@ -148,6 +148,92 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Jumps over the container using the lengths of its items, without decoding them,
+    // except in a stringref namespace or in a typed or multi-dimensional array
+    void skip(std::error_code& ec) override
+    {
+        if (done())
+        {
+            return;
+        }
+        staj_event_type event_type = current().event_type();
+        if (event_type != staj_event_type::begin_object && event_type != staj_event_type::begin_array)
+        {
+            return;
+        }
+        parser_.restart();
+        if (cursor_visitor_.in_available() || !parser_.skip_container(cursor_handler_adaptor_, ec))
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+            return;
+        }
+        while (!ec && !parser_.stopped())
+        {
+            parser_.parse(cursor_handler_adaptor_, ec);
+        }
+    }
+
+    void read_batch(staj_event_batch& batch) override
+    {
+        std::error_code ec;
+        read_batch(batch, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // The parser puts the events after the current one in the batch, without stopping after each,
+    // except that the elements of typed arrays and the shapes of multi-dimensional arrays are
+    // reported one by one
+    void read_batch(staj_event_batch& batch, std::error_code& ec) override
+    {
+        if (cursor_visitor_.filtered())
+        {
+            basic_staj_cursor<char_type>::read_batch(batch, ec);
+            return;
+        }
+        batch.clear();
+        if (done() || batch.full())
+        {
+            return;
+        }
+        batch.push_back(current());
+        basic_staj_batch_visitor<char_type> visitor(batch, cursor_visitor_);
+        while (!batch.full())
+        {
+            if (cursor_visitor_.in_available())
+            {
+                cursor_visitor_.send_available(ec);
+                if (ec) return;
+            }
+            else
+            {
+                read_next(visitor, ec);
+                if (ec || done())
+                {
+                    return;
+                }
+                if (!cursor_visitor_.in_available())
+                {
+                    break; // the batch is full
+                }
+            }
+            batch.push_back(current());
+        }
+        read_next(ec);
+    }
+
     const ser_context& context() const override
     {
         return *this;
@@ -235,11 +321,6 @@ public:
     }
 #endif
 private:
-    static bool accept_all(const staj_event&, const ser_context&) 
-    {
-        return true;
-    }
-
     void read_next(std::error_code& ec)
     {
         if (cursor_visitor_.in_available())
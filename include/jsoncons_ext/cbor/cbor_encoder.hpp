@@ -27,6 +27,8 @@ enum class cbor_container_type {object, indefinite_length_object, array, indefin
 template<class Sink=jsoncons::binary_stream_sink,class Allocator=std::allocator<char>>
 class basic_cbor_encoder final : public basic_json_visitor<char>
 {
+    template <class Visitor> friend class jsoncons::static_json_visitor;
+
     using super_type = basic_json_visitor<char>;
 
     enum class decimal_parse_state { start, integer, exp1, exp2, fraction1 };
@@ -321,6 +321,174 @@ public:
             }
         }
     }
+    // Skips the remaining elements or members of the array or map that has just begun, 
+    // reading only initial bytes and arguments, then reports its end to the visitor.
+    // Returns false, and skips nothing, if the container is in a stringref namespace,
+    // where the skipped strings would be needed, or is a multi-dimensional array.
+    bool skip_container(json_visitor2& visitor, std::error_code& ec)
+    {
+        if (!stringref_map_stack_.empty())
+        {
+            return false;
+        }
+        std::size_t count = 0; // items left in the current run of definite length containers
+        std::vector<std::size_t> saved_counts; // counts saved on entering indefinite length items
+        std::size_t base = 0;
+        switch (state_stack_.back().mode)
+        {
+            case parse_mode::array:
+                count = state_stack_.back().length - state_stack_.back().index;
+                break;
+            case parse_mode::map_key:
+                count = 2*(state_stack_.back().length - state_stack_.back().index);
+                break;
+            case parse_mode::indefinite_array:
+            case parse_mode::indefinite_map_key:
+                saved_counts.push_back(0);
+                base = 1;
+                break;
+            default:
+                return false;
+        }
+
+        while (true)
+        {
+            bool counted = count > 0;
+            if (counted)
+            {
+                --count;
+            }
+            else
+            {
+                if (saved_counts.size() == 0)
+                {
+                    break;
+                }
+                auto c = source_.peek_character();
+                if (!c)
+                {
+                    ec = cbor_errc::unexpected_eof;
+                    more_ = false;
+                    return true;
+                }
+                if (c.value() == 0xff)
+                {
+                    if (saved_counts.size() == base)
+                    {
+                        break; // the break that ends the skipped container
+                    }
+                    source_.ignore(1);
+                    count = saved_counts.back();
+                    saved_counts.pop_back();
+                    continue;
+                }
+            }
+
+            if (source_.is_error())
+            {
+                ec = cbor_errc::source_error;
+                more_ = false;
+                return true;
+            }   
+            auto c = source_.get_character();
+            if (!c)
+            {
+                ec = cbor_errc::unexpected_eof;
+                more_ = false;
+                return true;
+            }
+            jsoncons::cbor::detail::cbor_major_type major_type = get_major_type(c.value());
+            uint8_t info = get_additional_information_value(c.value());
+
+            uint64_t val = info;
+            bool indefinite = false;
+            switch (info)
+            {
+                case JSONCONS_CBOR_0x00_0x17:
+                    break;
+                case 0x18:
+                case 0x19:
+                case 0x1a:
+                case 0x1b:
+                {
+                    uint8_t buf[sizeof(uint64_t)];
+                    std::size_t len = std::size_t(1) << (info - 0x18);
+                    if (source_.read(buf, len) != len)
+                    {
+                        ec = cbor_errc::unexpected_eof;
+                        more_ = false;
+                        return true;
+                    }
+                    val = 0;
+                    for (std::size_t i = 0; i < len; ++i)
+                    {
+                        val = (val << 8) | buf[i];
+                    }
+                    break;
+                }
+                case jsoncons::cbor::detail::additional_info::indefinite_length:
+                    indefinite = true;
+                    break;
+                default:
+                    ec = cbor_errc::unknown_type;
+                    more_ = false;
+                    return true;
+            }
+
+            if (indefinite)
+            {
+                switch (major_type)
+                {
+                    case jsoncons::cbor::detail::cbor_major_type::byte_string:
+                    case jsoncons::cbor::detail::cbor_major_type::text_string:
+                    case jsoncons::cbor::detail::cbor_major_type::array:
+                    case jsoncons::cbor::detail::cbor_major_type::map:
+                        saved_counts.push_back(count);
+                        count = 0;
+                        break;
+                    default:
+                        ec = cbor_errc::unknown_type;
+                        more_ = false;
+                        return true;
+                }
+                continue;
+            }
+            switch (major_type)
+            {
+                case jsoncons::cbor::detail::cbor_major_type::byte_string:
+                case jsoncons::cbor::detail::cbor_major_type::text_string:
+                {
+                    std::size_t position = source_.position();
+                    source_.ignore(static_cast<std::size_t>(val));
+                    if (source_.position() - position != val)
+                    {
+                        ec = cbor_errc::unexpected_eof;
+                        more_ = false;
+                        return true;
+                    }
+                    break;
+                }
+                case jsoncons::cbor::detail::cbor_major_type::array:
+                    count += static_cast<std::size_t>(val);
+                    break;
+                case jsoncons::cbor::detail::cbor_major_type::map:
+                    count += 2*static_cast<std::size_t>(val);
+                    break;
+                case jsoncons::cbor::detail::cbor_major_type::semantic_tag:
+                    if (counted)
+                    {
+                        ++count; // the tagged item
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        state_stack_.back().index = state_stack_.back().length;
+        parse(visitor, ec);
+        return true;
+    }
+
 private:
     void read_item(json_visitor2& visitor, std::error_code& ec)
     {
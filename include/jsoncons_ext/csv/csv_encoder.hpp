@@ -26,6 +26,8 @@ namespace jsoncons { namespace csv {
 template<class CharT,class Sink=jsoncons::stream_sink<CharT>,class Allocator=std::allocator<char>>
 class basic_csv_encoder final : public basic_json_visitor<CharT>
 {
+    template <class Visitor> friend class jsoncons::static_json_visitor;
+
 public:
     using char_type = CharT;
     using typename basic_json_visitor<CharT>::string_view_type;
@@ -573,15 +575,12 @@ private:
                 auto it = buffered_line_.find(name_);
                 if (it != buffered_line_.end())
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_sink<std::basic_string<CharT>> bo(s);
-                    write_int64_value(val,bo);
-                    bo.flush();
                     if (!it->second.empty() && options_.subfield_delimiter() != char_type())
                     {
                         it->second.push_back(options_.subfield_delimiter());
                     }
-                    it->second.append(s);
+                    jsoncons::string_sink<std::basic_string<CharT>> bo(it->second);
+                    write_int64_value(val,bo);
                 }
                 break;
             }
@@ -625,15 +624,12 @@ private:
                 auto it = buffered_line_.find(name_);
                 if (it != buffered_line_.end())
                 {
-                    std::basic_string<CharT> s;
-                    jsoncons::string_sink<std::basic_string<CharT>> bo(s);
-                    write_uint64_value(val, bo);
-                    bo.flush();
                     if (!it->second.empty() && options_.subfield_delimiter() != char_type())
                     {
                         it->second.push_back(options_.subfield_delimiter());
                     }
-                    it->second.append(s);
+                    jsoncons::string_sink<std::basic_string<CharT>> bo(it->second);
+                    write_uint64_value(val, bo);
                 }
                 break;
             }
@@ -1777,6 +1777,7 @@ private:
         bool is_negative = false;
         int precision = 0;
         uint8_t decimal_places = 0;
+        jsoncons::detail::decimal_accumulator number;
 
         auto last = buffer_.end();
 
@@ -1821,17 +1822,20 @@ private:
                         break;
                     case '-':
                         is_negative = true;
+                        number.negative();
                         buffer.push_back(*p);
                         state = numeric_check_state::minus;
                         break;
                     case '0':
                         ++precision;
                         buffer.push_back(*p);
+                        number.integer_digit(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         buffer.push_back(*p);
+                        number.integer_digit(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1865,6 +1869,7 @@ private:
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         buffer.push_back(*p);
+                        number.integer_digit(*p);
                         break;
                     case '.':
                         buffer.push_back(to_double_.get_decimal_point());
@@ -1887,11 +1892,13 @@ private:
                     case '0':
                         ++precision;
                         buffer.push_back(*p);
+                        number.integer_digit(*p);
                         state = numeric_check_state::zero;
                         break;
                     case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         ++precision;
                         buffer.push_back(*p);
+                        number.integer_digit(*p);
                         state = numeric_check_state::integer;
                         break;
                     default:
@@ -1908,6 +1915,7 @@ private:
                         ++precision;
                         ++decimal_places;
                         buffer.push_back(*p);
+                        number.fraction_digit(*p);
                         state = numeric_check_state::fraction;
                         break;
                     default:
@@ -1924,6 +1932,7 @@ private:
                         ++precision;
                         ++decimal_places;
                         buffer.push_back(*p);
+                        number.fraction_digit(*p);
                         break;
                     case 'e':case 'E':
                         buffer.push_back(*p);
@@ -1941,14 +1950,16 @@ private:
                     {
                     case '-':
                         buffer.push_back(*p);
+                        number.exponent_negative();
                         state = numeric_check_state::exp;
                         break;
                     case '+':
                         state = numeric_check_state::exp;
                         break;
-                    case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+                    case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         buffer.push_back(*p);
-                        state = numeric_check_state::integer;
+                        number.exponent_digit(*p);
+                        state = numeric_check_state::exp;
                         break;
                     default:
                         state = numeric_check_state::done;
@@ -1962,6 +1973,7 @@ private:
                     {
                     case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
                         buffer.push_back(*p);
+                        number.exponent_digit(*p);
                         break;
                     default:
                         state = numeric_check_state::done;
@@ -2029,7 +2041,11 @@ private:
                 }
                 else
                 {
-                    double d = to_double_(buffer.c_str(), buffer.length());
+                    double d;
+                    if (!number.to_double(d))
+                    {
+                        d = to_double_(buffer.c_str(), buffer.length());
+                    }
                     more_ = visitor_->double_value(d, semantic_tag::none, *this, ec);
                 }
                 break;
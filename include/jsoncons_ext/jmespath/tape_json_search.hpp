@@ -0,0 +1,65 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JMESPATH_TAPE_JSON_SEARCH_HPP
+#define JSONCONS_JMESPATH_TAPE_JSON_SEARCH_HPP
+
+#include <system_error>
+#include <jsoncons/json.hpp>
+#include <jsoncons/tape_json.hpp>
+#include <jsoncons_ext/jmespath/jmespath.hpp>
+
+namespace jsoncons { 
+namespace jmespath {
+
+    // The evaluator refers to the nodes of its input by address, so a tape document is searched
+    // through an order preserving basic_json copy of it. The copy is made by the first search and
+    // kept with the document, see basic_tape_json_view::cached_json.
+
+    template<class CharT>
+    basic_json<CharT,preserve_order_policy> search(const basic_tape_json_view<CharT>& doc, 
+                                                   const typename basic_tape_json_view<CharT>::string_view_type& path)
+    {
+        const basic_json<CharT,preserve_order_policy>* node = doc.cached_json();
+        if (node != nullptr)
+        {
+            return search(*node, path);
+        }
+        return search(doc.template as<basic_json<CharT,preserve_order_policy>>(), path);
+    }
+
+    template<class CharT>
+    basic_json<CharT,preserve_order_policy> search(const basic_tape_json_view<CharT>& doc, 
+                                                   const typename basic_tape_json_view<CharT>::string_view_type& path, 
+                                                   std::error_code& ec)
+    {
+        const basic_json<CharT,preserve_order_policy>* node = doc.cached_json();
+        if (node != nullptr)
+        {
+            return search(*node, path, ec);
+        }
+        return search(doc.template as<basic_json<CharT,preserve_order_policy>>(), path, ec);
+    }
+
+    template<class CharT,class Allocator>
+    basic_json<CharT,preserve_order_policy> search(const basic_tape_json<CharT,Allocator>& doc, 
+                                                   const typename basic_tape_json_view<CharT>::string_view_type& path)
+    {
+        return search(doc.root(), path);
+    }
+
+    template<class CharT,class Allocator>
+    basic_json<CharT,preserve_order_policy> search(const basic_tape_json<CharT,Allocator>& doc, 
+                                                   const typename basic_tape_json_view<CharT>::string_view_type& path, 
+                                                   std::error_code& ec)
+    {
+        return search(doc.root(), path, ec);
+    }
+
+} // namespace jmespath
+} // namespace jsoncons
+
+#endif
@@ -9,5 +9,6 @@
 
 #include <jsoncons_ext/jsonpath/json_query.hpp>
 #include <jsoncons_ext/jsonpath/flatten.hpp>
+#include <jsoncons_ext/jsonpath/streaming_expression.hpp>
 
 #endif
@@ -47,7 +47,8 @@ namespace jsoncons { namespace jsonpath {
         syntax_error,
         expected_comparator,
         expected_or,
-        expected_and
+        expected_and,
+        requires_dom_evaluator
     };
 
     class jsonpath_error_category_impl
@@ -126,6 +127,8 @@ namespace jsoncons { namespace jsonpath {
                     return "Expected operator '||'";
                 case jsonpath_errc::expected_and:
                     return "Expected operator '&&'";
+                case jsonpath_errc::requires_dom_evaluator:
+                    return "Expression is not supported by the streaming evaluator, use json_query";
                 default:
                     return "Unknown jsonpath parser error";
             }
@@ -0,0 +1,890 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSONPATH_STREAMING_EXPRESSION_HPP
+#define JSONCONS_JSONPATH_STREAMING_EXPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory> // std::unique_ptr
+#include <utility> // std::move
+#include <system_error>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath_error.hpp>
+#include <jsoncons_ext/jsonpath/json_query.hpp>
+
+namespace jsoncons { namespace jsonpath {
+
+namespace detail {
+
+    // A selector of one step of a streaming path: a name, an index, a slice with
+    // non-negative bounds and a positive step, or a wildcard
+
+    template <class CharT>
+    struct stream_selector
+    {
+        enum class kind {name, index, slice, wildcard};
+        using string_type = std::basic_string<CharT>;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+
+        kind kind_;
+        string_type name_;
+        bool name_is_index_;
+        std::size_t index_; // or slice start
+        std::size_t stop_;
+        bool has_stop_;
+        std::size_t step_;
+
+        stream_selector(kind k)
+            : kind_(k), name_is_index_(false), index_(0), stop_(0), has_stop_(false), step_(1)
+        {
+        }
+
+        // As for the DOM evaluator, a name that is a non-negative integer also selects an array element
+        bool matches(bool parent_is_array, std::size_t index, const string_view_type& key) const
+        {
+            switch (kind_)
+            {
+                case kind::wildcard:
+                    return true;
+                case kind::name:
+                    return parent_is_array ? (name_is_index_ && index == index_)
+                                           : key == string_view_type(name_.data(), name_.size());
+                case kind::index:
+                    return parent_is_array && index == index_;
+                case kind::slice:
+                    return parent_is_array && index >= index_ && (!has_stop_ || index < stop_) && (index - index_) % step_ == 0;
+                default:
+                    return false;
+            }
+        }
+    };
+
+    template <class CharT>
+    struct stream_step
+    {
+        bool recursive;
+        bool has_length; // a name selector "length", which selects the length of an array or string
+        std::vector<stream_selector<CharT>> selectors;
+
+        stream_step(bool recursive)
+            : recursive(recursive), has_length(false)
+        {
+        }
+
+        template <class StringView>
+        bool matches(bool parent_is_array, std::size_t index, const StringView& key) const
+        {
+            for (const auto& selector : selectors)
+            {
+                if (selector.matches(parent_is_array, index, key))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    // Parses the subset of JSONPath that can be evaluated over a stream of events:
+    // a path from the root ('$') of dot and bracket steps with names, wildcards,
+    // non-negative indices and slices, unions of those, and recursive descent.
+    // Returns false for anything else.
+
+    template <class CharT>
+    class stream_path_parser
+    {
+        using selector_type = stream_selector<CharT>;
+        using step_type = stream_step<CharT>;
+        using string_type = std::basic_string<CharT>;
+
+        const CharT* p_;
+        const CharT* end_;
+    public:
+        bool parse(const CharT* s, std::size_t length, std::vector<step_type>& steps)
+        {
+            p_ = s;
+            end_ = s + length;
+            skip_space();
+            if (p_ == end_ || *p_ != '$')
+            {
+                return false;
+            }
+            ++p_;
+            for (;;)
+            {
+                skip_space();
+                if (p_ == end_)
+                {
+                    return true;
+                }
+                if (*p_ == '.')
+                {
+                    ++p_;
+                    bool recursive = false;
+                    if (p_ != end_ && *p_ == '.')
+                    {
+                        recursive = true;
+                        ++p_;
+                    }
+                    steps.emplace_back(recursive);
+                    if (p_ != end_ && *p_ == '*')
+                    {
+                        ++p_;
+                        steps.back().selectors.emplace_back(selector_type::kind::wildcard);
+                    }
+                    else if (recursive && p_ != end_ && *p_ == '[')
+                    {
+                        ++p_;
+                        if (!parse_union(steps.back()))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        string_type name;
+                        while (p_ != end_ && is_identifier_character(*p_))
+                        {
+                            name.push_back(*p_++);
+                        }
+                        if (name.empty() || !add_name(std::move(name), steps.back()))
+                        {
+                            return false;
+                        }
+                    }
+                }
+                else if (*p_ == '[')
+                {
+                    ++p_;
+                    steps.emplace_back(false);
+                    if (!parse_union(steps.back()))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    return false;
+                }
+            }
+        }
+
+    private:
+        static bool is_identifier_character(CharT c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+                   typename std::make_unsigned<CharT>::type(c) > 127;
+        }
+
+        void skip_space()
+        {
+            while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r' || *p_ == '\n'))
+            {
+                ++p_;
+            }
+        }
+
+        // Parses the selectors of a bracket, after the '['
+        bool parse_union(step_type& step)
+        {
+            for (;;)
+            {
+                skip_space();
+                if (p_ == end_)
+                {
+                    return false;
+                }
+                if (*p_ == '*')
+                {
+                    ++p_;
+                    step.selectors.emplace_back(selector_type::kind::wildcard);
+                }
+                else if (*p_ == '\'' || *p_ == '\"')
+                {
+                    string_type name;
+                    if (!parse_quoted_string(name) || !add_name(std::move(name), step))
+                    {
+                        return false;
+                    }
+                }
+                else if (!parse_index_or_slice(step))
+                {
+                    return false;
+                }
+                skip_space();
+                if (p_ == end_)
+                {
+                    return false;
+                }
+                if (*p_ == ']')
+                {
+                    ++p_;
+                    return true;
+                }
+                if (*p_ != ',')
+                {
+                    return false;
+                }
+                ++p_;
+            }
+        }
+
+        bool add_name(string_type&& name, step_type& step)
+        {
+            selector_type selector(selector_type::kind::name);
+            if (!name.empty() && name[0] == '-' && jsoncons::detail::to_integer_decimal<int64_t>(name.data(), name.size()))
+            {
+                return false; // counts from the end of an array
+            }
+            auto r = jsoncons::detail::to_integer_decimal<uint64_t>(name.data(), name.size());
+            if (r)
+            {
+                selector.name_is_index_ = true;
+                selector.index_ = static_cast<std::size_t>(r.value());
+            }
+            if (name == length_literal<CharT>())
+            {
+                step.has_length = true;
+            }
+            selector.name_ = std::move(name);
+            step.selectors.push_back(std::move(selector));
+            return true;
+        }
+
+        bool parse_quoted_string(string_type& s)
+        {
+            CharT quote = *p_++;
+            while (p_ != end_ && *p_ != quote)
+            {
+                if (*p_ == '\\')
+                {
+                    if (++p_ == end_)
+                    {
+                        return false;
+                    }
+                    switch (*p_)
+                    {
+                        case '\\': case '\'': case '\"': case '/':
+                            s.push_back(*p_);
+                            break;
+                        case 'b':
+                            s.push_back('\b');
+                            break;
+                        case 'f':
+                            s.push_back('\f');
+                            break;
+                        case 'n':
+                            s.push_back('\n');
+                            break;
+                        case 'r':
+                            s.push_back('\r');
+                            break;
+                        case 't':
+                            s.push_back('\t');
+                            break;
+                        default:
+                            return false;
+                    }
+                    ++p_;
+                }
+                else
+                {
+                    s.push_back(*p_++);
+                }
+            }
+            if (p_ == end_)
+            {
+                return false;
+            }
+            ++p_;
+            return true;
+        }
+
+        // Parses an unsigned integer, returns false if there are no digits
+        bool parse_unsigned(std::size_t& value)
+        {
+            const CharT* first = p_;
+            while (p_ != end_ && *p_ >= '0' && *p_ <= '9')
+            {
+                ++p_;
+            }
+            if (p_ == first)
+            {
+                return false;
+            }
+            auto r = jsoncons::detail::to_integer_decimal<uint64_t>(first, static_cast<std::size_t>(p_ - first));
+            if (!r)
+            {
+                return false;
+            }
+            value = static_cast<std::size_t>(r.value());
+            return true;
+        }
+
+        bool parse_index_or_slice(step_type& step)
+        {
+            std::size_t start = 0;
+            bool has_start = parse_unsigned(start);
+            skip_space();
+            if (p_ == end_ || *p_ != ':')
+            {
+                if (!has_start)
+                {
+                    return false;
+                }
+                selector_type selector(selector_type::kind::index);
+                selector.index_ = start;
+                step.selectors.push_back(std::move(selector));
+                return true;
+            }
+            ++p_;
+            selector_type selector(selector_type::kind::slice);
+            selector.index_ = start;
+            skip_space();
+            selector.has_stop_ = parse_unsigned(selector.stop_);
+            skip_space();
+            if (p_ != end_ && *p_ == ':')
+            {
+                ++p_;
+                skip_space();
+                if (parse_unsigned(selector.step_) && selector.step_ == 0)
+                {
+                    return false;
+                }
+            }
+            step.selectors.push_back(std::move(selector));
+            return true;
+        }
+    };
+
+    // A basic_json_visitor that evaluates a streaming path over the events it receives.
+    // The steps are the transitions of a nondeterministic automaton whose states are
+    // step indices; the set of states of each open container on the path to the current
+    // event is kept in a stack, and containers with no states are skipped. A matched
+    // scalar is reported at once, a matched container when it ends, in document order.
+
+    template <class Json,class BinaryCallback>
+    class stream_path_evaluator final : public basic_json_visitor<typename Json::char_type>
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using typename basic_json_visitor<char_type>::string_view_type;
+    private:
+        using step_type = stream_step<char_type>;
+        using decoder_type = json_decoder<Json>;
+
+        struct frame
+        {
+            bool is_array;
+            std::size_t index; // of the current element
+            string_type key; // of the current member
+            std::size_t length_result; // one past the index of a pending length result, or 0
+        };
+
+        struct result
+        {
+            string_type path;
+            Json value;
+            bool ready;
+            bool discard;
+
+            result(string_type&& path)
+                : path(std::move(path)), ready(false), discard(false)
+            {
+            }
+        };
+
+        struct capture
+        {
+            std::size_t depth;
+            std::size_t result_index;
+            std::unique_ptr<decoder_type> decoder;
+        };
+
+        const std::vector<step_type>& steps_;
+        BinaryCallback& callback_;
+        std::size_t num_states_;
+        std::vector<frame> frames_;
+        std::vector<uint8_t> states_; // num_states_ per frame
+        std::vector<uint8_t> child_states_;
+        std::size_t skip_depth_;
+        std::vector<capture> captures_;
+        std::vector<std::unique_ptr<decoder_type>> free_decoders_;
+        std::deque<result> results_;
+        std::size_t results_base_; // number of results already reported or discarded
+        decoder_type scalar_decoder_;
+    public:
+        stream_path_evaluator(const std::vector<step_type>& steps, BinaryCallback& callback)
+            : steps_(steps), callback_(callback), num_states_(steps.size() + 1),
+              child_states_(steps.size() + 1), skip_depth_(0), results_base_(0)
+        {
+        }
+
+    private:
+        void visit_flush() override
+        {
+        }
+
+        bool visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->begin_object(tag, context, ec);
+            }
+            begin_container(false, [&](decoder_type& decoder) {decoder.begin_object(tag, context, ec);});
+            return true;
+        }
+
+        bool visit_end_object(const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->end_object(context, ec);
+            }
+            end_container();
+            return true;
+        }
+
+        bool visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->begin_array(tag, context, ec);
+            }
+            begin_container(true, [&](decoder_type& decoder) {decoder.begin_array(tag, context, ec);});
+            return true;
+        }
+
+        bool visit_end_array(const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->end_array(context, ec);
+            }
+            end_container();
+            return true;
+        }
+
+        bool visit_key(const string_view_type& name, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->key(name, context, ec);
+            }
+            if (skip_depth_ == 0 && !frames_.empty())
+            {
+                frames_.back().key.assign(name.data(), name.size());
+            }
+            return true;
+        }
+
+        bool visit_null(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->null_value(tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.null_value(tag, context, ec);});
+            return true;
+        }
+
+        bool visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->bool_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.bool_value(value, tag, context, ec);});
+            return true;
+        }
+
+        bool visit_string(const string_view_type& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->string_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.string_value(value, tag, context, ec);}, &value);
+            return true;
+        }
+
+        bool visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->byte_string_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.byte_string_value(value, tag, context, ec);});
+            return true;
+        }
+
+        bool visit_uint64(uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->uint64_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.uint64_value(value, tag, context, ec);});
+            return true;
+        }
+
+        bool visit_int64(int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->int64_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.int64_value(value, tag, context, ec);});
+            return true;
+        }
+
+        bool visit_half(uint16_t value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->half_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.half_value(value, tag, context, ec);});
+            return true;
+        }
+
+        bool visit_double(double value, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            for (auto& c : captures_)
+            {
+                c.decoder->double_value(value, tag, context, ec);
+            }
+            scalar([&](decoder_type& decoder) {decoder.double_value(value, tag, context, ec);});
+            return true;
+        }
+
+        // Computes the states of the current value from those of its parent into child_states_
+        void compute_child_states()
+        {
+            std::fill(child_states_.begin(), child_states_.end(), uint8_t(0));
+            if (frames_.empty())
+            {
+                child_states_[0] = 1;
+                return;
+            }
+            const frame& parent = frames_.back();
+            const uint8_t* parent_states = states_.data() + (frames_.size() - 1)*num_states_;
+            string_view_type key(parent.key.data(), parent.key.size());
+            for (std::size_t i = 0; i + 1 < num_states_; ++i)
+            {
+                if (parent_states[i])
+                {
+                    const step_type& step = steps_[i];
+                    if (step.recursive)
+                    {
+                        child_states_[i] = 1;
+                    }
+                    if (step.matches(parent.is_array, parent.index, key))
+                    {
+                        child_states_[i+1] = 1;
+                    }
+                }
+            }
+        }
+
+        // True if a state of the current value is followed by a final step that selects "length"
+        bool selects_length() const
+        {
+            return num_states_ >= 2 && child_states_[num_states_ - 2] && steps_.back().has_length;
+        }
+
+        template <class Send>
+        void scalar(Send send, const string_view_type* sv = nullptr)
+        {
+            if (skip_depth_ > 0)
+            {
+                return;
+            }
+            compute_child_states();
+            if (child_states_[num_states_ - 1])
+            {
+                scalar_decoder_.reset();
+                send(scalar_decoder_);
+                add_result(make_path(), scalar_decoder_.get_result());
+            }
+            // Recursive descent only selects the length of arrays
+            if (sv != nullptr && selects_length() && !steps_.back().recursive)
+            {
+                string_type path = make_path();
+                append_name(length_literal<char_type>(), path);
+                add_result(std::move(path), Json(unicons::u32_length(sv->begin(), sv->end())));
+            }
+            end_child();
+        }
+
+        template <class Send>
+        void begin_container(bool is_array, Send send)
+        {
+            if (skip_depth_ > 0)
+            {
+                ++skip_depth_;
+                return;
+            }
+            compute_child_states();
+            bool live = false;
+            for (auto s : child_states_)
+            {
+                if (s)
+                {
+                    live = true;
+                    break;
+                }
+            }
+            if (!live)
+            {
+                skip_depth_ = 1;
+                return;
+            }
+
+            std::size_t length_result = 0;
+            if (child_states_[num_states_ - 1])
+            {
+                results_.emplace_back(make_path());
+                capture c;
+                c.depth = frames_.size() + 1;
+                c.result_index = results_base_ + results_.size() - 1;
+                if (free_decoders_.empty())
+                {
+                    c.decoder.reset(new decoder_type());
+                }
+                else
+                {
+                    c.decoder = std::move(free_decoders_.back());
+                    free_decoders_.pop_back();
+                    c.decoder->reset();
+                }
+                send(*c.decoder);
+                captures_.push_back(std::move(c));
+            }
+            if (is_array && selects_length())
+            {
+                string_type path = make_path();
+                append_name(length_literal<char_type>(), path);
+                results_.emplace_back(std::move(path));
+                length_result = results_base_ + results_.size();
+            }
+
+            frames_.push_back(frame{is_array, 0, string_type(), length_result});
+            states_.insert(states_.end(), child_states_.begin(), child_states_.end());
+        }
+
+        void end_container()
+        {
+            if (skip_depth_ > 0)
+            {
+                if (--skip_depth_ == 0)
+                {
+                    end_child();
+                }
+                return;
+            }
+            if (!captures_.empty() && captures_.back().depth == frames_.size())
+            {
+                capture& c = captures_.back();
+                result& r = results_[c.result_index - results_base_];
+                r.value = c.decoder->get_result();
+                r.ready = true;
+                free_decoders_.push_back(std::move(c.decoder));
+                captures_.pop_back();
+            }
+            const frame& f = frames_.back();
+            if (f.length_result != 0)
+            {
+                result& r = results_[f.length_result - 1 - results_base_];
+                if (f.index > 0)
+                {
+                    r.value = Json(f.index);
+                }
+                else
+                {
+                    r.discard = true; // the DOM evaluator selects no length for an empty array
+                }
+                r.ready = true;
+            }
+            frames_.pop_back();
+            states_.resize(states_.size() - num_states_);
+            end_child();
+            report_results();
+        }
+
+        void end_child()
+        {
+            if (!frames_.empty() && frames_.back().is_array)
+            {
+                ++frames_.back().index;
+            }
+        }
+
+        void add_result(string_type&& path, Json&& value)
+        {
+            if (results_.empty())
+            {
+                callback_(path, value);
+                return;
+            }
+            results_.emplace_back(std::move(path));
+            results_.back().value = std::move(value);
+            results_.back().ready = true;
+        }
+
+        void report_results()
+        {
+            while (!results_.empty() && results_.front().ready)
+            {
+                if (!results_.front().discard)
+                {
+                    callback_(results_.front().path, results_.front().value);
+                }
+                results_.pop_front();
+                ++results_base_;
+            }
+        }
+
+        // Normalized path of the current value, as reported by the DOM evaluator
+        string_type make_path() const
+        {
+            string_type path;
+            path.push_back('$');
+            for (const auto& f : frames_)
+            {
+                if (f.is_array)
+                {
+                    path.push_back('[');
+                    jsoncons::detail::from_integer(f.index, path);
+                    path.push_back(']');
+                }
+                else
+                {
+                    append_name(f.key, path);
+                }
+            }
+            return path;
+        }
+
+        template <class Name>
+        static void append_name(const Name& name, string_type& path)
+        {
+            path.push_back('[');
+            path.push_back('\'');
+            path.append(name.data(), name.size());
+            path.push_back('\'');
+            path.push_back(']');
+        }
+    };
+
+} // namespace detail
+
+    // A JSONPath expression compiled for evaluation over a stream of events, for example
+    // from a json_cursor, without building the document. Matched values are reported with
+    // their normalized paths in document order, each once. Memory use is bounded by the
+    // depth of the document and the size of the matched values.
+    //
+    // Supported are dot and bracket names, wildcards, non-negative indices, slices with
+    // non-negative bounds and a positive step, unions of these, recursive descent, and
+    // the "length" of arrays and strings. Compiling any other valid expression fails
+    // with jsonpath_errc::requires_dom_evaluator.
+
+    template <class Json>
+    class streaming_expression
+    {
+    public:
+        using char_type = typename Json::char_type;
+        using string_type = std::basic_string<char_type>;
+        using string_view_type = typename Json::string_view_type;
+    private:
+        std::vector<detail::stream_step<char_type>> steps_;
+    public:
+        streaming_expression() = default;
+
+        static streaming_expression compile(const string_view_type& path)
+        {
+            std::error_code ec;
+            streaming_expression expr = compile(path, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(jsonpath_error(ec));
+            }
+            return expr;
+        }
+
+        static streaming_expression compile(const string_view_type& path, std::error_code& ec)
+        {
+            streaming_expression expr;
+            detail::stream_path_parser<char_type> parser;
+            if (!parser.parse(path.data(), path.size(), expr.steps_))
+            {
+                // Distinguish expressions that are invalid from those that need the document
+                make_expression<Json>(path, ec);
+                if (!ec)
+                {
+                    ec = jsonpath_errc::requires_dom_evaluator;
+                }
+                expr.steps_.clear();
+            }
+            return expr;
+        }
+
+        template <class BinaryCallback>
+        typename std::enable_if<jsoncons::detail::is_binary_function_object<BinaryCallback,const string_type&,const Json&>::value,void>::type
+        evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback) const
+        {
+            std::error_code ec;
+            evaluate(cursor, callback, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+            }
+        }
+
+        template <class BinaryCallback>
+        typename std::enable_if<jsoncons::detail::is_binary_function_object<BinaryCallback,const string_type&,const Json&>::value,void>::type
+        evaluate(basic_staj_cursor<char_type>& cursor, BinaryCallback callback, std::error_code& ec) const
+        {
+            detail::stream_path_evaluator<Json,BinaryCallback> evaluator(steps_, callback);
+            while (!cursor.done())
+            {
+                staj_to_saj_event(cursor.current(), evaluator, cursor.context(), ec);
+                if (ec)
+                {
+                    return;
+                }
+                cursor.next(ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    template <class Json>
+    streaming_expression<Json> make_streaming_expression(const typename Json::string_view_type& path)
+    {
+        return streaming_expression<Json>::compile(path);
+    }
+
+    template <class Json>
+    streaming_expression<Json> make_streaming_expression(const typename Json::string_view_type& path, std::error_code& ec)
+    {
+        return streaming_expression<Json>::compile(path, ec);
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif // JSONCONS_JSONPATH_STREAMING_EXPRESSION_HPP
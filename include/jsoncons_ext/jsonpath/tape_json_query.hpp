@@ -0,0 +1,44 @@
+// Copyright 2020 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSONPATH_TAPE_JSON_QUERY_HPP
+#define JSONCONS_JSONPATH_TAPE_JSON_QUERY_HPP
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/tape_json.hpp>
+#include <jsoncons_ext/jsonpath/json_query.hpp>
+
+namespace jsoncons { namespace jsonpath {
+
+    // The evaluator refers to the nodes of its input by address, so a tape document is queried
+    // through an order preserving basic_json copy of it. The copy is made by the first query and
+    // kept with the document, see basic_tape_json_view::cached_json.
+
+    template<class CharT>
+    basic_json<CharT,preserve_order_policy> json_query(const basic_tape_json_view<CharT>& instance, 
+                                                       const typename basic_tape_json_view<CharT>::string_view_type& path, 
+                                                       result_options options = result_options::value)
+    {
+        const basic_json<CharT,preserve_order_policy>* node = instance.cached_json();
+        if (node != nullptr)
+        {
+            return json_query(*node, path, options);
+        }
+        return json_query(instance.template as<basic_json<CharT,preserve_order_policy>>(), path, options);
+    }
+
+    template<class CharT,class Allocator>
+    basic_json<CharT,preserve_order_policy> json_query(const basic_tape_json<CharT,Allocator>& instance, 
+                                                       const typename basic_tape_json_view<CharT>::string_view_type& path, 
+                                                       result_options options = result_options::value)
+    {
+        return json_query(instance.root(), path, options);
+    }
+
+} // namespace jsonpath
+} // namespace jsoncons
+
+#endif
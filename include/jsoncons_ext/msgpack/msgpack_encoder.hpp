@@ -29,6 +29,8 @@ namespace msgpack {
     template<class Sink=jsoncons::binary_stream_sink,class Allocator=std::allocator<char>>
     class basic_msgpack_encoder final : public basic_json_visitor<char>
     {
+        template <class Visitor> friend class jsoncons::static_json_visitor;
+
         enum class decimal_parse_state { start, integer, exp1, exp2, fraction1 };
 
         static constexpr int64_t nanos_in_milli = 1000000;
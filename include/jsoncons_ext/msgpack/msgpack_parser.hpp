@@ -185,6 +185,129 @@ public:
             }
         }
     }
+
+    // Skips the remaining elements or members of the array or map that has just begun, 
+    // reading only type bytes and lengths, then reports its end to the visitor.
+    void skip_container(json_visitor2& visitor, std::error_code& ec)
+    {
+        parse_state& state = state_stack_.back();
+        std::size_t count = state.length - state.index;
+        if (state.mode == parse_mode::map_key)
+        {
+            count *= 2;
+        }
+        while (count > 0)
+        {
+            --count;
+            if (source_.is_error())
+            {
+                ec = msgpack_errc::source_error;
+                more_ = false;
+                return;
+            }   
+            auto ch = source_.get_character();
+            if (!ch)
+            {
+                ec = msgpack_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            uint8_t type = ch.value();
+
+            std::size_t len = 0;
+            if (type <= 0x7f || type >= 0xe0) 
+            {
+                // fixint
+            }
+            else if (type <= 0x8f) 
+            {
+                count += 2*(type & 0x0f); // fixmap
+            }
+            else if (type <= 0x9f) 
+            {
+                count += type & 0x0f; // fixarray
+            }
+            else if (type <= 0xbf) 
+            {
+                len = type & 0x1f; // fixstr
+            }
+            else
+            {
+                switch (type)
+                {
+                    case jsoncons::msgpack::detail::msgpack_format::nil_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::true_cd:
+                    case jsoncons::msgpack::detail::msgpack_format::false_cd:
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int8_cd: 
+                        len = 1;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int16_cd: 
+                        len = 2;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint32_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int32_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::float32_cd: 
+                        len = 4;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint64_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int64_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::float64_cd: 
+                        len = 8;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::str8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::str16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::str32_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::bin8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::bin16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::bin32_cd: 
+                        len = get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::fixext1_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext2_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext4_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::ext8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::ext16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::ext32_cd: 
+                        len = get_size(type, ec) + 1; // ext type and payload
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::array16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::array32_cd: 
+                        count += get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::map16_cd : 
+                    case jsoncons::msgpack::detail::msgpack_format::map32_cd : 
+                        count += 2*get_size(type, ec);
+                        break;
+                    default:
+                        ec = msgpack_errc::unknown_type;
+                        more_ = false;
+                        return;
+                }
+                if (!more_)
+                {
+                    return;
+                }
+            }
+            if (len > 0)
+            {
+                std::size_t position = source_.position();
+                source_.ignore(len);
+                if (source_.position() - position != len)
+                {
+                    ec = msgpack_errc::unexpected_eof;
+                    more_ = false;
+                    return;
+                }
+            }
+        }
+        state_stack_.back().index = state_stack_.back().length;
+        parse(visitor, ec);
+    }
 private:
 
     void read_item(json_visitor2& visitor, std::error_code& ec)
@@ -140,6 +140,36 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Jumps over the container using the lengths of its items, without decoding them
+    void skip(std::error_code& ec) override
+    {
+        if (done())
+        {
+            return;
+        }
+        staj_event_type event_type = current().event_type();
+        if (event_type != staj_event_type::begin_object && event_type != staj_event_type::begin_array)
+        {
+            return;
+        }
+        parser_.restart();
+        parser_.skip_container(cursor_visitor_, ec);
+        while (!ec && !parser_.stopped())
+        {
+            parser_.parse(cursor_visitor_, ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return *this;
@@ -9,6 +9,7 @@
 
 #include <string>
 #include <memory>
+#include <limits>
 #include <utility> // std::move
 #include <jsoncons/json.hpp>
 #include <jsoncons/source.hpp>
@@ -301,6 +302,113 @@ public:
             }
         }
     }
+    // Skips the remaining elements or members of the array or object that has just begun, 
+    // reading only markers, types and lengths, then reports its end to the visitor. The
+    // elements of a strongly typed array of numbers are skipped all at once.
+    void skip_container(json_visitor& visitor, std::error_code& ec)
+    {
+        std::vector<parse_state,parse_state_allocator_type> stack(state_stack_.get_allocator());
+        stack.push_back(state_stack_.back());
+        while (!stack.empty())
+        {
+            parse_state& state = stack.back();
+            switch (state.mode)
+            {
+                case parse_mode::array:
+                case parse_mode::strongly_typed_array:
+                    if (state.index < state.length)
+                    {
+                        std::size_t size = state.mode == parse_mode::array ? 0 : fixed_size(state.type);
+                        if (size > 0)
+                        {
+                            std::size_t count = state.length - state.index;
+                            state.index = state.length;
+                            if (count > (std::numeric_limits<std::size_t>::max)() / size)
+                            {
+                                ec = ubjson_errc::number_too_large;
+                                more_ = false;
+                                return;
+                            }
+                            skip_bytes(count*size, ec);
+                        }
+                        else
+                        {
+                            ++state.index;
+                            skip_value(state.mode == parse_mode::array ? 0 : state.type, stack, ec);
+                        }
+                    }
+                    else
+                    {
+                        stack.pop_back();
+                    }
+                    break;
+                case parse_mode::map_key:
+                case parse_mode::strongly_typed_map_key:
+                    if (state.index < state.length)
+                    {
+                        ++state.index;
+                        state.mode = state.mode == parse_mode::map_key ? parse_mode::map_value : parse_mode::strongly_typed_map_value;
+                        skip_key(ec);
+                    }
+                    else
+                    {
+                        stack.pop_back();
+                    }
+                    break;
+                case parse_mode::map_value:
+                    state.mode = parse_mode::map_key;
+                    skip_value(0, stack, ec);
+                    break;
+                case parse_mode::strongly_typed_map_value:
+                    state.mode = parse_mode::strongly_typed_map_key;
+                    skip_value(state.type, stack, ec);
+                    break;
+                case parse_mode::indefinite_array:
+                case parse_mode::indefinite_map_key:
+                {
+                    auto c = source_.peek_character();
+                    if (!c)
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        more_ = false;
+                        return;
+                    }
+                    if (c.value() == (state.mode == parse_mode::indefinite_array ? jsoncons::ubjson::detail::ubjson_format::end_array_marker 
+                                                                                 : jsoncons::ubjson::detail::ubjson_format::end_object_marker))
+                    {
+                        if (stack.size() > 1) // the end of the skipped container is left for parse
+                        {
+                            source_.ignore(1);
+                        }
+                        stack.pop_back();
+                    }
+                    else if (state.mode == parse_mode::indefinite_array)
+                    {
+                        skip_value(0, stack, ec);
+                    }
+                    else
+                    {
+                        state.mode = parse_mode::indefinite_map_value;
+                        skip_key(ec);
+                    }
+                    break;
+                }
+                case parse_mode::indefinite_map_value:
+                    state.mode = parse_mode::indefinite_map_key;
+                    skip_value(0, stack, ec);
+                    break;
+                default:
+                    stack.pop_back();
+                    break;
+            }
+            if (ec)
+            {
+                return;
+            }
+        }
+        state_stack_.back().index = state_stack_.back().length;
+        parse(visitor, ec);
+    }
 private:
     void read_type_and_value(json_visitor& visitor, std::error_code& ec)
     {
@@ -836,6 +944,157 @@ private:
         return length;
     }
 
+    // The number of bytes in a value of a type with a fixed size, or 0
+    static std::size_t fixed_size(uint8_t type)
+    {
+        switch (type)
+        {
+            case jsoncons::ubjson::detail::ubjson_format::int8_type: 
+            case jsoncons::ubjson::detail::ubjson_format::uint8_type: 
+            case jsoncons::ubjson::detail::ubjson_format::char_type: 
+                return 1;
+            case jsoncons::ubjson::detail::ubjson_format::int16_type: 
+                return 2;
+            case jsoncons::ubjson::detail::ubjson_format::int32_type: 
+            case jsoncons::ubjson::detail::ubjson_format::float32_type: 
+                return 4;
+            case jsoncons::ubjson::detail::ubjson_format::int64_type: 
+            case jsoncons::ubjson::detail::ubjson_format::float64_type: 
+                return 8;
+            default:
+                return 0;
+        }
+    }
+
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        if (ec || length == 0)
+        {
+            return;
+        }
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position != length)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    void skip_key(std::error_code& ec)
+    {
+        std::size_t length = get_length(ec);
+        if (ec)
+        {
+            ec = ubjson_errc::key_expected;
+            more_ = false;
+            return;
+        }
+        skip_bytes(length, ec);
+    }
+
+    // Skips a value of the given type, or, if type is 0, a type and value. A container
+    // is not skipped, its state is pushed onto the stack.
+    template <class Stack>
+    void skip_value(uint8_t type, Stack& stack, std::error_code& ec)
+    {
+        if (type == 0)
+        {
+            if (source_.is_error())
+            {
+                ec = ubjson_errc::source_error;
+                more_ = false;
+                return;
+            }   
+            auto ch = source_.get_character();
+            if (!ch)
+            {
+                ec = ubjson_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            type = ch.value();
+        }
+        switch (type)
+        {
+            case jsoncons::ubjson::detail::ubjson_format::null_type: 
+            case jsoncons::ubjson::detail::ubjson_format::no_op_type: 
+            case jsoncons::ubjson::detail::ubjson_format::true_type:
+            case jsoncons::ubjson::detail::ubjson_format::false_type:
+                break;
+            case jsoncons::ubjson::detail::ubjson_format::string_type: 
+            case jsoncons::ubjson::detail::ubjson_format::high_precision_number_type: 
+                skip_bytes(get_length(ec), ec);
+                break;
+            case jsoncons::ubjson::detail::ubjson_format::start_array_marker: 
+            case jsoncons::ubjson::detail::ubjson_format::start_object_marker: 
+            {
+                bool is_array = type == jsoncons::ubjson::detail::ubjson_format::start_array_marker;
+                uint8_t item_type = 0;
+                auto c = source_.peek_character();
+                if (c && c.value() == jsoncons::ubjson::detail::ubjson_format::type_marker)
+                {
+                    source_.ignore(1);
+                    auto t = source_.get_character();
+                    if (!t)
+                    {
+                        ec = ubjson_errc::unexpected_eof;
+                        more_ = false;
+                        return;
+                    }
+                    item_type = t.value();
+                    c = source_.peek_character();
+                    if (c && c.value() != jsoncons::ubjson::detail::ubjson_format::count_marker)
+                    {
+                        ec = ubjson_errc::count_required_after_type;
+                        more_ = false;
+                        return;
+                    }
+                }
+                if (!c)
+                {
+                    ec = ubjson_errc::unexpected_eof;
+                    more_ = false;
+                    return;
+                }
+                if (c.value() == jsoncons::ubjson::detail::ubjson_format::count_marker)
+                {
+                    source_.ignore(1);
+                    std::size_t length = get_length(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    if (item_type != 0)
+                    {
+                        stack.emplace_back(is_array ? parse_mode::strongly_typed_array : parse_mode::strongly_typed_map_key, length, item_type);
+                    }
+                    else
+                    {
+                        stack.emplace_back(is_array ? parse_mode::array : parse_mode::map_key, length);
+                    }
+                }
+                else
+                {
+                    stack.emplace_back(is_array ? parse_mode::indefinite_array : parse_mode::indefinite_map_key, 0);
+                }
+                break;
+            }
+            default:
+            {
+                std::size_t size = fixed_size(type);
+                if (size == 0)
+                {
+                    ec = ubjson_errc::unknown_type;
+                    more_ = false;
+                    return;
+                }
+                skip_bytes(size, ec);
+                break;
+            }
+        }
+    }
+
     void read_key(json_visitor& visitor, std::error_code& ec)
     {
         std::size_t length = get_length(ec);
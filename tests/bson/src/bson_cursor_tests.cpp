@@ -13,6 +13,7 @@
 #include <vector>
 #include <utility>
 #include <ctime>
+#include <random>
 
 using namespace jsoncons;
 
@@ -77,3 +78,155 @@ TEST_CASE("bson_cursor reputon test")
     }
 }
 
+
+namespace {
+
+    json random_bson_value(std::mt19937& gen, int depth)
+    {
+        switch (gen() % (depth > 0 ? 8 : 5))
+        {
+            case 0:
+                return json(static_cast<int64_t>(gen()) - static_cast<int64_t>(gen() % 2 == 0 ? 100 : 3000000000));
+            case 1:
+                return gen() % 2 == 0 ? json(1.5) : json::null();
+            case 2:
+                return json(std::string(gen() % 100, 'x'));
+            case 3:
+                return json(byte_string_arg, std::vector<uint8_t>(gen() % 20, 7));
+            case 4:
+                return json(gen() % 2 == 0);
+            case 5:
+            case 6:
+            {
+                json a(json_array_arg);
+                std::size_t n = gen() % 20;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    a.push_back(random_bson_value(gen, depth - 1));
+                }
+                return a;
+            }
+            default:
+            {
+                json o(json_object_arg);
+                std::size_t n = gen() % 20;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    o.insert_or_assign(std::string(gen() % 3, 'k') + std::to_string(i), random_bson_value(gen, depth - 1));
+                }
+                return o;
+            }
+        }
+    }
+
+    std::string bson_event_string(const staj_cursor& cursor)
+    {
+        std::string s = std::to_string(static_cast<int>(cursor.current().event_type()));
+        switch (cursor.current().event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+                s.push_back(':');
+                s.append(cursor.current().get<std::string>());
+                break;
+            default:
+                break;
+        }
+        s.push_back('@');
+        s.append(std::to_string(cursor.context().column()));
+        return s;
+    }
+}
+
+TEST_CASE("bson_cursor skip tests")
+{
+    SECTION("skip document and array")
+    {
+        json j = json::parse(R"({"a":[1,{"b":"c"},[[]],-1.5],"d":{"e":"f"},"g":3})");
+        std::vector<uint8_t> data;
+        bson::encode_bson(j, data);
+
+        bson::bson_bytes_cursor cursor(data);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "a");
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "d");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "g");
+        cursor.next();
+        CHECK(cursor.current().get<int>() == 3);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("truncated input and wrong length")
+    {
+        json j = json::parse(R"({"a":[1,"abcdef",[2]]})");
+        std::vector<uint8_t> data;
+        bson::encode_bson(j, data);
+
+        std::vector<uint8_t> truncated(data.begin(), data.end() - 5);
+        bson::bson_bytes_cursor cursor1(truncated);
+        cursor1.next();
+        cursor1.next();
+        std::error_code ec;
+        cursor1.skip(ec);
+        CHECK(ec == bson::bson_errc::unexpected_eof);
+
+        j.insert_or_assign("b", 2);
+        data.clear();
+        bson::encode_bson(j, data);
+        ++data[7]; // the length of the array
+        bson::bson_bytes_cursor cursor2(data);
+        cursor2.next();
+        cursor2.next();
+        REQUIRE(cursor2.current().event_type() == staj_event_type::begin_array);
+        std::error_code ec2;
+        cursor2.skip(ec2);
+        CHECK(ec2 == bson::bson_errc::invalid_document_length);
+    }
+
+    SECTION("same events and positions as skipping event by event")
+    {
+        std::mt19937 gen(2020);
+        for (int i = 0; i < 200; ++i)
+        {
+            json j(json_object_arg);
+            j.insert_or_assign("a", random_bson_value(gen, 4));
+            j.insert_or_assign("b", random_bson_value(gen, 4));
+            std::vector<uint8_t> data;
+            bson::encode_bson(j, data);
+
+            bson::bson_bytes_cursor cursor1(data);
+            bson::bson_bytes_cursor cursor2(data);
+            std::mt19937 choice(i);
+            while (!cursor1.done() && !cursor2.done())
+            {
+                REQUIRE(bson_event_string(cursor1) == bson_event_string(cursor2));
+                if (choice() % 3 == 0)
+                {
+                    cursor1.skip();
+                    std::error_code ec;
+                    cursor2.staj_cursor::skip(ec); // event by event
+                    REQUIRE_FALSE(ec);
+                    REQUIRE(bson_event_string(cursor1) == bson_event_string(cursor2));
+                }
+                cursor1.next();
+                cursor2.next();
+            }
+            CHECK(cursor1.done());
+            CHECK(cursor2.done());
+        }
+    }
+}
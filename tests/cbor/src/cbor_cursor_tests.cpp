@@ -13,6 +13,7 @@
 #include <vector>
 #include <utility>
 #include <ctime>
+#include <random>
 
 using namespace jsoncons;
 
@@ -261,3 +262,323 @@ TEST_CASE("cbor_cursor with filter tests")
     CHECK(filtered_c.done());
 }
 
+
+namespace {
+
+    // The encoder counts a typed array as an item of a definite length array only when it
+    // is written as an array, so typed arrays are only written in indefinite length containers
+    void random_cbor_value(std::mt19937& gen, int depth, cbor::cbor_bytes_encoder& encoder, bool indefinite_parent = true)
+    {
+        switch (gen() % (depth > 0 ? 11 : 7))
+        {
+            case 0:
+                encoder.int64_value(static_cast<int64_t>(gen()) - static_cast<int64_t>(gen() % 2 == 0 ? 100 : 3000000000), 
+                                    gen() % 4 == 0 ? semantic_tag::epoch_second : semantic_tag::none);
+                break;
+            case 1:
+                encoder.double_value(gen() % 2 == 0 ? 1.5 : 1.0e300);
+                break;
+            case 2:
+                encoder.string_value(std::string(gen() % 300, 'x'));
+                break;
+            case 3:
+                encoder.byte_string_value(std::vector<uint8_t>(gen() % 30, 7));
+                break;
+            case 4:
+                if (gen() % 2 == 0)
+                {
+                    encoder.string_value("-18446744073709551617", semantic_tag::bigint);
+                }
+                else
+                {
+                    encoder.string_value("273.15", semantic_tag::bigdec);
+                }
+                break;
+            case 5:
+                encoder.null_value();
+                break;
+            case 6:
+            {
+                std::vector<uint16_t> v(gen() % 5, 3);
+                if (indefinite_parent)
+                {
+                    encoder.typed_array(jsoncons::span<const uint16_t>(v));
+                }
+                else
+                {
+                    encoder.bool_value(true);
+                }
+                break;
+            }
+            case 7:
+            case 8:
+            {
+                std::size_t n = gen() % 30;
+                bool indefinite = gen() % 2 == 0;
+                indefinite ? encoder.begin_array() : encoder.begin_array(n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    random_cbor_value(gen, depth - 1, encoder, indefinite);
+                }
+                encoder.end_array();
+                break;
+            }
+            default:
+            {
+                std::size_t n = gen() % 30;
+                bool indefinite = gen() % 2 == 0;
+                indefinite ? encoder.begin_object() : encoder.begin_object(n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    encoder.key(std::string(gen() % 3, 'k') + std::to_string(i));
+                    random_cbor_value(gen, depth - 1, encoder, indefinite);
+                }
+                encoder.end_object();
+                break;
+            }
+        }
+    }
+
+    std::string cbor_event_string(const staj_cursor& cursor)
+    {
+        std::string s = std::to_string(static_cast<int>(cursor.current().event_type()));
+        s.push_back(' ');
+        s.append(std::to_string(static_cast<int>(cursor.current().tag())));
+        switch (cursor.current().event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+                s.push_back(':');
+                s.append(cursor.current().get<std::string>());
+                break;
+            default:
+                break;
+        }
+        s.push_back('@');
+        s.append(std::to_string(cursor.context().column()));
+        return s;
+    }
+}
+
+TEST_CASE("cbor_cursor skip tests")
+{
+    SECTION("skip indefinite length containers and chunked strings")
+    {
+        // [_ {_ "a": (_ "b", "c"), "d": [1, 2]}, [_ ], "e"]
+        std::vector<uint8_t> data = {0x9f,0xbf,0x61,0x61,0x7f,0x61,0x62,0x61,0x63,0xff,0x61,0x64,0x82,0x01,0x02,0xff,
+                                     0x9f,0xff,0x61,0x65,0xff};
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "e");
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("truncated input")
+    {
+        std::vector<uint8_t> data = {0x9f,0x82,0x61,0x61,0x7f,0x61,0x62};
+        cbor::cbor_bytes_cursor cursor(data);
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+    }
+
+    SECTION("same events and positions as skipping event by event")
+    {
+        std::mt19937 gen(2020);
+        for (int i = 0; i < 200; ++i)
+        {
+            cbor::cbor_options options;
+            options.pack_strings(i % 4 == 0)
+                   .use_typed_arrays(i % 2 == 0);
+            std::vector<uint8_t> data;
+            cbor::cbor_bytes_encoder encoder(data, options);
+            random_cbor_value(gen, 4, encoder);
+            encoder.flush();
+
+            cbor::cbor_bytes_cursor cursor1(data);
+            cbor::cbor_bytes_cursor cursor2(data);
+            std::mt19937 choice(i);
+            while (!cursor1.done() && !cursor2.done())
+            {
+                REQUIRE(cbor_event_string(cursor1) == cbor_event_string(cursor2));
+                if (choice() % 3 == 0)
+                {
+                    cursor1.skip();
+                    std::error_code ec;
+                    cursor2.staj_cursor::skip(ec); // event by event
+                    REQUIRE_FALSE(ec);
+                    REQUIRE(cbor_event_string(cursor1) == cbor_event_string(cursor2));
+                }
+                cursor1.next();
+                cursor2.next();
+            }
+            CHECK(cursor1.done());
+            CHECK(cursor2.done());
+        }
+    }
+}
+
+namespace {
+
+    std::string cbor_event_string(const staj_event& event)
+    {
+        std::string s = std::to_string(static_cast<int>(event.event_type()));
+        s.push_back(' ');
+        s.append(std::to_string(static_cast<int>(event.tag())));
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::bool_value:
+                s.push_back(':');
+                s.append(event.get<std::string>());
+                break;
+            case staj_event_type::half_value:
+            case staj_event_type::double_value:
+                s.push_back(':');
+                s.append(std::to_string(event.get<double>()));
+                break;
+            case staj_event_type::byte_string_value:
+                s.push_back(':');
+                s.append(std::to_string(event.get<byte_string_view>().size()));
+                s.push_back(' ');
+                s.append(std::to_string(event.ext_tag()));
+                break;
+            default:
+                break;
+        }
+        return s;
+    }
+
+    std::vector<std::string> events_by_next(const std::vector<uint8_t>& data)
+    {
+        std::vector<std::string> events;
+        cbor::cbor_bytes_cursor cursor(data);
+        for (; !cursor.done(); cursor.next())
+        {
+            events.push_back(cbor_event_string(cursor.current()));
+        }
+        return events;
+    }
+
+    std::vector<std::string> events_by_batch(const std::vector<uint8_t>& data, std::size_t capacity)
+    {
+        std::vector<std::string> events;
+        cbor::cbor_bytes_cursor cursor(data);
+        staj_event_batch batch(capacity);
+        while (!cursor.done())
+        {
+            cursor.read_batch(batch);
+            REQUIRE(batch.size() > 0);
+            REQUIRE(batch.size() <= capacity);
+            for (std::size_t i = 0; i < batch.size(); ++i)
+            {
+                events.push_back(cbor_event_string(batch.event(i)));
+            }
+        }
+        return events;
+    }
+}
+
+TEST_CASE("cbor_cursor read_batch tests")
+{
+    SECTION("typed array")
+    {
+        std::vector<uint8_t> data;
+        cbor::cbor_options options;
+        options.use_typed_arrays(true);
+        cbor::cbor_bytes_encoder encoder(data, options);
+        std::vector<double> v = {1.5, 2.5, 3.5};
+        encoder.begin_array();
+        encoder.typed_array(jsoncons::span<const double>(v));
+        encoder.byte_string_value(std::vector<uint8_t>{1,2,3}, 42);
+        encoder.end_array();
+        encoder.flush();
+
+        cbor::cbor_bytes_cursor cursor(data);
+        staj_event_batch batch(100);
+        cursor.read_batch(batch);
+        REQUIRE(batch.size() == 8);
+        CHECK(batch[1].event_type() == staj_event_type::begin_array);
+        CHECK(batch[2].double_value() == 1.5);
+        CHECK(batch[4].double_value() == 3.5);
+        CHECK(batch[5].event_type() == staj_event_type::end_array);
+        CHECK(batch[6].ext_tag() == 42);
+        CHECK(batch.byte_string_value(batch[6]) == byte_string_view(std::vector<uint8_t>{1,2,3}));
+        CHECK(cursor.done());
+
+        for (std::size_t capacity : {1, 2, 3, 5})
+        {
+            CHECK(events_by_batch(data, capacity) == events_by_next(data));
+        }
+    }
+
+    SECTION("multi-dimensional array")
+    {
+        std::vector<uint8_t> data;
+        cbor::cbor_bytes_encoder encoder(data);
+        std::vector<size_t> shape = {2,3};
+        encoder.begin_multi_dim(shape, semantic_tag::multi_dim_row_major);
+        encoder.begin_array(6);
+        for (int i = 0; i < 6; ++i)
+        {
+            encoder.uint64_value(i);
+        }
+        encoder.end_array();
+        encoder.end_multi_dim();
+        encoder.flush();
+
+        auto expected = events_by_next(data);
+        for (std::size_t capacity : {1, 2, 3, 4, 100})
+        {
+            CHECK(events_by_batch(data, capacity) == expected);
+        }
+    }
+
+    SECTION("truncated input")
+    {
+        std::vector<uint8_t> data = {0x9f,0x82,0x61,0x61,0x7f,0x61,0x62};
+        cbor::cbor_bytes_cursor cursor(data);
+        staj_event_batch batch(10);
+        std::error_code ec;
+        cursor.read_batch(batch, ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+        CHECK(batch.size() == 3);
+    }
+
+    SECTION("same events as next()")
+    {
+        std::mt19937 gen(2021);
+        for (int i = 0; i < 200; ++i)
+        {
+            cbor::cbor_options options;
+            options.pack_strings(i % 4 == 0)
+                   .use_typed_arrays(i % 2 == 0);
+            std::vector<uint8_t> data;
+            cbor::cbor_bytes_encoder encoder(data, options);
+            random_cbor_value(gen, 4, encoder);
+            encoder.flush();
+
+            auto expected = events_by_next(data);
+            for (std::size_t capacity : {1, 2, 3, 17, 1000})
+            {
+                CHECK(events_by_batch(data, capacity) == expected);
+            }
+        }
+    }
+}
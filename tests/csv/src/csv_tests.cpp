@@ -1558,3 +1558,21 @@ TEST_CASE("infinite loop")
         CHECK(ec == csv::csv_errc::unexpected_char_between_fields); //-V521
     }
 }
+
+TEST_CASE("csv numbers with exponents")
+{
+    std::string input = "1e5,2.5e-3,1E+2,-0.5,0.1,9007199254740993.000000000000001\n";
+
+    csv::csv_options options;
+    options.assume_header(false);
+    json j = csv::decode_csv<json>(input, options);
+
+    REQUIRE(j.size() == 1);
+    REQUIRE(j[0].size() == 6);
+    CHECK(j[0][0].as<double>() == 100000.0);
+    CHECK(j[0][1].as<double>() == 0.0025);
+    CHECK(j[0][2].as<double>() == 100.0);
+    CHECK(j[0][3].as<double>() == -0.5);
+    CHECK(j[0][4].as<double>() == 0.1);
+    CHECK(j[0][5].as<double>() == 9007199254740994.0);
+}
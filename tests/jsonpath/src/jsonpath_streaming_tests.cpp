@@ -0,0 +1,221 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/jsonpath/jsonpath.hpp>
+#include <jsoncons_ext/jsonpath/streaming_expression.hpp>
+#include <catch/catch.hpp>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string store = R"(
+{ "store": {
+    "book": [
+      { "category": "reference",
+        "author": "Nigel Rees",
+        "title": "Sayings of the Century",
+        "price": 8.95
+      },
+      { "category": "fiction",
+        "author": "Evelyn Waugh",
+        "title": "Sword of Honour",
+        "price": 12.99
+      },
+      { "category": "fiction",
+        "author": "Herman Melville",
+        "title": "Moby Dick",
+        "isbn": "0-553-21311-3",
+        "price": 8.99
+      }
+    ],
+    "bicycle": {
+      "color": "red",
+      "price": 19.95
+    }
+  }
+}
+    )";
+
+    std::vector<std::pair<std::string,json>> stream_query(const std::string& input, const std::string& path)
+    {
+        std::vector<std::pair<std::string,json>> results;
+        auto expr = jsonpath::make_streaming_expression<json>(path);
+        json_cursor cursor(input);
+        expr.evaluate(cursor, [&](const std::string& p, const json& val) {results.emplace_back(p, val);});
+        return results;
+    }
+
+    // DOM results, without duplicates, by path (the DOM evaluator reports the root path as "")
+    std::map<std::string,json> dom_query(const json& doc, const std::string& path)
+    {
+        std::map<std::string,json> results;
+        jsonpath::json_query(doc, path, [&](const std::string& p, const json& val) {results.emplace(p.empty() ? "$" : p, val);},
+                             jsonpath::result_options::path);
+        return results;
+    }
+
+    json random_value(std::mt19937& gen, int depth)
+    {
+        std::uniform_int_distribution<int> kind(0, depth > 0 ? 6 : 3);
+        switch (kind(gen))
+        {
+            case 0:
+                return json(static_cast<int64_t>(gen() % 100));
+            case 1:
+                return json(std::string(gen() % 4, 'x'));
+            case 2:
+                return json::null();
+            case 3:
+                return json(gen() % 2 == 0);
+            case 4:
+            {
+                json a(json_array_arg);
+                std::size_t n = gen() % 5;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    a.push_back(random_value(gen, depth - 1));
+                }
+                return a;
+            }
+            default:
+            {
+                const char* names[] = {"a", "b", "c", "length", "0"};
+                json o(json_object_arg);
+                std::size_t n = gen() % 4;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    o.insert_or_assign(names[gen() % 5], random_value(gen, depth - 1));
+                }
+                return o;
+            }
+        }
+    }
+}
+
+TEST_CASE("jsonpath streaming_expression tests")
+{
+    SECTION("names and wildcards")
+    {
+        auto results = stream_query(store, "$.store.book[*].author");
+        REQUIRE(results.size() == 3);
+        CHECK(results[0].first == "$['store']['book'][0]['author']");
+        CHECK(results[0].second == json("Nigel Rees"));
+        CHECK(results[2].second == json("Herman Melville"));
+    }
+
+    SECTION("recursive descent")
+    {
+        auto results = stream_query(store, "$..price");
+        REQUIRE(results.size() == 4);
+        CHECK(results[0].first == "$['store']['book'][0]['price']");
+        CHECK(results[3].first == "$['store']['bicycle']['price']");
+        CHECK(results[3].second == json(19.95));
+    }
+
+    SECTION("containers are reported in document order")
+    {
+        auto results = stream_query(R"({"a":{"a":{"a":1}}})", "$..a");
+        REQUIRE(results.size() == 3);
+        CHECK(results[0].first == "$['a']");
+        CHECK(results[0].second == json::parse(R"({"a":{"a":1}})"));
+        CHECK(results[1].first == "$['a']['a']");
+        CHECK(results[2].first == "$['a']['a']['a']");
+        CHECK(results[2].second == json(1));
+    }
+
+    SECTION("slices, unions and length")
+    {
+        auto results = stream_query(store, "$.store.book[0:3:2]['title','price']");
+        REQUIRE(results.size() == 4);
+        CHECK(results[0].second == json("Sayings of the Century"));
+        CHECK(results[3].second == json(8.99));
+
+        results = stream_query(store, "$.store.book.length");
+        REQUIRE(results.size() == 1);
+        CHECK(results[0].first == "$['store']['book']['length']");
+        CHECK(results[0].second == json(3));
+    }
+
+    SECTION("root")
+    {
+        auto results = stream_query("[1,2]", "$");
+        REQUIRE(results.size() == 1);
+        CHECK(results[0].first == "$");
+        CHECK(results[0].second == json::parse("[1,2]"));
+    }
+
+    SECTION("expressions that need the DOM evaluator")
+    {
+        const char* paths[] = {"$.store.book[?(@.price < 10)]", "$.store.book[-1]", "$.store.book[-2:]",
+                               "$.store.book[::-1]", "$.store.book[(@.length-1)]", "max($..price)", "$['-1']"};
+        for (auto path : paths)
+        {
+            std::error_code ec;
+            jsonpath::make_streaming_expression<json>(path, ec);
+            CHECK(ec == jsonpath::jsonpath_errc::requires_dom_evaluator);
+        }
+        REQUIRE_THROWS_AS(jsonpath::make_streaming_expression<json>("$.store.book[?(@.price < 10)]"), jsonpath::jsonpath_error);
+    }
+
+    SECTION("invalid expressions")
+    {
+        const char* paths[] = {"$.store.book[", "$.store.book[0:1:0]", "$['a"};
+        for (auto path : paths)
+        {
+            std::error_code ec;
+            jsonpath::make_streaming_expression<json>(path, ec);
+            CHECK(ec);
+            CHECK(ec != jsonpath::jsonpath_errc::requires_dom_evaluator);
+        }
+    }
+
+    SECTION("parse errors are reported")
+    {
+        auto expr = jsonpath::make_streaming_expression<json>("$.a");
+        json_cursor cursor(R"({"a":1,"b":[1,2)");
+        std::vector<json> values;
+        std::error_code ec;
+        expr.evaluate(cursor, [&](const std::string&, const json& val) {values.push_back(val);}, ec);
+        CHECK(ec);
+        REQUIRE(values.size() == 1);
+        CHECK(values[0] == json(1));
+    }
+
+    SECTION("same results as the DOM evaluator")
+    {
+        const char* paths[] = {"$", "$.a", "$.b.c", "$[0]", "$.*", "$[*]", "$..a", "$..*", "$..[0]", "$..[1:]",
+                               "$.a[::2]", "$..['a','c']", "$..[0,2]", "$.a..b", "$..a..c", "$..length", "$.a.length",
+                               "$..a.0", "$..['0']", "$[*].*", "$..*.length", "$..[0:2][*]"};
+
+        std::mt19937 gen(2021);
+        for (int i = 0; i < 300; ++i)
+        {
+            json doc = random_value(gen, 4);
+            std::string input;
+            doc.dump(input);
+            for (auto path : paths)
+            {
+                auto streamed = stream_query(input, path);
+                auto expected = dom_query(doc, path);
+
+                std::map<std::string,json> actual;
+                for (auto& r : streamed)
+                {
+                    CHECK(actual.emplace(r.first, r.second).second); // each value reported once
+                }
+                CHECK(actual == expected);
+                if (actual != expected)
+                {
+                    std::cout << path << " " << input << "\n";
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/arena_allocator.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("arena tests")
+{
+    SECTION("allocations are aligned and come from few blocks")
+    {
+        arena a(64);
+        for (std::size_t i = 1; i <= 1000; ++i)
+        {
+            void* p = a.allocate(i % 13 + 1, alignof(double));
+            CHECK(reinterpret_cast<std::uintptr_t>(p) % alignof(double) == 0);
+        }
+        CHECK(a.block_count() < 10);
+        a.release();
+        CHECK(a.block_count() == 0);
+        CHECK(a.bytes_reserved() == 0);
+    }
+
+    SECTION("allocation larger than a block")
+    {
+        arena a(64);
+        void* p = a.allocate(10000, 8);
+        CHECK(p != nullptr);
+        CHECK(a.block_count() == 1);
+        CHECK(a.bytes_reserved() >= 10000);
+    }
+
+    SECTION("deallocating the last allocation reclaims it")
+    {
+        arena a;
+        void* p = a.allocate(100, 8);
+        a.deallocate(p, 100);
+        CHECK(a.allocate(100, 8) == p);
+    }
+}
+
+TEST_CASE("arena_allocator tests")
+{
+    arena_allocator<char> a1;
+    arena_allocator<char> a2(a1);
+    arena_allocator<double> a3(a1);
+    arena_allocator<char> b;
+
+    CHECK(a1 == a2);
+    CHECK(a1 == a3);
+    CHECK(a1 != b);
+
+    std::vector<double,arena_allocator<double>> v(a3);
+    for (int i = 0; i < 1000; ++i)
+    {
+        v.push_back(i);
+    }
+    CHECK(v[999] == 999);
+    CHECK(&v.get_allocator().resource() == &a1.resource());
+    CHECK(a1.resource().block_count() > 0);
+}
+
+TEST_CASE("arena_json tests")
+{
+    std::string input = R"(
+{
+    "books" : [
+        {"title" : "Pulp", "author" : "Charles Bukowski", "price" : 22.48, "tags" : ["fiction", "a rather long tag string"]},
+        {"title" : "Cutter and Bone", "author" : "Newton Thornburg", "price" : 15.0},
+        {"title" : "The Night Watchman", "author" : "Louise Erdrich", "price" : 32.0}
+    ],
+    "a key that is too long for a short string" : {"bytes" : null, "n" : -1}
+}
+    )";
+    json expected = json::parse(input);
+
+    SECTION("json_decoder with result allocator")
+    {
+        arena_allocator<char> alloc;
+        json_decoder<arena_json> decoder(result_allocator_arg, alloc);
+        json_reader reader(input, decoder);
+        reader.read();
+        arena_json j = decoder.get_result();
+
+        CHECK(j.get_allocator() == alloc);
+        CHECK(j["books"].get_allocator() == alloc);
+        CHECK(j["books"][0]["author"].get_allocator() == alloc);
+        CHECK(alloc.resource().block_count() > 0);
+
+        CHECK(j.size() == expected.size());
+        CHECK(j["books"].size() == 3);
+        CHECK(j["books"][0]["author"].as<std::string>() == "Charles Bukowski");
+        CHECK(j["books"][0]["price"].as<double>() == 22.48);
+        CHECK(j["a key that is too long for a short string"]["n"].as<int>() == -1);
+        CHECK(j.to_string() == expected.to_string());
+    }
+
+    SECTION("parse")
+    {
+        arena_json j = arena_json::parse(input);
+        CHECK(j.to_string() == expected.to_string());
+
+        arena_ojson o = arena_ojson::parse(input);
+        CHECK(o["books"][1]["title"].as<std::string>() == "Cutter and Bone");
+    }
+
+    SECTION("values from different arenas")
+    {
+        arena_json j = arena_json::parse(input);
+        j["more"] = arena_json::parse(R"(["one more string that is not short"])");
+        j["books"].erase(j["books"].array_range().begin());
+        CHECK(j["more"][0].as<std::string>() == "one more string that is not short");
+        CHECK(j["books"].size() == 2);
+
+        arena_json copy = j;
+        CHECK(copy == j);
+    }
+
+    SECTION("threads reading the same document")
+    {
+        arena_json j = arena_json::parse(input);
+        const arena_json& cj = j;
+
+        std::vector<std::thread> threads;
+        std::vector<std::size_t> counts(4, 0);
+        for (std::size_t i = 0; i < counts.size(); ++i)
+        {
+            threads.emplace_back([&cj,&counts,i]()
+            {
+                for (int k = 0; k < 10000; ++k)
+                {
+                    auto alloc = cj.get_allocator();
+                    auto copy = alloc;
+                    if (&copy.resource() == &cj["books"].get_allocator().resource())
+                    {
+                        ++counts[i];
+                    }
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        for (auto count : counts)
+        {
+            CHECK(count == 10000);
+        }
+        CHECK(j["books"][1]["title"].as<std::string>() == "Cutter and Bone");
+    }
+}
@@ -9,6 +9,41 @@
 
 using namespace jsoncons;
 
+namespace decode_traits_tests {
+
+    struct reading
+    {
+        std::string sensor;
+        int64_t timestamp;
+        std::vector<double> values;
+        std::string unit;
+    };
+
+    class position
+    {
+        double x_;
+        double y_;
+    public:
+        position(double x, double y)
+            : x_(x), y_(y)
+        {
+        }
+        double x() const {return x_;}
+        double y() const {return y_;}
+    };
+
+    struct track
+    {
+        std::string id;
+        std::vector<position> path;
+    };
+
+} // namespace decode_traits_tests
+
+JSONCONS_N_MEMBER_TRAITS(decode_traits_tests::reading,2,sensor,timestamp,values,unit)
+JSONCONS_ALL_CTOR_GETTER_TRAITS(decode_traits_tests::position,x,y)
+JSONCONS_ALL_MEMBER_NAME_TRAITS(decode_traits_tests::track,(id,"track-id"),(path,"path"))
+
 TEST_CASE("decode_traits primitive")
 {
     SECTION("is_primitive")
@@ -149,3 +184,140 @@ TEST_CASE("decode_traits deserialization errors")
         CHECK(ec == json_errc::expected_comma_or_right_brace);
     }
 }
+
+TEST_CASE("decode_traits json_traits_macros")
+{
+    SECTION("members read from cursor, unknown members skipped")
+    {
+        std::string input = R"(
+{
+    "unit" : "C", "extra" : {"a" : [1,{"b":2}]},
+    "values" : [20.5,21.0], "timestamp" : 1600000000, "sensor" : "s1"
+}
+        )";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        auto val = decode_traits<decode_traits_tests::reading,char>::decode(cursor,decoder,ec);
+        REQUIRE_FALSE(ec);
+
+        CHECK(val.sensor == "s1");
+        CHECK(val.timestamp == 1600000000);
+        REQUIRE(val.values.size() == 2);
+        CHECK(val.values[1] == 21.0);
+        CHECK(val.unit == "C");
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+    }
+    SECTION("optional members")
+    {
+        std::string input = R"({"sensor" : "s2", "timestamp" : 1})";
+
+        auto val = decode_json<decode_traits_tests::reading>(input);
+
+        CHECK(val.sensor == "s2");
+        CHECK(val.values.empty());
+        CHECK(val.unit.empty());
+    }
+    SECTION("ctor getter and name members")
+    {
+        std::string input = R"({"path" : [{"y" : 2.5, "x" : 1.5},{"x" : 3.0, "y" : 4.0}], "track-id" : "t1"})";
+
+        auto val = decode_json<decode_traits_tests::track>(input);
+
+        CHECK(val.id == "t1");
+        REQUIRE(val.path.size() == 2);
+        CHECK(val.path[0].x() == 1.5);
+        CHECK(val.path[0].y() == 2.5);
+        CHECK(val.path[1].y() == 4.0);
+    }
+    SECTION("missing mandatory member")
+    {
+        std::string input = R"([{"sensor" : "s1", "values" : [1.0,2.0]},{"sensor" : "s2", "timestamp" : 2}])";
+
+        json_cursor cursor(input);
+        auto view = staj_array<decode_traits_tests::reading>(cursor);
+        auto it = view.begin();
+
+        REQUIRE_FALSE(it.has_value());
+        CHECK_THROWS_AS(*it, conv_error);
+        ++it;
+        REQUIRE((it != view.end()));
+        REQUIRE(it.has_value());
+        CHECK(it->sensor == "s2");
+        ++it;
+        CHECK((it == view.end()));
+    }
+    SECTION("not an object")
+    {
+        std::string input = R"(["1,2",{"x" : 1.0, "y" : 2.0}])";
+
+        json_cursor cursor(input);
+        auto view = staj_array<decode_traits_tests::position>(cursor);
+        auto it = view.begin();
+
+        REQUIRE_FALSE(it.has_value());
+        ++it;
+        REQUIRE((it != view.end()));
+        REQUIRE(it.has_value());
+        CHECK(it->y() == 2.0);
+    }
+}
+
+namespace {
+
+    template <class T>
+    std::string conversion_error_of(const std::string& input, bool use_decode_json)
+    {
+        try
+        {
+            if (use_decode_json)
+            {
+                decode_json<T>(input);
+            }
+            else
+            {
+                json::parse(input).as<T>();
+            }
+        }
+        catch (const std::exception& e)
+        {
+            return e.what();
+        }
+        return std::string();
+    }
+
+} // namespace
+
+TEST_CASE("decode_traits json_traits_macros agree with as<T>")
+{
+    SECTION("invalid nested object reports the nested type")
+    {
+        std::string input = R"({"path" : [{"x" : 1.5}], "track-id" : "t1"})";
+
+        std::string expected = conversion_error_of<decode_traits_tests::track>(input, false);
+        CHECK(expected.find("position") != std::string::npos);
+        CHECK(conversion_error_of<decode_traits_tests::track>(input, true) == expected);
+    }
+    SECTION("element of the wrong type")
+    {
+        std::string input = R"({"sensor" : "s1", "timestamp" : 1, "values" : [1.0,"a"]})";
+
+        CHECK_THROWS_AS(json::parse(input).as<decode_traits_tests::reading>(), json_runtime_error<std::invalid_argument>);
+        CHECK_THROWS_AS(decode_json<decode_traits_tests::reading>(input), json_runtime_error<std::invalid_argument>);
+        CHECK(conversion_error_of<decode_traits_tests::reading>(input, true) ==
+              conversion_error_of<decode_traits_tests::reading>(input, false));
+    }
+    SECTION("first of duplicate keys wins")
+    {
+        std::string input = R"({"sensor" : "s1", "timestamp" : 1, "sensor" : "s2", "timestamp" : 2})";
+
+        auto expected = json::parse(input).as<decode_traits_tests::reading>();
+        auto val = decode_json<decode_traits_tests::reading>(input);
+
+        CHECK(expected.sensor == "s1");
+        CHECK(val.sensor == expected.sensor);
+        CHECK(val.timestamp == expected.timestamp);
+    }
+}
@@ -0,0 +1,124 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_structural_parser.hpp>
+#include <jsoncons/detail/eisel_lemire.hpp>
+#include <catch/catch.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    bool same_bits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    void check_against_strtod(const std::string& s)
+    {
+        double expected = std::strtod(s.c_str(), nullptr);
+        double d;
+        if (jsoncons::detail::decimal_to_double(s.c_str(), s.length(), '.', d))
+        {
+            INFO(s);
+            CHECK(same_bits(d, expected));
+        }
+        jsoncons::detail::to_double_t to_double;
+        INFO(s);
+        CHECK(same_bits(to_double(s.c_str(), s.length()), expected));
+    }
+}
+
+TEST_CASE("detail::eisel_lemire edge cases")
+{
+    const std::vector<std::string> inputs = {
+        "0", "-0", "0.0", "-0.0", "0e999", "1", "-1", "0.1", "0.3", "1e23", "8.98846567431158e307",
+        "2.2250738585072011e-308", "2.2250738585072014e-308", // largest subnormal, smallest normal
+        "4.9406564584124654e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308",
+        "1e-400", "1e400", "-1e400", "9007199254740993", "9007199254740993.000000000000001",
+        "123456789012345678901234567890", "0.000000000000000000000000000000000000000000001e300",
+        "7.0420557077594588669468784357561207962098443483187940792729600000e+59",
+        "1.00000000000000011102230246251565404236316680908203125", // halfway, round to even
+        "1.00000000000000011102230246251565404236316680908203124",
+        "1.00000000000000011102230246251565404236316680908203126"
+    };
+    for (const auto& s : inputs)
+    {
+        check_against_strtod(s);
+    }
+}
+
+TEST_CASE("detail::eisel_lemire random values")
+{
+    std::mt19937_64 gen(20200101);
+    char buffer[64];
+
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        uint64_t bits = gen();
+        double d;
+        std::memcpy(&d, &bits, sizeof(double));
+        if (d != d || d - d != 0) // nan or infinity
+        {
+            continue;
+        }
+        std::snprintf(buffer, sizeof(buffer), "%.17g", d);
+        check_against_strtod(buffer);
+        std::snprintf(buffer, sizeof(buffer), "%.*g", static_cast<int>(gen() % 17) + 1, d);
+        check_against_strtod(buffer);
+    }
+
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        std::string s;
+        std::size_t digits = gen() % 30 + 1;
+        for (std::size_t j = 0; j < digits; ++j)
+        {
+            s.push_back(static_cast<char>('0' + gen() % 10));
+        }
+        s.insert(gen() % s.length(), "0.");
+        s.append("e" + std::to_string(static_cast<int>(gen() % 700) - 350));
+        check_against_strtod(s);
+    }
+}
+
+TEST_CASE("detail::decimal_to_double rejects other forms")
+{
+    const std::vector<std::string> inputs = {"", "-", ".", "e5", "1e", "1e+", "1.5x", "0x10", "inf", "nan", " 1"};
+    for (const auto& s : inputs)
+    {
+        double d;
+        CHECK_FALSE(jsoncons::detail::decimal_to_double(s.c_str(), s.length(), '.', d));
+    }
+}
+
+TEST_CASE("parsers use accumulated digits")
+{
+    const std::vector<std::string> inputs = {
+        "0.1", "-0.0", "1e-400", "2.2250738585072011e-308", "1.7976931348623159e308",
+        "9007199254740993.000000000000001", "1.00000000000000011102230246251565404236316680908203125",
+        "123456789012345678901234567890e-10"
+    };
+    for (const auto& s : inputs)
+    {
+        double expected = std::strtod(s.c_str(), nullptr);
+        std::string text = "[" + s + "]";
+
+        json j1 = json::parse(text);
+        CHECK(same_bits(j1[0].as<double>(), expected));
+
+        json_decoder<json> decoder;
+        json_structural_reader reader(text, decoder);
+        reader.read();
+        json j2 = decoder.get_result();
+        CHECK(same_bits(j2[0].as<double>(), expected));
+    }
+}
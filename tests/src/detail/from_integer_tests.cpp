@@ -0,0 +1,98 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+
+using namespace jsoncons;
+
+TEST_CASE("detail::count_digits tests")
+{
+    CHECK(jsoncons::detail::count_digits(0) == 1);
+    CHECK(jsoncons::detail::count_digits((std::numeric_limits<uint64_t>::max)()) == 20);
+
+    uint64_t power = 1;
+    for (int n = 1; n <= 19; ++n)
+    {
+        CHECK(jsoncons::detail::count_digits(power) == n);
+        CHECK(jsoncons::detail::count_digits(power*10 - 1) == n);
+        power *= 10;
+    }
+    CHECK(jsoncons::detail::count_digits(power) == 20);
+}
+
+template <class Integer>
+static std::string reference_string(Integer val)
+{
+    std::ostringstream os;
+    os << val;
+    return os.str();
+}
+
+TEST_CASE("detail::from_integer tests")
+{
+    SECTION("limits")
+    {
+        std::string s;
+        std::size_t length = jsoncons::detail::from_integer((std::numeric_limits<int64_t>::min)(), s);
+        CHECK(s == std::string("-9223372036854775808"));
+        CHECK(length == s.size());
+
+        s.clear();
+        jsoncons::detail::from_integer((std::numeric_limits<int64_t>::max)(), s);
+        CHECK(s == std::string("9223372036854775807"));
+
+        s.clear();
+        jsoncons::detail::from_integer((std::numeric_limits<uint64_t>::max)(), s);
+        CHECK(s == std::string("18446744073709551615"));
+
+        s.clear();
+        jsoncons::detail::from_integer((std::numeric_limits<int8_t>::min)(), s);
+        CHECK(s == std::string("-128"));
+
+        s.clear();
+        jsoncons::detail::from_integer(0, s);
+        CHECK(s == std::string("0"));
+    }
+
+    SECTION("digit count boundaries")
+    {
+        uint64_t power = 1;
+        for (int n = 0; n <= 19; ++n)
+        {
+            const uint64_t values[] = {power - 1, power, power + 1};
+            for (uint64_t val : values)
+            {
+                std::string s;
+                jsoncons::detail::from_integer(val, s);
+                CHECK(s == reference_string(val));
+
+                int64_t signed_val = -static_cast<int64_t>(val & 0x7fffffffffffffffULL);
+                s.clear();
+                jsoncons::detail::from_integer(signed_val, s);
+                CHECK(s == reference_string(signed_val));
+            }
+            power *= 10;
+        }
+    }
+
+    SECTION("wide characters")
+    {
+        std::wstring s;
+        std::size_t length = jsoncons::detail::from_integer(-1234567, s);
+        CHECK(s == std::wstring(L"-1234567"));
+        CHECK(length == 8);
+    }
+
+    SECTION("appends")
+    {
+        std::string s = "[";
+        jsoncons::string_sink<std::string> sink(s);
+        jsoncons::detail::from_integer(42, sink);
+        sink.push_back(',');
+        jsoncons::detail::from_integer(-7, sink);
+        CHECK(s == std::string("[42,-7"));
+    }
+}
@@ -0,0 +1,175 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+TEST_CASE("detail::find_string_delimiter tests")
+{
+    SECTION("delimiter at every offset")
+    {
+        const char delimiters[] = {'\"', '\\', '\0', '\x01', '\n', '\x1f'};
+        for (char d : delimiters)
+        {
+            for (std::size_t i = 0; i < 100; ++i)
+            {
+                std::string s(100, 'a');
+                s[i] = d;
+                const char* p = jsoncons::detail::find_string_delimiter(s.data(), s.data() + s.size());
+                CHECK(p == s.data() + i);
+            }
+        }
+    }
+    SECTION("no delimiter")
+    {
+        std::string s(100, 'a');
+        s[50] = '\x20';
+        s[51] = '\x7f';
+        s[52] = '\xc3';
+        s[53] = '\xa9';
+        const char* p = jsoncons::detail::find_string_delimiter(s.data(), s.data() + s.size());
+        CHECK(p == s.data() + s.size());
+    }
+    SECTION("wide characters")
+    {
+        std::wstring s(40, L'a');
+        s[33] = L'\\';
+        const wchar_t* p = jsoncons::detail::find_string_delimiter(s.data(), s.data() + s.size());
+        CHECK(p == s.data() + 33);
+    }
+}
+
+TEST_CASE("detail::skip_blanks tests")
+{
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        std::string s(i, ' ');
+        for (std::size_t j = 0; j < i; j += 3)
+        {
+            s[j] = '\t';
+        }
+        s.append("\n   ");
+        const char* p = jsoncons::detail::skip_blanks(s.data(), s.data() + s.size());
+        CHECK(p == s.data() + i);
+    }
+}
+
+TEST_CASE("detail::skip_ascii tests")
+{
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        std::string s(100, 'a');
+        s[i] = '\x80';
+        const char* p = jsoncons::detail::skip_ascii(s.data(), s.data() + s.size());
+        CHECK(p == s.data() + i);
+    }
+}
+
+TEST_CASE("parse long strings and indentation")
+{
+    SECTION("long string with escapes")
+    {
+        std::string value(200, 'x');
+        value[70] = '\"';
+        value[150] = '\\';
+        value[190] = '\n';
+        std::string input = "[" + std::string(100, ' ') + "\"" + std::string(70, 'x') + "\\\"" + std::string(79, 'x') + "\\\\" 
+                            + std::string(39, 'x') + "\\n" + std::string(9, 'x') + "\"" + std::string(100, '\t') + "]";
+        json j = json::parse(input);
+        REQUIRE(j.size() == 1);
+        CHECK(j[0].as<std::string>() == value);
+    }
+    SECTION("illegal control character in long string")
+    {
+        std::string input = "\"" + std::string(100, 'x') + "\x01" + "\"";
+        std::error_code ec;
+        json_decoder<json> decoder;
+        json_reader reader(input, decoder);
+        reader.read(ec);
+        CHECK(ec == json_errc::illegal_control_character);
+        CHECK(reader.column() == 103);
+    }
+    SECTION("invalid utf8 after long ascii run")
+    {
+        std::string input = "\"" + std::string(100, 'x') + "\xff" + "\"";
+        std::error_code ec;
+        json_decoder<json> decoder;
+        json_reader reader(input, decoder);
+        reader.read(ec);
+        CHECK(ec);
+    }
+}
+
+TEST_CASE("detail::structural_indexer tests")
+{
+    // Offsets found by a sequential scan of the same input
+    std::string s = R"({"a\\":[1, -2.5e3 ,"x\"y"],"b" : {"c":true},  "\\\"]" : null,"d":"{[:,]}"})";
+    s.append(s);
+    s.append(2*64 - s.size() % 64, ' ');
+
+    std::vector<std::size_t> expected;
+    bool in_string = false;
+    bool in_scalar = false;
+    for (std::size_t i = 0; i < s.size(); ++i)
+    {
+        char c = s[i];
+        if (in_string)
+        {
+            if (c == '\\')
+            {
+                ++i;
+            }
+            else if (c == '\"')
+            {
+                in_string = false;
+            }
+            continue;
+        }
+        switch (c)
+        {
+            case '\"':
+                expected.push_back(i);
+                in_string = true;
+                in_scalar = false;
+                break;
+            case '{':case '}':case '[':case ']':case ':':case ',':case '/':
+                expected.push_back(i);
+                in_scalar = false;
+                break;
+            case ' ':case '\t':case '\n':case '\r':
+                in_scalar = false;
+                break;
+            default:
+                if (!in_scalar)
+                {
+                    expected.push_back(i);
+                    in_scalar = true;
+                }
+                break;
+        }
+    }
+
+    std::vector<std::size_t> offsets(s.size());
+    std::size_t count = 0;
+    jsoncons::detail::structural_indexer indexer;
+    for (std::size_t i = 0; i < s.size(); i += 64)
+    {
+        count += indexer.index_block(s.data() + i, i, offsets.data() + count);
+    }
+    offsets.resize(count);
+    CHECK(offsets == expected);
+
+    std::wstring ws(s.begin(), s.end());
+    count = 0;
+    indexer.reset();
+    offsets.resize(s.size());
+    for (std::size_t i = 0; i < ws.size(); i += 64)
+    {
+        count += indexer.index_block(ws.data() + i, i, offsets.data() + count);
+    }
+    offsets.resize(count);
+    CHECK(offsets == expected);
+}
@@ -8,6 +8,7 @@
 #include <vector>
 #include <utility>
 #include <ctime>
+#include <clocale>
 #include <catch/catch.hpp>
 
 using namespace jsoncons;
@@ -168,3 +169,65 @@ TEST_CASE("test_double_to_wstring")
 }
 
 
+
+static std::string format_double(double val, float_chars_format format, int precision)
+{
+    jsoncons::detail::write_double print(format,precision);
+    std::string s;
+    print(val, s);
+    return s;
+}
+
+TEST_CASE("write_double with precision")
+{
+    SECTION("fixed")
+    {
+        CHECK(format_double(0.125, float_chars_format::fixed, 2) == std::string("0.12")); // tie, to even
+        CHECK(format_double(0.375, float_chars_format::fixed, 2) == std::string("0.38"));
+        CHECK(format_double(2.675, float_chars_format::fixed, 2) == std::string("2.67")); // below the tie in binary
+        CHECK(format_double(1.005, float_chars_format::fixed, 2) == std::string("1.00"));
+        CHECK(format_double(0.5, float_chars_format::fixed, 1) == std::string("0.5"));
+        CHECK(format_double(9.9999, float_chars_format::fixed, 3) == std::string("10.000"));
+        CHECK(format_double(0.0004, float_chars_format::fixed, 2) == std::string("0.00"));
+        CHECK(format_double(-0.0004, float_chars_format::fixed, 2) == std::string("-0.00"));
+        CHECK(format_double(0.1, float_chars_format::fixed, 20) == std::string("0.10000000000000000555"));
+        CHECK(format_double(1e21, float_chars_format::fixed, 1) == std::string("1000000000000000000000.0"));
+    }
+    SECTION("scientific")
+    {
+        CHECK(format_double(123456, float_chars_format::scientific, 2) == std::string("1.23e+05"));
+        CHECK(format_double(9.96e-5, float_chars_format::scientific, 1) == std::string("1.0e-04"));
+        CHECK(format_double(0, float_chars_format::scientific, 3) == std::string("0.000e+00"));
+        CHECK(format_double(5e-324, float_chars_format::scientific, 3) == std::string("4.941e-324"));
+        CHECK(format_double(1.7976931348623157e308, float_chars_format::scientific, 16) == std::string("1.7976931348623157e+308"));
+    }
+    SECTION("general")
+    {
+        CHECK(format_double(1.1, float_chars_format::general, 17) == std::string("1.1000000000000001"));
+        CHECK(format_double(0.3, float_chars_format::general, 17) == std::string("0.29999999999999999"));
+        CHECK(format_double(100, float_chars_format::general, 2) == std::string("1e+02"));
+        CHECK(format_double(99.5, float_chars_format::general, 2) == std::string("1e+02"));
+        CHECK(format_double(0.0001, float_chars_format::general, 3) == std::string("0.0001"));
+        CHECK(format_double(0.00001, float_chars_format::general, 3) == std::string("1e-05"));
+        CHECK(format_double(123.0, float_chars_format::general, 6) == std::string("123.0"));
+    }
+}
+
+TEST_CASE("write_double shortest scientific")
+{
+    CHECK(format_double(1.0, float_chars_format::scientific, 0) == std::string("1e+00"));
+    CHECK(format_double(0.1, float_chars_format::scientific, 0) == std::string("1e-01"));
+    CHECK(format_double(-123.25, float_chars_format::scientific, 0) == std::string("-1.2325e+02"));
+    CHECK(format_double(1.7976931348623157e308, float_chars_format::scientific, 0) == std::string("1.7976931348623157e+308"));
+}
+
+TEST_CASE("write_double ignores the C locale")
+{
+    // snprintf would use a comma in this locale
+    if (std::setlocale(LC_ALL, "de_DE.UTF-8") != nullptr)
+    {
+        CHECK(format_double(1234.5, float_chars_format::fixed, 2) == std::string("1234.50"));
+        CHECK(format_double(1234.5, float_chars_format::general, 0) == std::string("1234.5"));
+        std::setlocale(LC_ALL, "C");
+    }
+}
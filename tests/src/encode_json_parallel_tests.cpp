@@ -0,0 +1,184 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/encode_json_parallel.hpp>
+#include <catch/catch.hpp>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class Json>
+    Json random_value(std::mt19937& gen, int depth)
+    {
+        std::uniform_int_distribution<int> kind(0, depth > 0 ? 7 : 4);
+        switch (kind(gen))
+        {
+            case 0:
+                return Json::null();
+            case 1:
+                return Json(gen() % 2 == 0);
+            case 2:
+                return Json(static_cast<int64_t>(gen()) - 2000000000);
+            case 3:
+                return Json(static_cast<double>(gen()) / 7.0);
+            case 4:
+                return Json(std::string(gen() % 30, static_cast<char>('a' + gen() % 26)));
+            case 5:
+            case 6:
+            {
+                Json a(json_array_arg);
+                std::size_t n = gen() % 6;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    a.push_back(random_value<Json>(gen, depth - 1));
+                }
+                return a;
+            }
+            default:
+            {
+                Json o(json_object_arg);
+                std::size_t n = gen() % 6;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    o.insert_or_assign("k" + std::to_string(gen() % 1000), random_value<Json>(gen, depth - 1));
+                }
+                return o;
+            }
+        }
+    }
+
+    template <class Json>
+    Json random_document(std::mt19937& gen, std::size_t length)
+    {
+        Json doc(json_array_arg);
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            doc.push_back(random_value<Json>(gen, 3));
+        }
+        return doc;
+    }
+
+    template <class Json>
+    void check_same_output(const Json& doc, const json_options& options, std::size_t num_threads)
+    {
+        std::string expected;
+        std::string actual;
+
+        encode_json(doc, expected, options, indenting::no_indent);
+        encode_json_parallel(doc, actual, options, indenting::no_indent, num_threads);
+        CHECK(actual == expected);
+
+        expected.clear();
+        actual.clear();
+        encode_json(doc, expected, options, indenting::indent);
+        encode_json_parallel(doc, actual, options, indenting::indent, num_threads);
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("encode_json_parallel tests")
+{
+    std::mt19937 gen(12345);
+
+    SECTION("top level array")
+    {
+        json doc = random_document<json>(gen, 1000);
+        for (std::size_t num_threads : {1, 2, 3, 8})
+        {
+            check_same_output(doc, json_options(), num_threads);
+        }
+    }
+
+    SECTION("top level object")
+    {
+        ojson doc(json_object_arg);
+        for (std::size_t i = 0; i < 500; ++i)
+        {
+            doc.insert_or_assign("member" + std::to_string(i), random_value<ojson>(gen, 3));
+        }
+        check_same_output(doc, json_options(), 4);
+    }
+
+    SECTION("large nested container")
+    {
+        json doc(json_object_arg);
+        doc.insert_or_assign("meta", random_value<json>(gen, 2));
+        doc.insert_or_assign("items", random_document<json>(gen, 800));
+        doc.insert_or_assign("tail", json(json_array_arg, {1, 2, 3}));
+        json wrapper(json_array_arg);
+        wrapper.push_back(std::move(doc));
+        check_same_output(wrapper, json_options(), 4);
+    }
+
+    SECTION("line split options")
+    {
+        json doc(json_object_arg);
+        doc.insert_or_assign("a", random_document<json>(gen, 300));
+        doc.insert_or_assign("b", random_document<json>(gen, 10));
+        const line_split_kind kinds[] = {line_split_kind::same_line, line_split_kind::new_line, line_split_kind::multi_line};
+        for (auto k1 : kinds)
+        {
+            for (auto k2 : kinds)
+            {
+                for (auto k3 : kinds)
+                {
+                    auto options = json_options{}
+                        .object_array_line_splits(k1)
+                        .array_array_line_splits(k2)
+                        .array_object_line_splits(k3)
+                        .line_length_limit(40);
+                    check_same_output(doc, options, 4);
+                    check_same_output(doc.at("a"), options, 4);
+                }
+            }
+        }
+    }
+
+    SECTION("spaces and padding")
+    {
+        json doc = random_document<json>(gen, 200);
+        auto options = json_options{}
+            .spaces_around_comma(spaces_option::space_after)
+            .spaces_around_colon(spaces_option::space_before_and_after)
+            .pad_inside_array_brackets(true)
+            .pad_inside_object_braces(true)
+            .indent_size(2);
+        check_same_output(doc, options, 3);
+    }
+
+    SECTION("small and scalar documents")
+    {
+        check_same_output(json(10), json_options(), 4);
+        check_same_output(json(json_array_arg), json_options(), 4);
+        check_same_output(json::parse(R"([1,2])"), json_options(), 4);
+        check_same_output(json::parse(R"({"a":[[1,2,3,4,5,6]]})"), json_options(), 4);
+    }
+
+    SECTION("to stream")
+    {
+        json doc = random_document<json>(gen, 500);
+        std::ostringstream expected;
+        std::ostringstream actual;
+        encode_json(doc, expected, indenting::indent);
+        encode_json_parallel(doc, actual, indenting::indent, 4);
+        CHECK(actual.str() == expected.str());
+    }
+
+    SECTION("errors are rethrown")
+    {
+        json doc(json_array_arg);
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            doc.push_back(json::parse(R"([[[1]]])"));
+        }
+        auto options = json_options{}.max_nesting_depth(3);
+        std::string s;
+        REQUIRE_THROWS_AS(encode_json_parallel(doc, s, options, indenting::no_indent, 4), ser_error);
+    }
+}
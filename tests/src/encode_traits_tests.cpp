@@ -31,11 +31,35 @@ namespace encode_traits_tests {
         {
         }
     };
+
+    struct order
+    {
+        std::string id;
+        int quantity;
+        std::shared_ptr<std::string> note;
+        jsoncons::optional<double> discount;
+        std::vector<book> items;
+    };
+
+    class point
+    {
+        double x_;
+        double y_;
+    public:
+        point(double x, double y)
+            : x_(x), y_(y)
+        {
+        }
+        double x() const {return x_;}
+        double y() const {return y_;}
+    };
 } // namespace encode_traits_tests
 
 namespace ns = encode_traits_tests;
 
 JSONCONS_ALL_MEMBER_TRAITS(ns::book,author,title,price)
+JSONCONS_N_MEMBER_NAME_TRAITS(ns::order,2,(id,"order-id"),(quantity,"qty"),(note,"note"),(discount,"discount"),(items,"items"))
+JSONCONS_ALL_CTOR_GETTER_TRAITS(ns::point,y,x)
 
 TEST_CASE("decode_traits string tests")
 {
@@ -130,3 +154,39 @@ TEST_CASE("decode_traits std::pair tests")
     }
 }
 
+
+TEST_CASE("encode_traits json_traits_macros")
+{
+    ns::order order{"A-1", 2, nullptr, jsoncons::optional<double>(), {ns::book{"Haruki Murakami","Kafka on the Shore",25.17}}};
+
+    SECTION("sorted keys")
+    {
+        std::string buf;
+        encode_json(order, buf);
+        CHECK(buf == json(order).to_string());
+        CHECK(buf == R"({"items":[{"author":"Haruki Murakami","price":25.17,"title":"Kafka on the Shore"}],"order-id":"A-1","qty":2})");
+
+        order.note = std::make_shared<std::string>("gift");
+        order.discount = 0.5;
+        buf.clear();
+        encode_json(order, buf);
+        CHECK(buf == json(order).to_string());
+    }
+    SECTION("preserved order")
+    {
+        std::string buf;
+        jsoncons::compact_json_string_encoder encoder(buf);
+        std::error_code ec;
+        jsoncons::encode_traits<ns::order,char>::encode(order, encoder, jsoncons::ojson(), ec);
+        encoder.flush();
+        REQUIRE_FALSE(ec);
+        CHECK(buf == jsoncons::ojson(order).to_string());
+        CHECK(buf == R"({"order-id":"A-1","qty":2,"items":[{"author":"Haruki Murakami","title":"Kafka on the Shore","price":25.17}]})");
+    }
+    SECTION("ctor getter")
+    {
+        std::string buf;
+        encode_json(std::vector<ns::point>{ns::point(1.5, 2.5)}, buf);
+        CHECK(buf == R"([{"x":1.5,"y":2.5}])");
+    }
+}
@@ -0,0 +1,251 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/fd_sink.hpp>
+#include <jsoncons/fd_source.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Reads everything written to the pipe on another thread, so that writers do not block
+    class pipe_reader
+    {
+        int fds_[2];
+        std::string data_;
+        std::thread thread_;
+    public:
+        pipe_reader()
+        {
+            REQUIRE(::pipe(fds_) == 0);
+            thread_ = std::thread([this]()
+            {
+                char buffer[1024];
+                ssize_t n;
+                while ((n = ::read(fds_[0], buffer, sizeof(buffer))) > 0)
+                {
+                    data_.append(buffer, static_cast<std::size_t>(n));
+                }
+            });
+        }
+
+        ~pipe_reader()
+        {
+            if (thread_.joinable())
+            {
+                close_and_read();
+            }
+        }
+
+        int write_fd() const
+        {
+            return fds_[1];
+        }
+
+        const std::string& close_and_read()
+        {
+            ::close(fds_[1]);
+            thread_.join();
+            ::close(fds_[0]);
+            return data_;
+        }
+    };
+
+    // Writes s to a pipe on another thread, closing the write end when done
+    class pipe_writer
+    {
+        int fds_[2];
+        std::thread thread_;
+    public:
+        explicit pipe_writer(const std::string& s)
+        {
+            REQUIRE(::pipe(fds_) == 0);
+            thread_ = std::thread([this,s]()
+            {
+                // small writes, so that the reader sees the input in several pieces
+                for (std::size_t i = 0; i < s.size(); i += 5)
+                {
+                    std::size_t n = (std::min)(std::size_t(5), s.size() - i);
+                    if (::write(fds_[1], s.data() + i, n) < 0)
+                    {
+                        break;
+                    }
+                }
+                ::close(fds_[1]);
+            });
+        }
+
+        ~pipe_writer()
+        {
+            thread_.join();
+            ::close(fds_[0]);
+        }
+
+        int read_fd() const
+        {
+            return fds_[0];
+        }
+    };
+
+    json make_document()
+    {
+        json j(json_array_arg);
+        for (int i = 0; i < 500; ++i)
+        {
+            json item(json_object_arg);
+            item.try_emplace("id", i);
+            item.try_emplace("name", std::string("name ") + std::to_string(i));
+            item.try_emplace("text", std::string(static_cast<std::size_t>(i % 70), 'x'));
+            j.push_back(std::move(item));
+        }
+        return j;
+    }
+}
+
+TEST_CASE("fd_sink tests")
+{
+    json j = make_document();
+    std::string expected;
+    j.dump(expected);
+
+    SECTION("json encoder")
+    {
+        for (std::size_t buflen : {std::size_t(1), std::size_t(16), std::size_t(4096), fd_sink::default_buffer_length})
+        {
+            pipe_reader reader;
+            {
+                basic_compact_json_encoder<char,fd_sink> encoder(fd_sink(reader.write_fd(), buflen));
+                j.dump(encoder);
+            }
+            CHECK(reader.close_and_read() == expected);
+        }
+    }
+
+    SECTION("append larger than the buffer")
+    {
+        pipe_reader reader;
+        std::string s(1000, 'a');
+        {
+            fd_sink sink(reader.write_fd(), 8);
+            sink.append("[", 1);
+            sink.append(s.data(), s.size());
+            sink.push_back(']');
+            sink.flush();
+            CHECK_FALSE(sink.is_error());
+        }
+        CHECK(reader.close_and_read() == "[" + s + "]");
+    }
+
+    SECTION("write error")
+    {
+        int fd = ::open("/dev/null", O_RDONLY);
+        REQUIRE(fd != -1);
+        fd_sink sink(fd, 4);
+        sink.append("[1,2,3]", 7);
+        sink.flush();
+        CHECK(sink.is_error());
+        CHECK(sink.error());
+        ::close(fd);
+    }
+}
+
+TEST_CASE("fd_source tests")
+{
+    json j = make_document();
+    std::string input;
+    j.dump_pretty(input);
+
+    SECTION("json reader")
+    {
+        for (std::size_t buflen : {std::size_t(1), std::size_t(7), fd_source::default_buffer_length})
+        {
+            pipe_writer writer(input);
+            json_decoder<json> decoder;
+            basic_json_reader<char,fd_source> reader(fd_source(writer.read_fd(), buflen), decoder);
+            reader.read();
+            CHECK(decoder.get_result() == j);
+        }
+    }
+
+    SECTION("json cursor")
+    {
+        pipe_writer writer(input);
+        basic_json_cursor<char,fd_source> cursor(fd_source(writer.read_fd(), 13));
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            if (cursor.current().event_type() == staj_event_type::begin_object)
+            {
+                ++count;
+            }
+        }
+        CHECK(count == j.size());
+    }
+
+    SECTION("read and ignore")
+    {
+        pipe_writer writer("0123456789abcdefghijklmnopqrstuvwxyz");
+        fd_source source(writer.read_fd(), 4);
+        CHECK(source.peek_character().value() == '0');
+        CHECK(source.get_character().value() == '0');
+        source.ignore(5);
+        CHECK(source.position() == 6);
+        char buffer[20];
+        CHECK(source.read(buffer, 20) == 20);
+        CHECK(std::string(buffer, 20) == "6789abcdefghijklmnop");
+        CHECK(source.read(buffer, 20) == 10);
+        CHECK(std::string(buffer, 10) == "qrstuvwxyz");
+        CHECK(source.eof());
+        CHECK_FALSE(source.is_error());
+        CHECK(source.position() == 36);
+    }
+
+    SECTION("read error")
+    {
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+        json_decoder<json> decoder;
+        // reading from the write end fails
+        basic_json_reader<char,fd_source> reader(fd_source(fds[1]), decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::source_error);
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+}
+
+TEST_CASE("binary fd_sink and fd_source tests")
+{
+    json j = make_document();
+
+    std::string path = "./output/fd-test.cbor";
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    REQUIRE(fd != -1);
+    {
+        cbor::basic_cbor_encoder<binary_fd_sink> encoder(binary_fd_sink(fd, 64));
+        j.dump(encoder);
+    }
+    ::close(fd);
+
+    fd = ::open(path.c_str(), O_RDONLY);
+    REQUIRE(fd != -1);
+    json_decoder<json> decoder;
+    cbor::basic_cbor_reader<binary_fd_source> reader(binary_fd_source(fd, 64), decoder);
+    reader.read();
+    ::close(fd);
+    CHECK(decoder.get_result() == j);
+}
+
+#endif
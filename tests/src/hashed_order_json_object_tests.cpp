@@ -0,0 +1,138 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+using hjson = basic_json<char,hashed_order_policy,std::allocator<char>>;
+
+namespace {
+
+    // Checks that members are in the same order, and that each can be found by name
+    void check_same(const hjson& h, const ojson& o)
+    {
+        REQUIRE(h.size() == o.size());
+        auto it = h.object_range().begin();
+        for (const auto& member : o.object_range())
+        {
+            CHECK(it->key() == member.key());
+            CHECK(it->value().as<int>() == member.value().as<int>());
+            ++it;
+            auto found = h.find(member.key());
+            REQUIRE(bool(found != h.object_range().end()));
+            CHECK(found->value().as<int>() == member.value().as<int>());
+        }
+    }
+}
+
+TEST_CASE("hashed_order_policy parse")
+{
+    std::string input = R"({"street_number":"100","street_name":"Queen St W","city":"Toronto","country":"Canada"})";
+
+    hjson j = hjson::parse(input);
+    CHECK(j.to_string() == input);
+    CHECK(j["city"].as<std::string>() == "Toronto");
+    CHECK_FALSE(j.contains("province"));
+
+    hjson k = hjson::parse(R"({"b":1,"a":2,"b":3})");
+    REQUIRE(k.size() == 2);
+    CHECK(k["b"].as<int>() == 1);
+    CHECK(k.object_range().begin()->key() == "b");
+}
+
+TEST_CASE("hashed_order_policy insert_or_assign and erase")
+{
+    hjson j;
+    j.insert_or_assign("b", 1);
+    j.insert_or_assign("a", 2);
+    j.insert_or_assign("b", 3);
+    j.try_emplace("a", 4);
+    j.insert_or_assign(j.object_range().begin(), "c", 5);
+    CHECK(j.to_string() == R"({"c":5,"b":3,"a":2})");
+
+    j.erase("b");
+    CHECK(j.to_string() == R"({"c":5,"a":2})");
+    CHECK(bool(j.find("b") == j.object_range().end()));
+}
+
+TEST_CASE("hashed_order_policy large objects")
+{
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<int> op_dist(0, 9);
+    std::uniform_int_distribution<int> key_dist(0, 2999);
+
+    hjson h;
+    ojson o;
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string key = "key" + std::to_string(key_dist(gen));
+        int op = op_dist(gen);
+        if (op < 5)
+        {
+            h.insert_or_assign(key, i);
+            o.insert_or_assign(key, i);
+        }
+        else if (op < 7)
+        {
+            h.try_emplace(key, i);
+            o.try_emplace(key, i);
+        }
+        else if (op < 9)
+        {
+            h.erase(key);
+            o.erase(key);
+        }
+        else
+        {
+            // Insert with a hint in the middle
+            std::size_t n = o.size() / 2;
+            h.insert_or_assign(h.object_range().begin() + n, key, i);
+            o.insert_or_assign(o.object_range().begin() + n, key, i);
+        }
+        CHECK(h.contains(key) == o.contains(key));
+    }
+    check_same(h, o);
+
+    SECTION("erase range")
+    {
+        h.erase(h.object_range().begin() + 10, h.object_range().begin() + 100);
+        o.erase(o.object_range().begin() + 10, o.object_range().begin() + 100);
+        check_same(h, o);
+    }
+
+    SECTION("copy and merge")
+    {
+        hjson copy(h);
+        CHECK(copy == h);
+
+        hjson other;
+        other.insert_or_assign("key0", -1);
+        other.insert_or_assign("new key", -2);
+        copy.merge(other);
+        CHECK(copy.size() == h.size() + 1);
+        CHECK(copy["new key"].as<int>() == -2);
+        copy.merge_or_update(other);
+        CHECK(copy["key0"].as<int>() == -1);
+    }
+
+    SECTION("swap")
+    {
+        hjson small = hjson::parse(R"({"a":1})");
+        swap(small, h);
+        CHECK(h.size() == 1);
+        CHECK(h["a"].as<int>() == 1);
+        check_same(small, o);
+    }
+
+    SECTION("round trip")
+    {
+        hjson j = hjson::parse(h.to_string());
+        check_same(j, o);
+        CHECK(j.to_string() == o.to_string());
+    }
+}
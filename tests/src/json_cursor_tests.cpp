@@ -12,6 +12,7 @@
 #include <vector>
 #include <utility>
 #include <ctime>
+#include <random>
 
 using namespace jsoncons;
 
@@ -570,3 +571,318 @@ TEST_CASE("staj event as object")
     }
 }
 
+
+namespace {
+
+    void random_json_text(std::mt19937& gen, int depth, std::string& s)
+    {
+        static const char* blanks[] = {"", " ", "\n", "\r\n", "\t", "  ", "\r", " /* [ \" */ ", "// ]\n"};
+        s.append(blanks[gen() % 9]);
+        switch (gen() % (depth > 0 ? 7 : 4))
+        {
+            case 0:
+                s.append(std::to_string(static_cast<int64_t>(gen()) - 1000000));
+                break;
+            case 1:
+                s.append(gen() % 2 == 0 ? "true" : "null");
+                break;
+            case 2:
+            case 3:
+            {
+                static const char* parts[] = {"a", "[", "]", "{", "}", "\\\"", "\\\\", "\\n", "/", "\\u00e9", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"};
+                s.push_back('\"');
+                std::size_t n = gen() % 12;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    s.append(parts[gen() % 11]);
+                }
+                s.push_back('\"');
+                break;
+            }
+            case 4:
+            case 5:
+            {
+                s.push_back('[');
+                std::size_t n = gen() % 6;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (i > 0)
+                    {
+                        s.push_back(',');
+                    }
+                    random_json_text(gen, depth - 1, s);
+                }
+                s.append(blanks[gen() % 9]);
+                s.push_back(']');
+                break;
+            }
+            default:
+            {
+                s.push_back('{');
+                std::size_t n = gen() % 6;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    if (i > 0)
+                    {
+                        s.push_back(',');
+                    }
+                    s.append(blanks[gen() % 9]);
+                    s.append("\"k}" + std::to_string(i) + "\":");
+                    random_json_text(gen, depth - 1, s);
+                }
+                s.append(blanks[gen() % 9]);
+                s.push_back('}');
+                break;
+            }
+        }
+        s.append(blanks[gen() % 9]);
+    }
+
+    std::string event_string(const staj_cursor& cursor)
+    {
+        std::string s = std::to_string(static_cast<int>(cursor.current().event_type()));
+        switch (cursor.current().event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::bool_value:
+                s.push_back(':');
+                s.append(cursor.current().get<std::string>());
+                break;
+            default:
+                break;
+        }
+        s.push_back('@');
+        s.append(std::to_string(cursor.context().line()));
+        s.push_back(':');
+        s.append(std::to_string(cursor.context().column()));
+        return s;
+    }
+}
+
+TEST_CASE("json_cursor skip tests")
+{
+    SECTION("skip object and array")
+    {
+        std::string s = R"({"a":[1,{"b":"]}"},[[]]],"c":{"d":"\"}"},"e":3})";
+        json_cursor cursor(s);
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "a");
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "c");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "e");
+        cursor.skip(); // not a container
+        CHECK(cursor.current().get<std::string>() == "e");
+        cursor.next();
+        CHECK(cursor.current().get<int>() == 3);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip top level container")
+    {
+        json_cursor cursor(std::string(R"([1,2,[3]] )"));
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("errors")
+    {
+        std::error_code ec;
+        json_cursor cursor1(std::string(R"({"a":[1,2)"));
+        cursor1.next();
+        cursor1.next();
+        cursor1.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+
+        json_cursor cursor2(std::string(R"({"a":[1,"]"})"));
+        cursor2.next();
+        cursor2.next();
+        REQUIRE_THROWS_AS(cursor2.skip(), ser_error);
+
+        json_cursor cursor3(std::string(R"({"a":[1,"]]]"  )"));
+        cursor3.next();
+        cursor3.next();
+        cursor3.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+
+    SECTION("same events and positions as skipping event by event")
+    {
+        std::mt19937 gen(2020);
+        for (int i = 0; i < 200; ++i)
+        {
+            std::string s;
+            random_json_text(gen, 5, s);
+            for (std::size_t buffer_length : {7, 64, 200, 16384})
+            {
+                std::istringstream is1(s);
+                std::istringstream is2(s);
+                json_cursor cursor1(is1);
+                json_cursor cursor2(is2);
+                cursor1.buffer_length(buffer_length);
+                cursor2.buffer_length(buffer_length);
+                std::mt19937 choice(i);
+                while (!cursor1.done() && !cursor2.done())
+                {
+                    REQUIRE(event_string(cursor1) == event_string(cursor2));
+                    if (choice() % 3 == 0)
+                    {
+                        cursor1.skip();
+                        std::error_code ec;
+                        cursor2.staj_cursor::skip(ec); // event by event
+                        REQUIRE_FALSE(ec);
+                        REQUIRE(event_string(cursor1) == event_string(cursor2));
+                    }
+                    cursor1.next();
+                    cursor2.next();
+                }
+                CHECK(cursor1.done());
+                CHECK(cursor2.done());
+            }
+        }
+    }
+}
+
+namespace {
+
+    std::string event_string(const staj_event& event)
+    {
+        std::string s = std::to_string(static_cast<int>(event.event_type()));
+        s.push_back(' ');
+        s.append(std::to_string(static_cast<int>(event.tag())));
+        switch (event.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+            case staj_event_type::bool_value:
+                s.push_back(':');
+                s.append(event.get<std::string>());
+                break;
+            case staj_event_type::double_value:
+                s.push_back(':');
+                s.append(std::to_string(event.get<double>()));
+                break;
+            default:
+                break;
+        }
+        return s;
+    }
+}
+
+TEST_CASE("json_cursor read_batch tests")
+{
+    SECTION("batches of four")
+    {
+        std::string input = R"([1,"two",{"three":3.5}])";
+        json_cursor cursor(input);
+        staj_event_batch batch(4);
+
+        cursor.read_batch(batch);
+        REQUIRE(batch.size() == 4);
+        CHECK(batch[0].event_type() == staj_event_type::begin_array);
+        CHECK(batch[1].event_type() == staj_event_type::uint64_value);
+        CHECK(batch[1].uint64_value() == 1);
+        CHECK(batch[2].event_type() == staj_event_type::string_value);
+        CHECK(batch.string_value(batch[2]) == "two");
+        CHECK(batch[3].event_type() == staj_event_type::begin_object);
+        REQUIRE_FALSE(cursor.done());
+        CHECK(cursor.current().event_type() == staj_event_type::key);
+
+        cursor.read_batch(batch);
+        REQUIRE(batch.size() == 4);
+        CHECK(batch.string_value(batch[0]) == "three");
+        CHECK(batch[1].double_value() == 3.5);
+        CHECK(batch[2].event_type() == staj_event_type::end_object);
+        CHECK(batch[3].event_type() == staj_event_type::end_array);
+        CHECK(cursor.done());
+
+        cursor.read_batch(batch);
+        CHECK(batch.empty());
+    }
+
+    SECTION("errors")
+    {
+        std::string input1 = R"([1,2)";
+        json_cursor cursor(input1);
+        staj_event_batch batch(10);
+        std::error_code ec;
+        cursor.read_batch(batch, ec);
+        CHECK(ec == json_errc::unexpected_eof);
+        CHECK(batch.size() == 3);
+
+        std::string input2 = R"([1,2})";
+        json_cursor cursor2(input2);
+        REQUIRE_THROWS_AS(cursor2.read_batch(batch), ser_error);
+    }
+
+    SECTION("filter")
+    {
+        std::string input = R"({"a":1,"b":[2,3],"c":"4"})";
+        json_cursor cursor(input);
+        auto filtered = cursor | [](const staj_event& event, const ser_context&) 
+        {
+            return event.event_type() != staj_event_type::key;
+        };
+        staj_event_batch batch(100);
+        filtered.read_batch(batch);
+        REQUIRE(batch.size() == 8);
+        CHECK(batch[1].uint64_value() == 1);
+        CHECK(batch.string_value(batch[6]) == "4");
+        CHECK(filtered.done());
+    }
+
+    SECTION("same events as next()")
+    {
+        std::mt19937 gen(2021);
+        for (int i = 0; i < 200; ++i)
+        {
+            std::string s;
+            random_json_text(gen, 5, s);
+
+            std::vector<std::string> expected;
+            json_cursor cursor1(s);
+            for (; !cursor1.done(); cursor1.next())
+            {
+                expected.push_back(event_string(cursor1.current()));
+            }
+
+            for (std::size_t capacity : {1, 2, 3, 17, 1000})
+            {
+                std::istringstream is(s);
+                json_cursor cursor2(is);
+                cursor2.buffer_length(16);
+                staj_event_batch batch(capacity);
+                std::vector<std::string> actual;
+                while (!cursor2.done())
+                {
+                    cursor2.read_batch(batch);
+                    REQUIRE(batch.size() > 0);
+                    REQUIRE(batch.size() <= capacity);
+                    for (std::size_t j = 0; j < batch.size(); ++j)
+                    {
+                        actual.push_back(event_string(batch.event(j)));
+                    }
+                }
+                CHECK(actual == expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_disposer.hpp>
+#include <catch/catch.hpp>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class Json>
+    Json make_nested_arrays(std::size_t depth)
+    {
+        Json root(json_array_arg);
+        Json* p = &root;
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            p->emplace_back(1);
+            p = &p->emplace_back(json_array_arg);
+        }
+        return root;
+    }
+
+    template <class Json>
+    Json make_nested_objects(std::size_t depth)
+    {
+        Json root(json_object_arg);
+        Json* p = &root;
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            p->try_emplace("x", 1);
+            p = &p->try_emplace("a", json_object_arg).first->value();
+        }
+        return root;
+    }
+
+} // namespace
+
+TEST_CASE("destroy deeply nested values")
+{
+    const std::size_t depth = 200000;
+
+    SECTION("arrays")
+    {
+        json j = make_nested_arrays<json>(depth);
+        CHECK(j.size() == 2);
+    }
+    SECTION("sorted objects")
+    {
+        json j = make_nested_objects<json>(depth);
+        CHECK(j.size() == 2);
+    }
+    SECTION("order preserving objects")
+    {
+        ojson j = make_nested_objects<ojson>(depth);
+        CHECK(j.size() == 2);
+    }
+    SECTION("assignment over a nested value")
+    {
+        json j = make_nested_arrays<json>(depth);
+        j = json("short");
+        CHECK(j.as<std::string>() == "short");
+    }
+}
+
+TEST_CASE("json_disposer tests")
+{
+    SECTION("dispose and flush")
+    {
+        json_disposer<json> disposer;
+        for (int i = 0; i < 10; ++i)
+        {
+            json j = make_nested_objects<json>(1000);
+            disposer.dispose(std::move(j));
+            CHECK(j.is_null());
+        }
+        disposer.flush();
+        CHECK(disposer.pending() == 0);
+    }
+
+    SECTION("values without heap storage are destroyed in place")
+    {
+        json_disposer<ojson> disposer;
+        disposer.dispose(ojson(10));
+        disposer.dispose(ojson("short"));
+        disposer.dispose(ojson(json_array_arg));
+        CHECK(disposer.pending() == 0);
+    }
+
+    SECTION("queued values are destroyed on destruction")
+    {
+        json_disposer<ojson> disposer;
+        for (int i = 0; i < 10; ++i)
+        {
+            disposer.dispose(make_nested_arrays<ojson>(1000));
+        }
+    }
+}
@@ -29,3 +29,47 @@ TEST_CASE("test_byte_string_serialization")
     CHECK(os.str() == expected);
 }
 
+
+TEST_CASE("escape_string at every position of a long string")
+{
+    // Long enough for the vector kernels, with one character to escape at each position
+    const std::string run(80, 'a');
+    const std::vector<std::pair<std::string,std::string>> cases = {
+        {"\"", "\\\""}, {"\\", "\\\\"}, {"\n", "\\n"}, {"\x01", "\\u0001"}, {"\x7f", "\\u007F"}
+    };
+
+    for (const auto& c : cases)
+    {
+        for (std::size_t i = 0; i <= run.size(); ++i)
+        {
+            std::string s = run.substr(0, i) + c.first + run.substr(i);
+            std::string expected = "\"" + run.substr(0, i) + c.second + run.substr(i) + "\"";
+
+            std::string buffer;
+            json_string_encoder encoder(buffer);
+            encoder.string_value(s);
+            encoder.flush();
+            CHECK(buffer == expected);
+        }
+    }
+
+    SECTION("escape_solidus and escape_all_non_ascii")
+    {
+        json_options options;
+        options.escape_solidus(true)
+               .escape_all_non_ascii(true);
+        std::string s = run + "/" + run + "\xC3\xA9" + run + "\xF0\x9F\x98\x80" + run;
+
+        std::string buffer;
+        json_string_encoder encoder(buffer, options);
+        encoder.string_value(s);
+        encoder.flush();
+        CHECK(buffer == "\"" + run + "\\/" + run + "\\u00E9" + run + "\\uD83D\\uDE00" + run + "\"");
+
+        std::string plain;
+        json_string_encoder plain_encoder(plain);
+        plain_encoder.string_value(s);
+        plain_encoder.flush();
+        CHECK(plain == "\"" + s + "\"");
+    }
+}
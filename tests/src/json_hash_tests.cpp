@@ -0,0 +1,163 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json hash consistent with operator==")
+{
+    std::hash<json> hash;
+
+    SECTION("numbers")
+    {
+        CHECK(json(1) == json(1u));
+        CHECK(hash(json(1)) == hash(json(1u)));
+        CHECK(json(1) == json(1.0));
+        CHECK(hash(json(1)) == hash(json(1.0)));
+        CHECK(hash(json(uint64_t(1) << 40)) == hash(json(double(uint64_t(1) << 40))));
+        CHECK(hash(json(-0.0)) == hash(json(0)));
+        CHECK(hash(json(half_arg, 0x3c00)) == hash(json(1.0))); // 1.0 as half
+        CHECK(hash(json(1)) != hash(json(2)));
+    }
+
+    SECTION("tags are ignored")
+    {
+        json a("2020-01-01", semantic_tag::datetime);
+        json b("2020-01-01");
+        CHECK(a == b);
+        CHECK(hash(a) == hash(b));
+    }
+
+    SECTION("short and long strings")
+    {
+        std::string s(100, 'a');
+        json a(s);
+        json b(s.c_str());
+        CHECK(hash(a) == hash(b));
+        CHECK(hash(json("a")) != hash(json("b")));
+        CHECK(hash(json("1")) != hash(json(1)));
+    }
+
+    SECTION("empty containers")
+    {
+        json a(json_array_arg);
+        json b = json::parse("[]");
+        json c = json::parse("[1]");
+        c.erase(c.array_range().begin());
+        CHECK(a == c);
+        CHECK(hash(a) == hash(b));
+        CHECK(hash(a) == hash(c));
+
+        json o1;
+        json o2(json_object_arg);
+        CHECK(o1 == o2);
+        CHECK(hash(o1) == hash(o2));
+        CHECK(hash(o1) != hash(a));
+    }
+
+    SECTION("containers")
+    {
+        json a = json::parse(R"({"a":[1,2.0,{"b":null}],"c":"d"})");
+        json b = json::parse(R"({"c":"d","a":[1.0,2,{"b":null}]})");
+        CHECK(a == b);
+        CHECK(hash(a) == hash(b));
+        CHECK(hash(json::parse("[1,2]")) != hash(json::parse("[2,1]")));
+        CHECK(hash(json::parse(R"({"a":1,"b":2})")) != hash(json::parse(R"({"a":2,"b":1})")));
+    }
+
+    SECTION("const pointers")
+    {
+        json a = json::parse(R"({"a":[1,2,3]})");
+        json p(json_const_pointer_arg, &a);
+        CHECK(hash(p) == hash(a));
+    }
+
+    SECTION("order preserving objects with the same member order")
+    {
+        ojson a = ojson::parse(R"({"b":1,"a":[true,"x"]})");
+        json b = json::parse(R"({"b":1,"a":[true,"x"]})");
+        CHECK(std::hash<ojson>()(a) == std::hash<json>()(b));
+    }
+}
+
+TEST_CASE("json hash containers")
+{
+    SECTION("unordered_set deduplication")
+    {
+        json values = json::parse(R"([1, 1.0, "x", {"a":[1,2]}, {"a":[1.0,2]}, [], [], null, "x"])");
+        std::unordered_set<json> set;
+        for (const auto& item : values.array_range())
+        {
+            set.insert(item);
+        }
+        CHECK(set.size() == 5);
+    }
+
+    SECTION("unordered_map keyed by document")
+    {
+        std::unordered_map<ojson,int> map;
+        map[ojson::parse(R"({"id":1})")] = 1;
+        map[ojson::parse(R"({"id":2})")] = 2;
+        CHECK(map.at(ojson::parse(R"({"id":1.0})")) == 1);
+    }
+}
+
+TEST_CASE("json_hash_cache tests")
+{
+    json doc = json::parse(R"(
+    {"books":[{"title":"A","tags":["x","y"]},{"title":"B","tags":[]}],"count":2}
+    )");
+
+    json_hash_cache<json> cache;
+    CHECK(cache(doc) == std::hash<json>()(doc));
+    std::size_t cached = cache.size();
+    CHECK(cached == 5); // document, books, two books, one non-empty tags array
+    CHECK(cache(doc.at("books")) == std::hash<json>()(doc.at("books")));
+    CHECK(cache.size() == cached);
+
+    cache.clear();
+    CHECK(cache.size() == 0);
+}
+
+TEST_CASE("json hash deeply nested values")
+{
+    const std::size_t depth = 200000;
+
+    SECTION("arrays")
+    {
+        json a(json_array_arg);
+        json b(json_array_arg);
+        json* p = &a;
+        json* q = &b;
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            p->emplace_back(1);
+            p = &p->emplace_back(json_array_arg);
+            q->emplace_back(1.0);
+            q = &q->emplace_back(json_array_arg);
+        }
+        CHECK(std::hash<json>()(a) == std::hash<json>()(b));
+        q->emplace_back(2);
+        CHECK(std::hash<json>()(a) != std::hash<json>()(b));
+    }
+
+    SECTION("objects")
+    {
+        ojson a(json_object_arg);
+        ojson* p = &a;
+        for (std::size_t i = 0; i < depth; ++i)
+        {
+            p->try_emplace("x", 1);
+            p = &p->try_emplace("a", json_object_arg).first->value();
+        }
+        json_hash_cache<ojson> cache;
+        CHECK(cache(a) == std::hash<ojson>()(a));
+        CHECK(cache.size() == depth);
+    }
+}
@@ -0,0 +1,174 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_lines(std::size_t count)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s.append(R"({"id":)" + std::to_string(i) + R"(,"name":"name )" + std::to_string(i) + R"(","values":[1.5,2,"three"]})");
+            s.append(i % 3 == 0 ? "\r\n" : "\n");
+        }
+        return s;
+    }
+}
+
+TEST_CASE("json_lines_reader tests")
+{
+    std::string s = make_lines(1000);
+
+    std::vector<json> expected;
+    {
+        std::istringstream is(s);
+        std::string line;
+        while (std::getline(is, line))
+        {
+            expected.push_back(json::parse(line));
+        }
+    }
+
+    for (std::size_t num_threads : {1, 2, 4})
+    {
+        for (std::size_t chunk_length : {1, 100, 4096, 1024*1024})
+        {
+            std::istringstream is(s);
+            json_lines_reader reader(is, num_threads);
+            reader.chunk_length(chunk_length);
+            CHECK(reader.num_threads() == num_threads);
+
+            std::vector<json> values;
+            json j;
+            while (reader.read_next(j))
+            {
+                CHECK(reader.line() == values.size() + 1);
+                values.push_back(std::move(j));
+            }
+            CHECK(values == expected);
+        }
+    }
+}
+
+TEST_CASE("json_lines_reader blank lines and no trailing newline")
+{
+    std::string s = "\xEF\xBB\xBF[1]\n\n  \n{\"a\":true}\r\n\"x\"";
+
+    std::istringstream is(s);
+    json_lines_reader reader(is, 2);
+    reader.chunk_length(3);
+
+    json j;
+    REQUIRE(reader.read_next(j));
+    CHECK(j == json::parse("[1]"));
+    CHECK(reader.line() == 1);
+    REQUIRE(reader.read_next(j));
+    CHECK(j == json::parse("{\"a\":true}"));
+    CHECK(reader.line() == 4);
+    REQUIRE(reader.read_next(j));
+    CHECK(j == json("x"));
+    CHECK(reader.line() == 5);
+    CHECK_FALSE(reader.read_next(j));
+}
+
+TEST_CASE("json_lines_reader errors are reported per line")
+{
+    std::string s = "[1,2]\n[1,2\n{\"a\" 1}\n3\n[1] 2\n4\n";
+
+    std::istringstream is(s);
+    json_lines_reader reader(is, 3);
+    reader.chunk_length(4);
+
+    std::vector<json> values;
+    std::vector<std::size_t> error_lines;
+    std::vector<std::error_code> errors;
+
+    json j;
+    std::error_code ec;
+    while (reader.read_next(j, ec))
+    {
+        if (ec)
+        {
+            error_lines.push_back(reader.line());
+            errors.push_back(ec);
+            ec.clear();
+        }
+        else
+        {
+            values.push_back(j);
+        }
+    }
+    CHECK(values == std::vector<json>{json::parse("[1,2]"), json(3), json(4)});
+    CHECK(error_lines == std::vector<std::size_t>{2, 3, 5});
+    REQUIRE(errors.size() == 3);
+    CHECK(errors[0] == json_errc::unexpected_eof);
+    CHECK(errors[1] == json_errc::expected_colon);
+    CHECK(errors[2] == json_errc::extra_character);
+
+    SECTION("throwing overload")
+    {
+        std::istringstream is2(s);
+        json_lines_reader reader2(is2, 1);
+        REQUIRE(reader2.read_next(j));
+        CHECK_THROWS_AS(reader2.read_next(j), ser_error);
+        CHECK(reader2.line() == 2);
+        CHECK_THROWS_AS(reader2.read_next(j), ser_error);
+        REQUIRE(reader2.read_next(j));
+        CHECK(j == json(3));
+    }
+}
+
+TEST_CASE("json_lines_reader serializes calls to the error handler")
+{
+    const std::size_t count = 5000;
+    std::string s;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        s.append("/* line */ [" + std::to_string(i) + "]\n");
+    }
+
+    // Not thread safe by itself
+    std::vector<json_errc> reported;
+    auto err_handler = [&reported](json_errc code, const ser_context&) -> bool
+    {
+        reported.push_back(code);
+        return true;
+    };
+
+    std::istringstream is(s);
+    json_lines_reader reader(is, json_options(), err_handler, 4);
+    reader.chunk_length(256);
+
+    std::size_t n = 0;
+    json j;
+    while (reader.read_next(j))
+    {
+        CHECK(j[0].as<std::size_t>() == n);
+        ++n;
+    }
+    CHECK(n == count);
+    CHECK(reported.size() == count);
+    CHECK(std::count(reported.begin(), reported.end(), json_errc::illegal_comment) == static_cast<std::ptrdiff_t>(count));
+}
+
+TEST_CASE("json_lines_reader destroyed before reading all lines")
+{
+    std::string s = make_lines(10000);
+    std::istringstream is(s);
+    json_lines_reader reader(is, 4);
+    reader.chunk_length(256);
+
+    json j;
+    CHECK(reader.read_next(j));
+    CHECK(j["id"].as<int>() == 0);
+}
@@ -277,3 +277,148 @@ TEST_CASE("test_incremental_parsing")
 
 
 
+namespace {
+
+    // Counts the keys and strings that are views into [first, last)
+    class string_location_visitor : public default_json_visitor
+    {
+        const char* first_;
+        const char* last_;
+    public:
+        std::size_t in_input = 0;
+        std::size_t copied = 0;
+
+        string_location_visitor(const char* first, const char* last)
+            : first_(first), last_(last)
+        {
+        }
+    private:
+        void count(const string_view_type& s)
+        {
+            if (s.data() >= first_ && s.data() + s.size() <= last_)
+            {
+                ++in_input;
+            }
+            else
+            {
+                ++copied;
+            }
+        }
+
+        bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+        {
+            count(name);
+            return true;
+        }
+
+        bool visit_string(const string_view_type& value, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            count(value);
+            return true;
+        }
+    };
+}
+
+TEST_CASE("json_parser string views")
+{
+    SECTION("strings without escapes are views into the input")
+    {
+        std::string s = R"({"a":"x","bb":["y\n","zz",""],"c\"":"é"})";
+
+        string_location_visitor visitor(s.data(), s.data() + s.size());
+        json_parser parser;
+        parser.update(s);
+        parser.finish_parse(visitor);
+        CHECK(parser.done());
+        CHECK(visitor.in_input == 6);
+        CHECK(visitor.copied == 2);
+    }
+
+    SECTION("strings that span chunks are copied")
+    {
+        std::string s1 = R"(["de)";
+        std::string s2 = R"(f", "gh"])";
+
+        string_location_visitor visitor(s2.data(), s2.data() + s2.size());
+        json_parser parser;
+        parser.update(s1);
+        parser.parse_some(visitor);
+        CHECK(parser.source_exhausted());
+        parser.update(s2);
+        parser.finish_parse(visitor);
+        CHECK(parser.done());
+        CHECK(visitor.in_input == 1);
+        CHECK(visitor.copied == 1);
+    }
+}
+
+
+namespace {
+
+    template <class Encoder, class Result>
+    std::error_code reformat(const std::string& input, std::size_t chunk_size, bool use_static, 
+                             Result& result, std::size_t& line, std::size_t& column)
+    {
+        Encoder encoder(result);
+        json_parser parser;
+        std::error_code ec;
+        for (std::size_t pos = 0; pos < input.size() && !ec && !parser.done(); pos += chunk_size)
+        {
+            parser.update(input.data() + pos, (std::min)(chunk_size, input.size() - pos));
+            while (!ec && !parser.source_exhausted() && !parser.done())
+            {
+                use_static ? parser.parse_some_static(encoder, ec) : parser.parse_some(encoder, ec);
+            }
+        }
+        if (!ec)
+        {
+            use_static ? parser.finish_parse_static(encoder, ec) : parser.finish_parse(encoder, ec);
+        }
+        if (!ec)
+        {
+            parser.check_done(ec);
+        }
+        line = parser.line();
+        column = parser.column();
+        return ec;
+    }
+}
+
+TEST_CASE("json_parser parse_some_static")
+{
+    std::vector<std::string> inputs = {
+        R"({"a":[1,-2,3.5,true,false,null],"b\n":{"c":"dé"},"e":[]})",
+        R"(  [ 18446744073709551616, -9223372036854775809, 1e400, "x" ]  )",
+        "123",
+        R"("string")",
+        R"([{"a":1},{"b":[2,[3,[4]]]}])",
+        R"({"a":[1,2,})",
+        R"([1,2]x)",
+        R"({"a":tru})",
+        R"(["abc)"
+    };
+
+    for (const auto& input : inputs)
+    {
+        for (std::size_t chunk_size : {1, 3, 1000})
+        {
+            std::string expected;
+            std::size_t expected_line, expected_column;
+            std::error_code expected_ec = reformat<compact_json_string_encoder>(input, chunk_size, false, 
+                                                                                 expected, expected_line, expected_column);
+            std::string actual;
+            std::size_t line, column;
+            std::error_code ec = reformat<compact_json_string_encoder>(input, chunk_size, true, actual, line, column);
+            CHECK(ec == expected_ec);
+            CHECK(line == expected_line);
+            CHECK(column == expected_column);
+            CHECK(actual == expected);
+
+            std::string pretty_expected;
+            reformat<json_string_encoder>(input, chunk_size, false, pretty_expected, expected_line, expected_column);
+            std::string pretty_actual;
+            reformat<json_string_encoder>(input, chunk_size, true, pretty_actual, line, column);
+            CHECK(pretty_actual == pretty_expected);
+        }
+    }
+}
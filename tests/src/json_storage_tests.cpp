@@ -31,3 +31,147 @@ TEST_CASE("json storage tests")
     CHECK(storage_kind::double_value == var9.storage());
 }
 
+
+TEST_CASE("json empty container storage tests")
+{
+    SECTION("parse")
+    {
+        json j = json::parse(R"({"a":[],"b":{},"c":[1,2],"d":{"e":[]}})");
+        CHECK(j["a"].storage() == storage_kind::empty_array_value);
+        CHECK(j["b"].storage() == storage_kind::empty_object_value);
+        CHECK(j["c"].storage() == storage_kind::array_value);
+        CHECK(j["d"]["e"].storage() == storage_kind::empty_array_value);
+        CHECK(j.to_string() == R"({"a":[],"b":{},"c":[1,2],"d":{"e":[]}})");
+
+        CHECK(j["a"].is_array());
+        CHECK(j["a"].type() == json_type::array_value);
+        CHECK(j["a"].empty());
+        CHECK(j["a"].size() == 0);
+        CHECK(bool(j["a"].array_range().begin() == j["a"].array_range().end()));
+        CHECK_THROWS_AS(j["a"].at(0), std::out_of_range);
+    }
+
+    SECTION("json_array_arg")
+    {
+        json j(json_array_arg, semantic_tag::none);
+        CHECK(j.storage() == storage_kind::empty_array_value);
+
+        const json& k = j;
+        CHECK(k.array_value().empty());
+
+        j.push_back(1);
+        CHECK(j.storage() == storage_kind::array_value);
+        CHECK(j.size() == 1);
+
+        json l(json_array_arg);
+        l.resize(2);
+        CHECK(l.size() == 2);
+
+        json m(json_array_arg, semantic_tag::none, std::allocator<char>());
+        CHECK(m.storage() == storage_kind::array_value);
+    }
+
+    SECTION("compare")
+    {
+        json empty1(json_array_arg);
+        json empty2(json_array_arg, semantic_tag::none, std::allocator<char>());
+        json nonempty = json::parse("[1]");
+        CHECK(empty1 == empty2);
+        CHECK(empty2 == empty1);
+        CHECK(empty1 < nonempty);
+        CHECK(empty1 < json());
+        CHECK(json(true) < empty1);
+
+        json copy = empty1;
+        CHECK(copy.storage() == storage_kind::empty_array_value);
+        CHECK(copy == empty1);
+    }
+}
+
+TEST_CASE("json container element buffer tests")
+{
+    SECTION("parse")
+    {
+        json j = json::parse(R"({"a":[1,2,3],"b":{"x":1,"y":2},"c":"str"})");
+        CHECK(j.object_value().buffer_capacity() == 3);
+        CHECK(j.at("a").array_value().buffer_capacity() == 3);
+        CHECK(j.at("a").array_value().capacity() == 3);
+        CHECK(j.at("b").object_value().buffer_capacity() == 2);
+
+        ojson k = ojson::parse(R"({"b":{"y":2,"x":1},"a":[1,2,3]})");
+        CHECK(k.object_value().buffer_capacity() == 2);
+        CHECK(k.at("a").array_value().buffer_capacity() == 3);
+        CHECK(k.to_string() == R"({"b":{"y":2,"x":1},"a":[1,2,3]})");
+    }
+
+    SECTION("outgrow the buffer")
+    {
+        json j = json::parse(R"([1,"a string that is too long for short string storage",3])");
+        j.push_back(j[1]);
+        j.push_back(5);
+        CHECK(j.size() == 5);
+        CHECK(j.array_value().buffer_capacity() == 3);
+        CHECK(j.capacity() >= 5);
+        CHECK(j[3] == j[1]);
+        CHECK(j[4] == 5);
+
+        j.erase(j.array_range().begin() + 1, j.array_range().end() - 1);
+        j.shrink_to_fit();
+        CHECK(j.capacity() == 3);
+        CHECK(j == json::parse("[1,5]"));
+    }
+
+    SECTION("copy")
+    {
+        json j = json::parse(R"({"a":[1,2,3],"b":{"x":1,"y":2}})");
+        j["a"].push_back(4);
+
+        json copy = j;
+        CHECK(copy == j);
+        CHECK(copy.at("a").array_value().buffer_capacity() == 4);
+        CHECK(copy.at("b").object_value().buffer_capacity() == 2);
+
+        json copy2(j, std::allocator<char>());
+        CHECK(copy2 == j);
+        CHECK(copy2.object_value().buffer_capacity() == 2);
+    }
+
+    SECTION("swap and move")
+    {
+        json j = json::parse(R"({"a":[1,2,3],"b":[4,5]})");
+        json::allocator_type alloc;
+        json::array heap_array(alloc);
+        heap_array.push_back(6);
+
+        j.at("a").array_value().swap(j.at("b").array_value());
+        CHECK(j == json::parse(R"({"a":[4,5],"b":[1,2,3]})"));
+        j.at("a").array_value().swap(heap_array);
+        CHECK(j == json::parse(R"({"a":[6],"b":[1,2,3]})"));
+        CHECK(heap_array.size() == 2);
+
+        json::array moved(std::move(j.at("b").array_value()));
+        CHECK(moved.size() == 3);
+        CHECK(j["b"].empty());
+        j.at("b").array_value().swap(moved);
+        CHECK(j == json::parse(R"({"a":[6],"b":[1,2,3]})"));
+    }
+
+    SECTION("reserve")
+    {
+        json j(json_array_arg);
+        j.reserve(2);
+        CHECK(j.storage() == storage_kind::array_value);
+        CHECK(j.array_value().buffer_capacity() == 2);
+        j.push_back("a string that is too long for short string storage");
+        j.push_back(j[0]);
+        CHECK(j.size() == 2);
+        CHECK(j[0] == j[1]);
+
+        json k;
+        k.reserve(1);
+        CHECK(k.storage() == storage_kind::object_value);
+        CHECK(k.object_value().buffer_capacity() == 1);
+        k.try_emplace("key", 1);
+        CHECK(k.size() == 1);
+    }
+}
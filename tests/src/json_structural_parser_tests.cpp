@@ -0,0 +1,293 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_structural_parser.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class Reader>
+    json read_json(const std::string& s)
+    {
+        json_decoder<json> decoder;
+        Reader reader(s, decoder);
+        reader.read();
+        return decoder.get_result();
+    }
+
+    template <class Reader>
+    json read_json(const std::string& s, std::size_t buffer_length)
+    {
+        std::istringstream is(s);
+        json_decoder<json> decoder;
+        Reader reader(is, decoder);
+        reader.buffer_length(buffer_length);
+        reader.read();
+        return decoder.get_result();
+    }
+
+    template <class Reader>
+    std::error_code read_error(const std::string& s, std::size_t& line, std::size_t& column)
+    {
+        json_decoder<json> decoder;
+        Reader reader(s, decoder);
+        std::error_code ec;
+        reader.read(ec);
+        line = reader.line();
+        column = reader.column();
+        return ec;
+    }
+}
+
+TEST_CASE("json_structural_reader tests")
+{
+    std::string s = R"(
+{
+    "name" : "Jane \"Roe\"",
+    "id" : 18446744073709551615,
+    "balance" : -1234.5e-2,
+    "big" : 123456789012345678901234567890,
+    "tags" : ["a", "b\u00e9", "\ud83d\ude00", [], {}],
+    "active" : true,
+    "parent" : null,
+    "text" : "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore"
+}
+    )";
+
+    json expected = read_json<json_reader>(s);
+
+    SECTION("from string")
+    {
+        json j = read_json<json_structural_reader>(s);
+        CHECK(j == expected);
+        CHECK(j["big"].tag() == semantic_tag::bigint);
+    }
+
+    SECTION("from stream with small buffers")
+    {
+        for (std::size_t buffer_length = 1; buffer_length <= 70; ++buffer_length)
+        {
+            json j = read_json<json_structural_reader>(s, buffer_length);
+            CHECK(j == expected);
+        }
+    }
+
+    SECTION("root scalars")
+    {
+        const std::vector<std::string> inputs = {"1", " -12 ", "1.5", "\"abc\"", "true", "false", "null", "0"};
+        for (const auto& input : inputs)
+        {
+            CHECK(read_json<json_structural_reader>(input) == read_json<json_reader>(input));
+            CHECK(read_json<json_structural_reader>(input, 1) == read_json<json_reader>(input));
+        }
+    }
+}
+
+TEST_CASE("json_structural_reader large input")
+{
+    std::string s = "[";
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        if (i > 0)
+        {
+            s.append(",\n");
+        }
+        s.append(R"({"id":)" + std::to_string(i) + R"(,"name":"name \\ )" + std::to_string(i) + R"(","value":)" + std::to_string(i) + ".25}");
+    }
+    s.push_back(']');
+
+    json expected = read_json<json_reader>(s);
+    CHECK(read_json<json_structural_reader>(s) == expected);
+    CHECK(read_json<json_structural_reader>(s, 4093) == expected);
+}
+
+TEST_CASE("json_structural_reader long strings")
+{
+    // Strings that cross block and window boundaries, with escapes and non-ASCII characters
+    // at different offsets
+    std::string s = "[";
+    for (std::size_t i = 0; i < 3000; ++i)
+    {
+        if (i > 0)
+        {
+            s.push_back(',');
+        }
+        std::string text(i % 300, 'x');
+        if (i % 3 == 1)
+        {
+            text.insert(text.size()/2, "\xc3\xa9");
+        }
+        if (i % 5 == 2)
+        {
+            text.insert(text.size()/3, "\\n");
+        }
+        s.append("\"" + text + "\"");
+    }
+    s.push_back(']');
+
+    json expected = read_json<json_reader>(s);
+    CHECK(read_json<json_structural_reader>(s) == expected);
+    CHECK(read_json<json_structural_reader>(s, 4093) == expected);
+
+    SECTION("errors")
+    {
+        const std::vector<std::string> inputs = {
+            "[\"" + std::string(200, 'x') + "\xff\"]", "[\"" + std::string(200, 'x') + "\x01\"]",
+            "[\"" + std::string(200, 'x') + "\xc3\"]", "{\"" + std::string(100, 'x') + "\xc3\xa9\" 1}"
+        };
+        for (const auto& input : inputs)
+        {
+            std::size_t line1, column1, line2, column2;
+            std::error_code ec1 = read_error<json_reader>(input, line1, column1);
+            std::error_code ec2 = read_error<json_structural_reader>(input, line2, column2);
+            CHECK(ec1);
+            CHECK(ec2 == ec1);
+            CHECK(line2 == line1);
+            CHECK(column2 == column1);
+        }
+    }
+}
+
+TEST_CASE("json_structural_reader error tests")
+{
+    const std::vector<std::string> inputs = {
+        "", "[1,2", "{\"a\" 1}", "[1 2]", "[1,]", "{\"a\":1,}", "]", "1]", "[1]x", "tru", "[trux]",
+        "[-]", "[01]", "[1.]", "[\"\\x\"]", "[\"\\u12x4\"]", "[\"a\nb\"]", "[\"a\x01\"]", "{\"a\x01\":1}", "[\"\xff\"]", "\"abc", "{\"a\":nul}"
+    };
+
+    for (const auto& input : inputs)
+    {
+        std::size_t line1, column1, line2, column2;
+        std::error_code ec1 = read_error<json_reader>(input, line1, column1);
+        std::error_code ec2 = read_error<json_structural_reader>(input, line2, column2);
+        CHECK(ec1);
+        CHECK(ec2 == ec1);
+        CHECK(line2 == line1);
+        CHECK(column2 == column1);
+    }
+
+    SECTION("max nesting depth")
+    {
+        json_options options;
+        options.max_nesting_depth(10);
+        std::string input(11, '[');
+        json_decoder<json> decoder;
+        json_structural_reader reader(input, decoder, options);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::max_nesting_depth_exceeded);
+    }
+}
+
+TEST_CASE("json_structural_reader comment tests")
+{
+    std::string s = R"(
+// Comment
+{
+    "a" : /* "b" : [ */ 1,
+    "c" : 2 // "d"
+}
+    )";
+
+    SECTION("comments allowed")
+    {
+        CHECK(read_json<json_structural_reader>(s) == read_json<json_reader>(s));
+        CHECK(read_json<json_structural_reader>(s, 3) == read_json<json_reader>(s));
+    }
+
+    SECTION("strict")
+    {
+        json_decoder<json> decoder;
+        json_structural_reader reader(s, decoder, strict_json_parsing());
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::illegal_comment);
+        CHECK(reader.line() == 2);
+        CHECK(reader.column() == 2);
+    }
+}
+
+TEST_CASE("json_structural_reader recovering error handler tests")
+{
+    auto allow_extra_comma = [](json_errc ec, const ser_context&) -> bool
+    {
+        return ec == json_errc::extra_comma;
+    };
+
+    std::string s = "[1,2,]";
+
+    json_decoder<json> decoder1;
+    json_reader reader1(s, decoder1, allow_extra_comma);
+    reader1.read();
+
+    json_decoder<json> decoder2;
+    json_structural_reader reader2(s, decoder2, allow_extra_comma);
+    reader2.read();
+
+    json expected = decoder1.get_result();
+    CHECK(expected == json::parse("[1,2]"));
+    CHECK(decoder2.get_result() == expected);
+
+    SECTION("errors not recovered from")
+    {
+        std::size_t line1, column1, line2, column2;
+        json_decoder<json> decoder3;
+        json_reader reader3("[1,2,]]", decoder3, allow_extra_comma);
+        std::error_code ec1;
+        reader3.read(ec1);
+        line1 = reader3.line();
+        column1 = reader3.column();
+
+        json_decoder<json> decoder4;
+        json_structural_reader reader4("[1,2,]]", decoder4, allow_extra_comma);
+        std::error_code ec2;
+        reader4.read(ec2);
+        line2 = reader4.line();
+        column2 = reader4.column();
+
+        CHECK(ec1);
+        CHECK(ec2 == ec1);
+        CHECK(line2 == line1);
+        CHECK(column2 == column1);
+    }
+}
+
+TEST_CASE("json_structural_reader read_next tests")
+{
+    std::string s = "{\"a\":1} [1,2] \"x\"\n42 true\n{\"b\":[{},{\"c\":null}]}\n";
+    std::vector<json> expected = {json::parse("{\"a\":1}"), json::parse("[1,2]"), json("x"), json(42), json(true), json::parse("{\"b\":[{},{\"c\":null}]}")};
+
+    for (std::size_t buffer_length = 1; buffer_length <= 16; ++buffer_length)
+    {
+        std::istringstream is(s);
+        json_decoder<json> decoder;
+        json_structural_reader reader(is, decoder);
+        reader.buffer_length(buffer_length);
+
+        std::vector<json> values;
+        while (!reader.eof())
+        {
+            reader.read_next();
+            values.push_back(decoder.get_result());
+        }
+        CHECK(values == expected);
+    }
+}
+
+TEST_CASE("wjson_structural_reader tests")
+{
+    std::wstring s = L"{\"name\":\"Jane \\\"Roe\\\"\",\"tags\":[1,2.5,true,null,\"\u00e9\"]}";
+
+    json_decoder<wjson> decoder;
+    wjson_structural_reader reader(s, decoder);
+    reader.read();
+    wjson j = decoder.get_result();
+
+    CHECK(j == wjson::parse(s));
+}
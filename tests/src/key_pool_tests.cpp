@@ -0,0 +1,173 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/key_pool.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("interned_key tests")
+{
+    SECTION("copies share the string")
+    {
+        interned_key a("field");
+        interned_key b = a;
+        CHECK(a.data() == b.data());
+        CHECK(a == b);
+        CHECK(b.size() == 5);
+        CHECK(std::string(b.c_str()) == "field");
+    }
+
+    SECTION("empty key")
+    {
+        interned_key a;
+        CHECK(a.empty());
+        CHECK(a.size() == 0);
+        CHECK(std::string(a.c_str()).empty());
+        CHECK(a == "");
+    }
+
+    SECTION("comparisons")
+    {
+        interned_key a("abc");
+        interned_key b("abd");
+        CHECK(a < b);
+        CHECK(a != b);
+        CHECK(a.compare(string_view("abc")) == 0);
+        CHECK(a == std::string("abc"));
+        CHECK(std::string("abd") == b);
+        CHECK(a == interned_key("abc"));
+
+        std::ostringstream os;
+        os << a;
+        CHECK(os.str() == "abc");
+    }
+}
+
+TEST_CASE("key_pool tests")
+{
+    SECTION("equal text is stored once")
+    {
+        key_pool pool;
+        interned_key a = pool.intern("timestamp");
+        interned_key b = pool.intern(std::string("timestamp"));
+        interned_key c = pool.intern("level");
+        CHECK(a.data() == b.data());
+        CHECK(a.data() != c.data());
+        CHECK(pool.size() == 2);
+    }
+
+    SECTION("keys outlive the pool")
+    {
+        interned_key a;
+        {
+            key_pool pool;
+            a = pool.intern("message");
+        }
+        CHECK(a == "message");
+    }
+
+    SECTION("concurrent interning")
+    {
+        key_pool pool;
+        std::vector<std::vector<interned_key>> results(4);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < results.size(); ++t)
+        {
+            threads.emplace_back([&pool,&results,t]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    results[t].push_back(pool.intern("key" + std::to_string(i % 100)));
+                }
+            });
+        }
+        for (auto& th : threads)
+        {
+            th.join();
+        }
+        CHECK(pool.size() == 100);
+        for (std::size_t t = 1; t < results.size(); ++t)
+        {
+            for (std::size_t i = 0; i < results[t].size(); ++i)
+            {
+                CHECK(results[t][i].data() == results[0][i].data());
+            }
+        }
+    }
+}
+
+TEST_CASE("json_decoder with key_pool")
+{
+    std::string input = R"(
+[
+    {"id":1,"level":"info","message":"started"},
+    {"id":2,"level":"warn","message":"slow"},
+    {"id":3,"level":"info","message":"done"}
+]
+    )";
+
+    SECTION("repeated keys share one string")
+    {
+        key_pool pool;
+        json_decoder<interned_json> decoder(pool);
+        json_reader reader(input, decoder);
+        reader.read();
+        interned_json j = decoder.get_result();
+
+        REQUIRE(j.size() == 3);
+        CHECK(j[2]["message"].as<std::string>() == "done");
+        auto first = j[0].object_range().begin();
+        auto other = j[2].object_range().begin();
+        CHECK(first->key() == "id");
+        CHECK(first->key().data() == other->key().data());
+        CHECK(pool.size() == 3);
+
+        CHECK(j.to_string() == json::parse(input).to_string());
+    }
+
+    SECTION("keys are shared across documents")
+    {
+        key_pool pool;
+
+        json_decoder<interned_ojson> decoder1(pool);
+        json_reader reader1(input, decoder1);
+        reader1.read();
+        interned_ojson j1 = decoder1.get_result();
+
+        json_decoder<interned_ojson> decoder2(pool);
+        json_reader reader2(input, decoder2);
+        reader2.read();
+        interned_ojson j2 = decoder2.get_result();
+
+        CHECK(j1[1].object_range().begin()->key().data() == j2[0].object_range().begin()->key().data());
+        CHECK(j1 == j2);
+        CHECK(pool.size() == 3);
+    }
+}
+
+TEST_CASE("interned_json tests")
+{
+    interned_json j;
+    j["b"] = 2;
+    j.try_emplace("a", 1);
+    j.insert_or_assign("c", "three");
+
+    CHECK(j.size() == 3);
+    CHECK(j.contains("a"));
+    CHECK(j.at("b").as<int>() == 2);
+    CHECK(j.find("c")->value().as<std::string>() == "three");
+    CHECK(j.to_string() == R"({"a":1,"b":2,"c":"three"})");
+
+    j.erase("b");
+    CHECK_FALSE(j.contains("b"));
+
+    interned_json copy = j;
+    CHECK(copy == j);
+    CHECK(copy.object_range().begin()->key().data() == j.object_range().begin()->key().data());
+}
@@ -0,0 +1,102 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/csv/csv.hpp>
+#include <catch/catch.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("mmap_source tests")
+{
+    const std::string path = "./input/address-book.json";
+
+    std::ifstream is(path);
+    json expected = json::parse(is);
+
+    SECTION("json_reader")
+    {
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source> reader(mmap_source(path), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+    }
+
+    SECTION("json_cursor")
+    {
+        mmap_source source(path);
+        basic_json_cursor<char,mmap_source> cursor(std::move(source));
+        std::size_t count = 0;
+        for (; !cursor.done(); cursor.next())
+        {
+            ++count;
+        }
+        CHECK(count > 0);
+    }
+
+    SECTION("file not found")
+    {
+        mmap_source source("./input/no-such-file.json");
+        CHECK(source.is_error());
+        CHECK(source.error());
+
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source> reader(std::move(source), decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::source_error);
+    }
+}
+
+TEST_CASE("mmap_binary_source tests")
+{
+    json j = json::parse(R"({"a":[1,2.5,"three",null,true],"b":{"c":"d"}})");
+
+    SECTION("cbor")
+    {
+        const std::string path = "./output/mmap-test.cbor";
+        {
+            std::ofstream os(path, std::ios::binary);
+            cbor::encode_cbor(j, os);
+        }
+        json_decoder<json> decoder;
+        cbor::basic_cbor_reader<mmap_binary_source> reader(mmap_binary_source(path), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("msgpack")
+    {
+        const std::string path = "./output/mmap-test.msgpack";
+        {
+            std::ofstream os(path, std::ios::binary);
+            msgpack::encode_msgpack(j, os);
+        }
+        json_decoder<json> decoder;
+        msgpack::basic_msgpack_reader<mmap_binary_source> reader(mmap_binary_source(path), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+}
+
+TEST_CASE("mmap_source csv tests")
+{
+    const std::string path = "./csv/input/countries.csv";
+
+    csv::csv_options options;
+    options.assume_header(true);
+
+    std::ifstream is(path);
+    json expected = csv::decode_csv<json>(is, options);
+
+    json_decoder<json> decoder;
+    csv::basic_csv_reader<char,mmap_source> reader(mmap_source(path), decoder, options);
+    reader.read();
+    CHECK(decoder.get_result() == expected);
+}
@@ -410,3 +410,30 @@ TEST_CASE("order preserving erase")
     }
 }
   
+
+TEST_CASE("order preserving erase range of adjacent index entries")
+{
+    ojson j = ojson::parse(R"({"a":1,"b":2,"c":3,"d":4,"e":5})");
+
+    j.erase(j.object_range().begin()+1, j.object_range().begin()+3);
+    REQUIRE(j.size() == 3);
+    CHECK(j.to_string() == R"({"a":1,"d":4,"e":5})");
+    CHECK(j.at("d").as<int>() == 4);
+    CHECK(j.at("e").as<int>() == 5);
+}
+
+TEST_CASE("order preserving move assignment")
+{
+    json_object<std::string, ojson> o1;
+    o1.insert_or_assign("b", 1);
+    o1.insert_or_assign("a", 2);
+
+    json_object<std::string, ojson> o2;
+    o2.insert_or_assign("c", 3);
+
+    o2 = std::move(o1);
+    REQUIRE(o2.size() == 2);
+    REQUIRE(bool(o2.find("a") != o2.end()));
+    CHECK(o2.find("a")->value().as<int>() == 2);
+    CHECK(bool(o2.find("c") == o2.end()));
+}
@@ -0,0 +1,233 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/tape_json.hpp>
+#include <jsoncons_ext/jsonpath/tape_json_query.hpp>
+#include <jsoncons_ext/jmespath/tape_json_search.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    const std::string tape_input = R"(
+{
+    "store": {
+        "book": [
+            {"category":"reference","author":"Nigel Rees","title":"Sayings of the Century","price":8.95},
+            {"category":"fiction","author":"Evelyn Waugh","title":"Sword of Honour","price":12.99},
+            {"category":"fiction","author":"Herman Melville","title":"Moby Dick","isbn":"0-553-21311-3","price":8.99}
+        ],
+        "bicycle": {"color":"red","price":19.95},
+        "empty": {},
+        "none": []
+    },
+    "count": 3,
+    "big": 18446744073709551615,
+    "negative": -42,
+    "ok": true,
+    "nothing": null,
+    "escaped": "line\nbreak é"
+}
+    )";
+
+} // namespace
+
+TEST_CASE("tape_json parse and navigate")
+{
+    tape_json doc = tape_json::parse(tape_input);
+
+    SECTION("types and scalars")
+    {
+        CHECK(doc.is_object());
+        CHECK(doc.size() == 7);
+        CHECK(doc.at("count").is_int64());
+        CHECK(doc.at("count").as<int>() == 3);
+        CHECK(doc.at("big").is_uint64());
+        CHECK(doc.at("big").as<uint64_t>() == 18446744073709551615ULL);
+        CHECK(doc.at("negative").as<int64_t>() == -42);
+        CHECK(doc.at("ok").as<bool>());
+        CHECK(doc.at("nothing").is_null());
+        CHECK(doc.at("escaped").as<std::string>() == "line\nbreak \xC3\xA9");
+        CHECK(doc["store"]["bicycle"]["price"].as<double>() == 19.95);
+        CHECK(doc["store"]["bicycle"]["color"].as<string_view>() == "red");
+    }
+
+    SECTION("arrays")
+    {
+        auto books = doc.at("store").at("book");
+        REQUIRE(books.is_array());
+        CHECK(books.size() == 3);
+        CHECK(books.at(2).at("title").as<std::string>() == "Moby Dick");
+        CHECK_THROWS(books.at(3));
+
+        std::vector<std::string> authors;
+        for (const auto& book : books.array_range())
+        {
+            authors.push_back(book.at("author").as<std::string>());
+        }
+        CHECK(authors == std::vector<std::string>{"Nigel Rees","Evelyn Waugh","Herman Melville"});
+    }
+
+    SECTION("objects")
+    {
+        auto store = doc.at("store");
+        std::vector<std::string> keys;
+        for (const auto& member : store.object_range())
+        {
+            keys.push_back(std::string(member.key()));
+        }
+        CHECK(keys == std::vector<std::string>{"book","bicycle","empty","none"});
+
+        CHECK(store.contains("bicycle"));
+        CHECK_FALSE(store.contains("car"));
+        CHECK(bool(store.find("car") == store.object_range().end()));
+        CHECK(store.find("bicycle")->value().at("color").as<std::string>() == "red");
+        CHECK(store.at("empty").empty());
+        CHECK(store.at("none").size() == 0);
+        CHECK_THROWS_AS(store.at("car"), key_not_found);
+        CHECK_THROWS_AS(doc.at("count").at("x"), not_an_object);
+    }
+
+    SECTION("dump matches ojson")
+    {
+        ojson j = ojson::parse(tape_input);
+        CHECK(doc.to_string() == j.to_string());
+        CHECK(doc.at("store").to_string() == j.at("store").to_string());
+
+        std::string pretty1;
+        std::string pretty2;
+        doc.dump_pretty(pretty1);
+        j.dump_pretty(pretty2);
+        CHECK(pretty1 == pretty2);
+
+        std::ostringstream os;
+        os << doc.at("store").at("none");
+        CHECK(os.str() == "[]");
+    }
+
+    SECTION("as basic_json")
+    {
+        ojson j = doc.as<ojson>();
+        CHECK(j == ojson::parse(tape_input));
+        json b = doc.at("store").at("book").at(0).as<json>();
+        CHECK(b.at("price").as<double>() == 8.95);
+    }
+}
+
+TEST_CASE("tape_json documents")
+{
+    SECTION("scalar roots")
+    {
+        CHECK(tape_json::parse("17").as<int>() == 17);
+        CHECK(tape_json::parse("\"abc\"").as<std::string>() == "abc");
+        CHECK(tape_json::parse("null").is_null());
+        CHECK(tape_json::parse("[]").to_string() == "[]");
+        CHECK(tape_json::parse("{}").to_string() == "{}");
+        CHECK(tape_json().is_null());
+    }
+
+    SECTION("one slot per value and member name")
+    {
+        tape_json doc = tape_json::parse(R"({"a":[1,2,{"b":null}],"c":"d"})");
+        CHECK(doc.slot_count() == 10);
+    }
+
+    SECTION("copy and move keep views valid")
+    {
+        tape_json doc = tape_json::parse(R"({"a":[1,2,3]})");
+        tape_json copy = doc;
+        tape_json moved = std::move(doc);
+        CHECK(copy.at("a").at(2).as<int>() == 3);
+        CHECK(moved.at("a").at(1).as<int>() == 2);
+        copy = moved;
+        CHECK(copy.to_string() == R"({"a":[1,2,3]})");
+    }
+
+    SECTION("parse from stream")
+    {
+        std::istringstream is(R"([true,false])");
+        tape_json doc = tape_json::parse(is);
+        CHECK(doc.size() == 2);
+        CHECK_FALSE(doc.at(1).as<bool>());
+    }
+
+    SECTION("parse error")
+    {
+        CHECK_THROWS_AS(tape_json::parse("[1,2"), ser_error);
+    }
+
+    SECTION("builder as the visitor of another source")
+    {
+        json j = json::parse(R"({"x":[1.5,"y"]})");
+        tape_json_builder builder;
+        j.dump(builder);
+        tape_json doc = builder.get_result();
+        CHECK(doc.to_string() == j.to_string());
+    }
+
+    SECTION("byte strings")
+    {
+        std::vector<uint8_t> bytes = {'H','e','l','l','o'};
+        json j(byte_string_arg, bytes);
+        tape_json_builder builder;
+        j.dump(builder);
+        tape_json doc = builder.get_result();
+        CHECK(doc.is_byte_string());
+        CHECK(doc.as_byte_string_view() == byte_string_view(bytes));
+        CHECK(doc.as<std::string>() == "SGVsbG8");
+    }
+}
+
+TEST_CASE("tape_json queries")
+{
+    tape_json doc = tape_json::parse(tape_input);
+    ojson j = ojson::parse(tape_input);
+
+    SECTION("jsonpath")
+    {
+        CHECK(jsonpath::json_query(doc, "$.store.book[?(@.price < 10)].title") ==
+              jsonpath::json_query(j, "$.store.book[?(@.price < 10)].title"));
+        CHECK(jsonpath::json_query(doc.at("store"), "$..price") ==
+              jsonpath::json_query(j.at("store"), "$..price"));
+    }
+
+    SECTION("jmespath")
+    {
+        CHECK(jmespath::search(doc, "store.book[?category=='fiction'].author") ==
+              jmespath::search(j, "store.book[?category=='fiction'].author"));
+    }
+
+    SECTION("cached json")
+    {
+        const ojson* root = doc.cached_json();
+        REQUIRE(root != nullptr);
+        CHECK(*root == j);
+        CHECK(doc.cached_json() == root);
+
+        auto book = doc.at("store").at("book").at(1);
+        REQUIRE(book.cached_json() != nullptr);
+        CHECK(book.cached_json() == &(*root)["store"]["book"][1]);
+        CHECK(book.at("price").cached_json() == &(*root)["store"]["book"][1]["price"]);
+
+        CHECK(tape_json::view_type().cached_json() == nullptr);
+
+        tape_json copy(doc);
+        CHECK(copy.cached_json() != root);
+        CHECK(*copy.cached_json() == j);
+    }
+
+    SECTION("duplicate member names")
+    {
+        tape_json dup = tape_json::parse(R"({"a":{"b":1},"a":{"b":2}})");
+        CHECK(dup.cached_json() != nullptr);
+        auto second = dup.object_range().begin();
+        ++second;
+        CHECK(second->value().cached_json() == nullptr);
+        CHECK(jsonpath::json_query(second->value(), "$.b") == ojson::parse("[2]"));
+    }
+}
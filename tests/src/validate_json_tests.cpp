@@ -0,0 +1,303 @@
+// Copyright 2020 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/validate_json.hpp>
+#include <jsoncons/minify_json.hpp>
+#include <catch/catch.hpp>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // With a visitor that never stops the parse, as json_decoder does after a value at the root
+    std::error_code read_error(const std::string& s, std::size_t& line, std::size_t& column)
+    {
+        default_json_visitor visitor;
+        json_reader reader(s, visitor);
+        std::error_code ec;
+        reader.read(ec);
+        line = reader.line();
+        column = reader.column();
+        return ec;
+    }
+
+    void check_same_error(const std::string& input)
+    {
+        std::size_t expected_line, expected_column;
+        std::error_code expected = read_error(input, expected_line, expected_column);
+
+        std::error_code ec;
+        std::size_t line = 0;
+        std::size_t column = 0;
+        validate_json(input, ec, line, column);
+        CHECK(ec == expected);
+        if (expected)
+        {
+            CHECK(line == expected_line);
+            CHECK(column == expected_column);
+        }
+
+        line = 0;
+        column = 0;
+        JSONCONS_TRY
+        {
+            validate_json(input);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            line = e.line();
+            column = e.column();
+        }
+        if (expected)
+        {
+            CHECK(line == expected_line);
+            CHECK(column == expected_column);
+        }
+        if (ec != expected || (expected && (line != expected_line || column != expected_column)))
+        {
+            std::cout << "input: " << input << "\n";
+        }
+    }
+
+    const std::string sample = R"(
+// Comment
+{
+    "a" : /* "b" : [ */ 1,
+    "c" : [2, -3.5e+10, true, false, null, "d\u00e9", "\ud83d\ude00", "x\\\"y"],
+    "e" : {"f" : {}, "g" : []},
+    "h" : "caf)" "\xc3\xa9" R"(" // "i"
+}
+    )";
+}
+
+TEST_CASE("validate_json tests")
+{
+    SECTION("valid")
+    {
+        std::error_code ec;
+        validate_json(sample, ec);
+        CHECK_FALSE(ec);
+        CHECK_NOTHROW(validate_json(std::string("[1,2,{\"a\":\"b\"}]")));
+        CHECK_NOTHROW(validate_json(jsoncons::string_view(" 123 ")));
+    }
+
+    SECTION("errors")
+    {
+        const std::vector<std::string> inputs = {
+            "", "  ", "[1,2", "{\"a\" 1}", "[1 2]", "[1,]", "{\"a\":1,}", "]", "1]", "[1]x", "tru", "[trux]",
+            "[-]", "[01]", "[1.]", "[1e]", "[1e+]", "[1x]", "[\"\\x\"]", "[\"\\u12x4\"]", "[\"a\nb\"]", "[\"a\rb\"]",
+            "[\"a\tb\"]", "[\"a\x01\"]", "[\"\xff\"]", "[\"\xc3\"]", "\"abc", "{\"a\":nul}", "{'a':1}", "[1,/x]",
+            "[1] /* x */", "1 , 2", "[\"\\ud800\"]", "[\"\\ud800\\u0041\"]", "/* abc", "{\"a\":1]", "[1}",
+            "{\n\"a\":\n[1,\r\n2,\r\n3 4]}", "[\"\\u00e9\xff\"]", "[\"\\n\xe0\x80\x80\"]", "{\"a\"}", "{1:2}",
+            "[1,2\r", "1/", "1//x", "1}", "1,", "\xef\xbb\xbf", "\xef\xbb", "1.5e3//x\n-0", "1.5e3/*x*/-0", "-0]",
+            "1e3}", "1/x", "1/*x", "[1/***/]", "1 /* x */", "[1,/* \"a\n*\n*/2 x]"
+        };
+        for (const auto& input : inputs)
+        {
+            check_same_error(input);
+        }
+    }
+
+    SECTION("byte order mark")
+    {
+        std::error_code ec;
+        validate_json(std::string("\xef\xbb\xbf{}"), ec);
+        CHECK_FALSE(ec);
+        CHECK_NOTHROW(validate_json(std::string("\xef\xbb\xbf[1,2]")));
+    }
+
+    SECTION("after a number at the root")
+    {
+        std::size_t line = 0;
+        std::size_t column = 0;
+
+        std::error_code ec1;
+        validate_json(std::string("1]"), ec1, line, column);
+        CHECK(ec1 == json_errc::unexpected_right_bracket);
+        CHECK(column == 2);
+
+        std::error_code ec2;
+        validate_json(std::string("1}"), ec2, line, column);
+        CHECK(ec2 == json_errc::unexpected_right_brace);
+        CHECK(column == 2);
+
+        std::error_code ec3;
+        validate_json(std::string("1.5e3//x\n-0"), ec3, line, column);
+        CHECK(ec3 == json_errc::extra_character);
+        CHECK(line == 2);
+        CHECK(column == 1);
+
+        std::error_code ec4;
+        validate_json(std::string("1.5e3 /* x */"), ec4);
+        CHECK(ec4 == json_errc::extra_character);
+
+        std::error_code ec5;
+        validate_json(std::string("1.5e3/* x */"), ec5);
+        CHECK_FALSE(ec5);
+    }
+
+    SECTION("same errors as basic_json_reader on mutated input")
+    {
+        std::string s;
+        json::parse(sample).dump_pretty(s);
+        const std::vector<std::string> inputs = {
+            "// Comment\n" + s + "\r\n" + s,
+            sample,
+            "\xef\xbb\xbf[1e5/*x\r\n*/,2]",
+            "-12.5e3 // x\n",
+            "1.5e3//x\n-0",
+            "7/*\n**/ 8"
+        };
+        const char replacements[] = {'[', ']', '{', '}', ',', ':', '\"', '\\', '/', '*', '\n', '\r', '\t', ' ', '-', '.', 'e', '0', '1', 'x', 'n', '\xc3', '\xef', '\xff', '\x01'};
+
+        std::mt19937 gen(2020);
+        for (int i = 0; i < 10000; ++i)
+        {
+            std::string input = inputs[gen() % inputs.size()];
+            int edits = 1 + gen() % 3;
+            for (int j = 0; j < edits; ++j)
+            {
+                std::size_t pos = gen() % input.size();
+                switch (gen() % 3)
+                {
+                    case 0:
+                        input[pos] = replacements[gen() % sizeof(replacements)];
+                        break;
+                    case 1:
+                        input.insert(input.begin() + pos, replacements[gen() % sizeof(replacements)]);
+                        break;
+                    default:
+                        input.erase(pos, 1);
+                        break;
+                }
+            }
+            check_same_error(input);
+        }
+    }
+
+    SECTION("strict")
+    {
+        std::error_code ec;
+        std::size_t line = 0;
+        std::size_t column = 0;
+        auto err_handler = [&](json_errc code, const ser_context& context) -> bool
+        {
+            line = context.line();
+            column = context.column();
+            return strict_json_parsing()(code, context);
+        };
+        validate_json(sample, json_options(), err_handler, ec);
+        CHECK(ec == json_errc::illegal_comment);
+        CHECK(line == 2);
+        CHECK(column == 2);
+
+        // Reported before the end of the comment is found
+        validate_json(std::string("[1 /* abc"), json_options(), err_handler, ec);
+        CHECK(ec == json_errc::illegal_comment);
+        CHECK(column == 5);
+    }
+
+    SECTION("max nesting depth")
+    {
+        json_options options;
+        options.max_nesting_depth(10);
+        std::string input = std::string(10, '[') + std::string(10, ']');
+        CHECK_NOTHROW(validate_json(input, options));
+        input = std::string(11, '[') + std::string(11, ']');
+        REQUIRE_THROWS_AS(validate_json(input, options), ser_error);
+    }
+
+    SECTION("wide characters")
+    {
+        std::error_code ec;
+        validate_json(std::wstring(L"{\"a\":[1,2.5,\"\\u00e9\"]}"), ec);
+        CHECK_FALSE(ec);
+        validate_json(std::wstring(L"{\"a\":[1,2.5,]}"), ec);
+        CHECK(ec == json_errc::extra_comma);
+    }
+}
+
+TEST_CASE("minify_json tests")
+{
+    SECTION("to string")
+    {
+        std::string output;
+        minify_json(sample, output);
+        CHECK(output == "{\"a\":1,\"c\":[2,-3.5e+10,true,false,null,\"d\\u00e9\",\"\\ud83d\\ude00\",\"x\\\\\\\"y\"],\"e\":{\"f\":{},\"g\":[]},\"h\":\"caf\xc3\xa9\"}");
+        CHECK(json::parse(output) == json::parse(sample));
+    }
+
+    SECTION("to stream")
+    {
+        std::ostringstream os;
+        minify_json(std::string(" [ 1 , \"a b\" , { } ] "), os);
+        CHECK(os.str() == "[1,\"a b\",{}]");
+    }
+
+    SECTION("scalars")
+    {
+        std::string output;
+        minify_json(std::string("  \"a b\"  "), output);
+        CHECK(output == "\"a b\"");
+        output.clear();
+        minify_json(std::string(" -0.5e3\n"), output);
+        CHECK(output == "-0.5e3");
+        output.clear();
+        minify_json(std::string("\xef\xbb\xbf 1/* x */"), output);
+        CHECK(output == "1");
+    }
+
+    SECTION("minifies what it validates")
+    {
+        std::string s;
+        json::parse(sample).dump_pretty(s);
+
+        std::mt19937 gen(2021);
+        for (int i = 0; i < 1000; ++i)
+        {
+            std::string input = s;
+            input.insert(input.begin() + gen() % input.size(), ' ');
+            std::error_code ec1, ec2;
+            validate_json(input, ec1);
+            std::string output;
+            minify_json(input, output, ec2);
+            CHECK(ec2 == ec1);
+            if (!ec1)
+            {
+                CHECK(json::parse(output) == json::parse(input));
+                std::string output2;
+                minify_json(output, output2);
+                CHECK(output2 == output);
+            }
+        }
+    }
+
+    SECTION("error")
+    {
+        std::string output;
+        std::error_code ec;
+        minify_json(std::string("[1,2,]"), output, ec);
+        CHECK(ec == json_errc::extra_comma);
+        REQUIRE_THROWS_AS(minify_json(std::string("[1,2,]"), output), ser_error);
+
+        std::size_t line = 0;
+        std::size_t column = 0;
+        minify_json(std::string("[1,\n2,]"), output, ec, line, column);
+        CHECK(ec == json_errc::extra_comma);
+        CHECK(line == 2);
+        CHECK(column == 3);
+    }
+
+    SECTION("wide characters")
+    {
+        std::wstring output;
+        minify_json(std::wstring(L" { \"a\" : [ 1 , 2 ] } "), output);
+        CHECK(output == L"{\"a\":[1,2]}");
+    }
+}
@@ -13,6 +13,7 @@
 #include <vector>
 #include <utility>
 #include <ctime>
+#include <random>
 
 using namespace jsoncons;
 
@@ -214,3 +215,150 @@ TEST_CASE("ubjson_cursor with filter tests")
     CHECK(filtered_c.done());
 }
 
+
+namespace {
+
+    void random_ubjson_value(std::mt19937& gen, int depth, ubjson::ubjson_bytes_encoder& encoder)
+    {
+        switch (gen() % (depth > 0 ? 9 : 6))
+        {
+            case 0:
+                encoder.int64_value(static_cast<int64_t>(gen()) - static_cast<int64_t>(gen() % 2 == 0 ? 100 : 3000000000));
+                break;
+            case 1:
+                encoder.double_value(gen() % 2 == 0 ? 1.5 : 1.0e300);
+                break;
+            case 2:
+                encoder.string_value(std::string(gen() % 300, 'x'));
+                break;
+            case 3:
+                encoder.string_value("-18446744073709551617", semantic_tag::bigint);
+                break;
+            case 4:
+                encoder.null_value();
+                break;
+            case 5:
+                encoder.bool_value(true);
+                break;
+            case 6:
+            case 7:
+            {
+                std::size_t n = gen() % 30;
+                bool indefinite = gen() % 2 == 0;
+                indefinite ? encoder.begin_array() : encoder.begin_array(n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    random_ubjson_value(gen, depth - 1, encoder);
+                }
+                encoder.end_array();
+                break;
+            }
+            default:
+            {
+                std::size_t n = gen() % 30;
+                bool indefinite = gen() % 2 == 0;
+                indefinite ? encoder.begin_object() : encoder.begin_object(n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    encoder.key(std::string(gen() % 3, 'k') + std::to_string(i));
+                    random_ubjson_value(gen, depth - 1, encoder);
+                }
+                encoder.end_object();
+                break;
+            }
+        }
+    }
+
+    std::string ubjson_event_string(const staj_cursor& cursor)
+    {
+        std::string s = std::to_string(static_cast<int>(cursor.current().event_type()));
+        switch (cursor.current().event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+            case staj_event_type::int64_value:
+            case staj_event_type::uint64_value:
+                s.push_back(':');
+                s.append(cursor.current().get<std::string>());
+                break;
+            default:
+                break;
+        }
+        s.push_back('@');
+        s.append(std::to_string(cursor.context().column()));
+        return s;
+    }
+}
+
+TEST_CASE("ubjson_cursor skip tests")
+{
+    SECTION("skip strongly typed containers")
+    {
+        // [[$i#U3 1 2 3], {$S#U1 U1 a U1 x}, [$[#U2 #U1 Z [ ]], 1]
+        std::vector<uint8_t> data = {'[','[','$','i','#','U',3,1,2,3,
+                                     '{','$','S','#','U',1,'U',1,'a','U',1,'x',
+                                     '[','$','[','#','U',2,'#','U',1,'Z',']',
+                                     'U',1,']'};
+        ubjson::ubjson_bytes_cursor cursor(data);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.current().get<int>() == 1);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("truncated input")
+    {
+        std::vector<uint8_t> data = {'[','[','$','l','#','U',3,0,0,0,1,0,0,0,2,0,0};
+        ubjson::ubjson_bytes_cursor cursor(data);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == ubjson::ubjson_errc::unexpected_eof);
+    }
+
+    SECTION("same events and positions as skipping event by event")
+    {
+        std::mt19937 gen(2020);
+        for (int i = 0; i < 200; ++i)
+        {
+            std::vector<uint8_t> data;
+            ubjson::ubjson_bytes_encoder encoder(data);
+            random_ubjson_value(gen, 4, encoder);
+            encoder.flush();
+
+            ubjson::ubjson_bytes_cursor cursor1(data);
+            ubjson::ubjson_bytes_cursor cursor2(data);
+            std::mt19937 choice(i);
+            while (!cursor1.done() && !cursor2.done())
+            {
+                REQUIRE(ubjson_event_string(cursor1) == ubjson_event_string(cursor2));
+                if (choice() % 3 == 0)
+                {
+                    cursor1.skip();
+                    std::error_code ec;
+                    cursor2.staj_cursor::skip(ec); // event by event
+                    REQUIRE_FALSE(ec);
+                    REQUIRE(ubjson_event_string(cursor1) == ubjson_event_string(cursor2));
+                }
+                cursor1.next();
+                cursor2.next();
+            }
+            CHECK(cursor1.done());
+            CHECK(cursor2.done());
+        }
+    }
+}